@@ -19,6 +19,7 @@
 #include <phosphor-logging/lg2.hpp>
 
 #include <coroutine>
+#include <cstddef>
 namespace pldm
 {
 namespace requester
@@ -183,5 +184,60 @@ struct Coroutine
      */
     mutable std::coroutine_handle<promise_type> handle;
 };
+
+/** @struct WorkerGroup
+ *
+ * Book keeping of the detached worker coroutines started by a task. The task
+ * co_awaits the group to resume once every worker called workerDone().
+ */
+struct WorkerGroup
+{
+    WorkerGroup() = default;
+    WorkerGroup(const WorkerGroup&) = delete;
+    WorkerGroup& operator=(const WorkerGroup&) = delete;
+
+    /** @brief number of workers still running */
+    size_t activeWorkers = 0;
+
+    /** @brief the task waiting for the workers */
+    std::coroutine_handle<> waiter;
+
+    /** @brief The awaiter refers to the group, so the waiting task is
+     * recorded in the group the workers finish with, never in a copy of it.
+     */
+    auto operator co_await() noexcept
+    {
+        struct awaiter
+        {
+            WorkerGroup& group;
+
+            bool await_ready() const noexcept
+            {
+                return group.activeWorkers == 0;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle) noexcept
+            {
+                group.waiter = handle;
+            }
+
+            void await_resume() const noexcept {}
+        };
+        return awaiter{*this};
+    }
+
+    /** @brief Called by a worker when it finished, the last one resumes the
+     * waiting task
+     */
+    void workerDone()
+    {
+        if (--activeWorkers == 0 && waiter)
+        {
+            auto handle = waiter;
+            waiter = nullptr;
+            handle.resume();
+        }
+    }
+};
 } // namespace requester
 } // namespace pldm
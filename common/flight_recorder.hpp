@@ -8,6 +8,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <span>
 #include <vector>
 namespace pldm
 {
@@ -68,7 +69,7 @@ class FlightRecorder
      *
      *  @return void
      */
-    void saveRecord(const FlightRecorderData& buffer, ReqOrResponse isRequest)
+    void saveRecord(std::span<const uint8_t> buffer, ReqOrResponse isRequest)
     {
         // if the flight recorder policy is enabled, then only insert the
         // messages into the flight recorder, if not this function will be just
@@ -76,8 +77,11 @@ class FlightRecorder
         if (flightRecorderPolicy)
         {
             int currentIndex = index++;
-            tapeRecorder[currentIndex] = std::make_tuple(
-                pldm::utils::getCurrentSystemTime(), isRequest, buffer);
+            // reuse the storage of the overwritten record
+            auto& [timeStamp, reqOrResponse, data] = tapeRecorder[currentIndex];
+            timeStamp = pldm::utils::getCurrentSystemTime();
+            reqOrResponse = isRequest;
+            data.assign(buffer.begin(), buffer.end());
             index =
                 (currentIndex == FLIGHT_RECORDER_MAX_ENTRIES - 1) ? 0 : index;
         }
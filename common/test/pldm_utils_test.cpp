@@ -965,4 +965,73 @@ TEST(Split, allTestCases)
     std::string s5 = "aa\\";
     auto results5 = split(s5, "\\");
     EXPECT_EQ(results5[0], "aa");
-}
\ No newline at end of file
+}
+TEST(DBusCache, serviceAndProperties)
+{
+    DBusCache cache;
+    const std::string path = "/xyz/openbmc_project/state/host0";
+    const std::string interface = "xyz.openbmc_project.State.Host";
+    const std::string property = "CurrentHostState";
+    const PropertyValue running = std::string("Running");
+    const PropertyValue off = std::string("Off");
+
+    EXPECT_FALSE(cache.getService(path, interface));
+    cache.setService(path, interface, "xyz.openbmc_project.State.Host");
+    EXPECT_EQ("xyz.openbmc_project.State.Host",
+              cache.getService(path, interface));
+
+    // only the watched properties are cached
+    cache.setProperty(path, interface, property, running);
+    EXPECT_FALSE(cache.getProperty(path, interface, property));
+    EXPECT_TRUE(cache.watchProperty(path, interface, property));
+    EXPECT_FALSE(cache.watchProperty(path, interface, property));
+    cache.setProperty(path, interface, property, running);
+    EXPECT_EQ(running, cache.getProperty(path, interface, property));
+
+    cache.propertiesChanged(path, interface,
+                            {{property, off}, {"RequestedHostTransition",
+                                               std::string("On")}});
+    EXPECT_EQ(off, cache.getProperty(path, interface, property));
+    EXPECT_FALSE(cache.getProperty(path, interface, "RequestedHostTransition"));
+
+    cache.dropProperties(path, interface);
+    EXPECT_FALSE(cache.getProperty(path, interface, property));
+    EXPECT_TRUE(cache.getService(path, interface));
+}
+
+TEST(DBusCache, invalidation)
+{
+    DBusCache cache;
+    const std::string interface = "xyz.openbmc_project.Sensor.Value";
+    const PropertyValue value = 1.0;
+    const std::vector<std::string> paths{
+        "/xyz/openbmc_project/sensors/temperature/a",
+        "/xyz/openbmc_project/sensors/temperature/ab",
+        "/xyz/openbmc_project/sensors/temperature/b"};
+    for (const auto& path : paths)
+    {
+        cache.watchProperty(path, interface, "Value");
+        cache.setService(path, interface,
+                         path == paths[2] ? "service.b" : "service.a");
+        cache.setProperty(path, interface, "Value", value);
+    }
+
+    // a value is not cached without the service of its object
+    const std::string unknown = "/xyz/openbmc_project/sensors/temperature/c";
+    cache.watchProperty(unknown, interface, "Value");
+    cache.setProperty(unknown, interface, "Value", value);
+    cache.propertiesChanged(unknown, interface, {{"Value", value}});
+    EXPECT_FALSE(cache.getProperty(unknown, interface, "Value"));
+
+    cache.interfacesChanged(paths[0]);
+    EXPECT_FALSE(cache.getService(paths[0], interface));
+    EXPECT_FALSE(cache.getProperty(paths[0], interface, "Value"));
+    EXPECT_TRUE(cache.getService(paths[1], interface));
+    EXPECT_TRUE(cache.getProperty(paths[1], interface, "Value"));
+
+    cache.nameOwnerChanged("service.a");
+    EXPECT_FALSE(cache.getService(paths[1], interface));
+    EXPECT_FALSE(cache.getProperty(paths[1], interface, "Value"));
+    EXPECT_TRUE(cache.getService(paths[2], interface));
+    EXPECT_TRUE(cache.getProperty(paths[2], interface, "Value"));
+}
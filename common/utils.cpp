@@ -6,6 +6,7 @@
 #include "libpldm/pldm_types.h"
 
 #include <phosphor-logging/lg2.hpp>
+#include <sdbusplus/bus/match.hpp>
 #include <xyz/openbmc_project/Common/error.hpp>
 #include <xyz/openbmc_project/Logging/Entry/server.hpp>
 #include <xyz/openbmc_project/Software/ExtendedVersion/server.hpp>
@@ -17,6 +18,7 @@
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -212,9 +214,221 @@ std::optional<std::vector<set_effecter_state_field>>
     return std::make_optional(std::move(stateField));
 }
 
+std::optional<ServiceName>
+    DBusCache::getService(const std::string& path,
+                          const std::string& interface) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = services.find({path, interface});
+    if (it == services.end())
+    {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void DBusCache::setService(const std::string& path,
+                           const std::string& interface,
+                           const ServiceName& service)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    services.insert_or_assign({path, interface}, service);
+}
+
+bool DBusCache::watchProperty(const std::string& path,
+                              const std::string& interface,
+                              const std::string& property)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return watched.emplace(path, interface, property).second;
+}
+
+std::optional<PropertyValue>
+    DBusCache::getProperty(const std::string& path,
+                           const std::string& interface,
+                           const std::string& property) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = values.find({path, interface, property});
+    if (it == values.end())
+    {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void DBusCache::setProperty(const std::string& path,
+                            const std::string& interface,
+                            const std::string& property,
+                            const PropertyValue& value)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    PropertyKey key{path, interface, property};
+    if (!watched.contains(key) || !services.contains({path, interface}))
+    {
+        return;
+    }
+    values.insert_or_assign(std::move(key), value);
+}
+
+void DBusCache::propertiesChanged(const std::string& path,
+                                  const std::string& interface,
+                                  const DbusChangedProps& properties)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!services.contains({path, interface}))
+    {
+        return;
+    }
+    for (const auto& [property, value] : properties)
+    {
+        PropertyKey key{path, interface, property};
+        if (watched.contains(key))
+        {
+            values.insert_or_assign(std::move(key), value);
+        }
+    }
+}
+
+void DBusCache::interfacesChanged(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = services.lower_bound({path, ""});
+    while (it != services.end() && it->first.first == path)
+    {
+        eraseProperties(path, it->first.second);
+        it = services.erase(it);
+    }
+}
+
+void DBusCache::nameOwnerChanged(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = services.begin(); it != services.end();)
+    {
+        if (it->second == name)
+        {
+            eraseProperties(it->first.first, it->first.second);
+            it = services.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void DBusCache::dropProperties(const std::string& path,
+                               const std::string& interface)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    eraseProperties(path, interface);
+}
+
+void DBusCache::eraseProperties(const std::string& path,
+                                const std::string& interface)
+{
+    auto it = values.lower_bound({path, interface, ""});
+    while (it != values.end() && std::get<0>(it->first) == path &&
+           std::get<1>(it->first) == interface)
+    {
+        it = values.erase(it);
+    }
+}
+
+namespace
+{
+
+/** @brief The cache shared by the DBusHandler objects and the signal matches
+ *         keeping it up to date, null until DBusHandler::enableCache()
+ */
+struct SharedCache
+{
+    DBusCache cache;
+    std::vector<sdbusplus::bus::match_t> matches;
+    std::map<std::pair<ObjectPath, std::string>, sdbusplus::bus::match_t>
+        propertyMatches;
+};
+
+std::unique_ptr<SharedCache> sharedCache;
+
+} // namespace
+
+void DBusHandler::enableCache()
+{
+    if (sharedCache)
+    {
+        return;
+    }
+
+    namespace rules = sdbusplus::bus::match::rules;
+    auto& bus = getBus();
+    auto shared = std::make_unique<SharedCache>();
+    auto& cache = shared->cache;
+    auto interfacesChanged = [&cache](sdbusplus::message::message& msg) {
+        sdbusplus::message::object_path path;
+        msg.read(path);
+        cache.interfacesChanged(path.str);
+    };
+    shared->matches.emplace_back(bus, rules::interfacesAdded(),
+                                 interfacesChanged);
+    shared->matches.emplace_back(bus, rules::interfacesRemoved(),
+                                 interfacesChanged);
+    shared->matches.emplace_back(
+        bus, rules::nameOwnerChanged(),
+        [&cache](sdbusplus::message::message& msg) {
+        std::string name;
+        msg.read(name);
+        cache.nameOwnerChanged(name);
+    });
+    sharedCache = std::move(shared);
+}
+
+void DBusHandler::cacheProperty(const std::string& objPath,
+                                const std::string& interface,
+                                const std::string& property)
+{
+    if (!sharedCache ||
+        !sharedCache->cache.watchProperty(objPath, interface, property) ||
+        sharedCache->propertyMatches.contains({objPath, interface}))
+    {
+        return;
+    }
+
+    auto& cache = sharedCache->cache;
+    sharedCache->propertyMatches.emplace(
+        std::piecewise_construct, std::forward_as_tuple(objPath, interface),
+        std::forward_as_tuple(
+            getBus(),
+            sdbusplus::bus::match::rules::propertiesChanged(objPath,
+                                                            interface),
+            [&cache, objPath, interface](sdbusplus::message::message& msg) {
+        try
+        {
+            std::string changedInterface;
+            DbusChangedProps properties;
+            msg.read(changedInterface, properties);
+            cache.propertiesChanged(objPath, interface, properties);
+        }
+        catch (const std::exception&)
+        {
+            // the values can't be trusted without the change
+            cache.dropProperties(objPath, interface);
+        }
+    }));
+}
+
 std::string DBusHandler::getService(const char* path,
                                     const char* interface) const
 {
+    if (sharedCache)
+    {
+        if (auto service = sharedCache->cache.getService(path, interface))
+        {
+            return *service;
+        }
+    }
+
     using DbusInterfaceList = std::vector<std::string>;
     std::map<std::string, std::vector<std::string>> mapperResponse;
     auto& bus = DBusHandler::getBus();
@@ -225,6 +439,11 @@ std::string DBusHandler::getService(const char* path,
 
     auto mapperResponseMsg = bus.call(mapper);
     mapperResponseMsg.read(mapperResponse);
+    if (sharedCache)
+    {
+        sharedCache->cache.setService(path, interface,
+                                      mapperResponse.begin()->first);
+    }
     return mapperResponse.begin()->first;
 }
 
@@ -274,7 +493,7 @@ void reportError(const char* errorMsg)
 void DBusHandler::setDbusProperty(const DBusMapping& dBusMap,
                                   const PropertyValue& value) const
 {
-    auto setDbusValue = [&dBusMap, this](const auto& variant) {
+    auto setDbusValue = [&dBusMap, &value, this](const auto& variant) {
         auto& bus = getBus();
         auto service =
             getService(dBusMap.objectPath.c_str(), dBusMap.interface.c_str());
@@ -283,6 +502,12 @@ void DBusHandler::setDbusProperty(const DBusMapping& dBusMap,
         method.append(dBusMap.interface.c_str(), dBusMap.propertyName.c_str(),
                       variant);
         bus.call_noreply(method);
+        if (sharedCache)
+        {
+            sharedCache->cache.setProperty(dBusMap.objectPath,
+                                           dBusMap.interface,
+                                           dBusMap.propertyName, value);
+        }
     };
 
     if (dBusMap.propertyType == "uint8_t")
@@ -350,6 +575,15 @@ void DBusHandler::setDbusProperty(const DBusMapping& dBusMap,
 PropertyValue DBusHandler::getDbusPropertyVariant(
     const char* objPath, const char* dbusProp, const char* dbusInterface) const
 {
+    if (sharedCache)
+    {
+        if (auto value =
+                sharedCache->cache.getProperty(objPath, dbusInterface, dbusProp))
+        {
+            return *value;
+        }
+    }
+
     auto& bus = DBusHandler::getBus();
     auto service = getService(objPath, dbusInterface);
     auto method =
@@ -358,6 +592,10 @@ PropertyValue DBusHandler::getDbusPropertyVariant(
     PropertyValue value{};
     auto reply = bus.call(method);
     reply.read(value);
+    if (sharedCache)
+    {
+        sharedCache->cache.setProperty(objPath, dbusInterface, dbusProp, value);
+    }
     return value;
 }
 
@@ -539,7 +777,7 @@ uint16_t findStateSensorId(const pldm_pdr* pdrRepo, uint8_t tid,
     return PLDM_INVALID_EFFECTER_ID;
 }
 
-void printBuffer(bool isTx, const std::vector<uint8_t>& buffer)
+void printBuffer(bool isTx, std::span<const uint8_t> buffer)
 {
     if (!buffer.empty())
     {
@@ -563,9 +801,8 @@ void printBuffer(bool isTx, const std::vector<uint8_t>& buffer)
 void printBuffer(bool isTx, const pldm_msg* buffer, size_t bufferLen)
 {
     auto ptr = reinterpret_cast<const uint8_t*>(buffer);
-    auto outBuffer =
-        std::vector<uint8_t>(ptr, ptr + (sizeof(pldm_msg_hdr) + bufferLen));
-    printBuffer(isTx, outBuffer);
+    printBuffer(isTx, std::span<const uint8_t>(
+                          ptr, sizeof(pldm_msg_hdr) + bufferLen));
 }
 
 std::string toString(const struct variable_field& var)
@@ -19,7 +19,13 @@
 #include <exception>
 #include <filesystem>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <span>
 #include <string>
+#include <tuple>
 #include <variant>
 #include <vector>
 
@@ -157,6 +163,87 @@ using Interfaces = std::vector<std::string>;
 using MapperServiceMap = std::vector<std::pair<ServiceName, Interfaces>>;
 using GetSubTreeResponse = std::vector<std::pair<ObjectPath, MapperServiceMap>>;
 
+/**
+ *  @class DBusCache
+ *
+ *  The cache of the service names resolved by the mapper and of the values of
+ *  the watched properties. The cache only keeps the bookkeeping, the owner
+ *  feeds it with the InterfacesAdded/InterfacesRemoved, NameOwnerChanged and
+ *  PropertiesChanged signals. A property value is only cached while the
+ *  service of its object is cached, so dropping a service drops the values it
+ *  serves.
+ */
+class DBusCache
+{
+  public:
+    /** @brief Get the cached service of an object
+     *
+     *  @param[in] path - D-Bus object path
+     *  @param[in] interface - D-Bus interface
+     *
+     *  @return the service name, std::nullopt if not cached
+     */
+    std::optional<ServiceName> getService(const std::string& path,
+                                          const std::string& interface) const;
+
+    /** @brief Cache the service of an object */
+    void setService(const std::string& path, const std::string& interface,
+                    const ServiceName& service);
+
+    /** @brief Cache the values of a property from now on
+     *
+     *  @return true if the property wasn't watched before
+     */
+    bool watchProperty(const std::string& path, const std::string& interface,
+                       const std::string& property);
+
+    /** @brief Get the cached value of a property
+     *
+     *  @return the value, std::nullopt if not cached
+     */
+    std::optional<PropertyValue>
+        getProperty(const std::string& path, const std::string& interface,
+                    const std::string& property) const;
+
+    /** @brief Cache the value of a property, no-op if the property isn't
+     *         watched or the service of the object isn't cached
+     */
+    void setProperty(const std::string& path, const std::string& interface,
+                     const std::string& property, const PropertyValue& value);
+
+    /** @brief Update the values from a PropertiesChanged signal */
+    void propertiesChanged(const std::string& path,
+                           const std::string& interface,
+                           const DbusChangedProps& properties);
+
+    /** @brief Drop the services and values of an object whose interfaces are
+     *         added or removed
+     */
+    void interfacesChanged(const std::string& path);
+
+    /** @brief Drop the services and values served by a name whose owner has
+     *         changed
+     */
+    void nameOwnerChanged(const std::string& name);
+
+    /** @brief Drop the values of an object interface, e.g. when its
+     *         PropertiesChanged signal can't be decoded
+     */
+    void dropProperties(const std::string& path, const std::string& interface);
+
+  private:
+    using ServiceKey = std::pair<ObjectPath, std::string>;
+    using PropertyKey = std::tuple<ObjectPath, std::string, DbusProp>;
+
+    /** @brief Drop the values of an object interface, mutex held */
+    void eraseProperties(const std::string& path, const std::string& interface);
+
+    mutable std::mutex mutex;
+    std::map<ServiceKey, ServiceName> services;
+    std::set<PropertyKey> watched;
+    std::map<PropertyKey, PropertyValue> values;
+};
+
 /**
  * @brief The interface for DBusHandler
  */
@@ -210,6 +297,25 @@ class DBusHandler : public DBusHandlerInterface
         return conn;
     }
 
+    /** @brief Cache the service names resolved by the mapper and the values
+     *         of the properties watched by cacheProperty(). The cache is kept
+     *         up to date by the bus signals, so it must only be enabled by a
+     *         process that dispatches the bus on its event loop.
+     */
+    static void enableCache();
+
+    /** @brief Serve the property from memory once it is read, the cached
+     *         value is updated by the PropertiesChanged signal. No-op if the
+     *         cache isn't enabled.
+     *
+     *  @param[in] objPath - The Dbus object path
+     *  @param[in] interface - The Dbus interface
+     *  @param[in] property - The property name
+     */
+    static void cacheProperty(const std::string& objPath,
+                              const std::string& interface,
+                              const std::string& property);
+
     /**
      *  @brief Get the DBUS Service name for the input dbus path
      *
@@ -397,7 +503,7 @@ int emitStateSensorEventSignal(uint8_t tid, uint16_t sensorId,
  *
  *  @return - None
  */
-void printBuffer(bool isTx, const std::vector<uint8_t>& buffer);
+void printBuffer(bool isTx, std::span<const uint8_t> buffer);
 
 /** @brief Print the buffer
  *
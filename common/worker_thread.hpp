@@ -0,0 +1,179 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "common/utils.hpp"
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+#include <sdeventplus/event.hpp>
+#include <sdeventplus/source/io.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <thread>
+
+namespace pldm
+{
+namespace utils
+{
+
+/** @class WorkerThread
+ *
+ *  WorkerThread runs a job on a thread and hands its progress back to the
+ *  event loop. Every notify() from the job signals an eventfd, the handler
+ *  is then invoked on the event loop, where the results can be collected
+ *  under the owner's lock. Destroying it cancels the job and joins the
+ *  thread, so it is declared after the members the job uses. A job waiting
+ *  on the owner's condition variable is woken up by the owner first.
+ */
+class WorkerThread
+{
+  public:
+    /** @brief handler invoked on the event loop after notify() */
+    using Handler = std::function<void()>;
+
+    WorkerThread() = delete;
+    WorkerThread(const WorkerThread&) = delete;
+    WorkerThread(WorkerThread&&) = delete;
+    WorkerThread& operator=(const WorkerThread&) = delete;
+    WorkerThread& operator=(WorkerThread&&) = delete;
+
+    /** @brief Constructor
+     *
+     *  The job still runs if the eventfd cannot be created, but the handler
+     *  is never invoked, see canNotify().
+     *
+     *  @param[in] event - the event loop to invoke the handler on
+     *  @param[in] handler - handler invoked after notify()
+     */
+    WorkerThread(sdeventplus::Event& event, Handler handler) :
+        handler(std::move(handler)),
+        notifyFd(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK))
+    {
+        if (notifyFd() < 0)
+        {
+            lg2::error("Failed to create eventfd for worker thread, {ERROR}.",
+                       "ERROR", std::strerror(errno));
+            return;
+        }
+
+        notifyIO = std::make_unique<sdeventplus::source::IO>(
+            event, notifyFd(), EPOLLIN,
+            [this](sdeventplus::source::IO&, int fd, uint32_t) {
+                uint64_t count = 0;
+                if (read(fd, &count, sizeof(count)) < 0 && errno != EAGAIN)
+                {
+                    lg2::error("Failed to read worker thread eventfd, {ERROR}.",
+                               "ERROR", std::strerror(errno));
+                }
+                this->handler();
+            });
+    }
+
+    /** @brief Cancel the job and join the thread */
+    ~WorkerThread()
+    {
+        cancel();
+        join();
+    }
+
+    /** @brief Start the job on a new thread
+     *
+     *  @param[in] job - the job, it polls isCancelled() to stop early
+     *
+     *  @return false if the previous job has not been joined
+     */
+    bool start(std::function<void()> job)
+    {
+        if (thread.joinable())
+        {
+            return false;
+        }
+        cancelled = false;
+        thread = std::thread(std::move(job));
+        return true;
+    }
+
+    /** @brief Invoke the handler on the event loop, called by the job */
+    void notify()
+    {
+        if (notifyFd() < 0)
+        {
+            return;
+        }
+
+        uint64_t one = 1;
+        if (write(notifyFd(), &one, sizeof(one)) < 0)
+        {
+            lg2::error("Failed to signal worker thread eventfd, {ERROR}.",
+                       "ERROR", std::strerror(errno));
+        }
+    }
+
+    /** @brief Ask the job to stop early */
+    void cancel()
+    {
+        cancelled = true;
+    }
+
+    /** @brief Check whether the job is asked to stop, called by the job */
+    bool isCancelled() const
+    {
+        return cancelled;
+    }
+
+    /** @brief Wait for the job to return */
+    void join()
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+
+    /** @brief Check whether a job is started and not joined yet */
+    bool isRunning() const
+    {
+        return thread.joinable();
+    }
+
+    /** @brief Check whether notify() reaches the event loop */
+    bool canNotify() const
+    {
+        return notifyIO != nullptr;
+    }
+
+  private:
+    Handler handler;
+
+    /** @brief eventfd the job signals */
+    CustomFD notifyFd;
+    std::unique_ptr<sdeventplus::source::IO> notifyIO;
+
+    std::atomic<bool> cancelled{false};
+    std::thread thread;
+};
+
+} // namespace utils
+} // namespace pldm
@@ -23,7 +23,9 @@
 
 #include <phosphor-logging/lg2.hpp>
 
+#include <algorithm>
 #include <functional>
+#include <span>
 
 namespace pldm
 {
@@ -33,6 +35,12 @@ namespace fw_update
 
 requester::Coroutine ComponentUpdater::startComponentUpdater()
 {
+    auto packageReader = updateManager->getPackageReader();
+    if (packageReader)
+    {
+        packageReader->willNeed(compOffset, compSize);
+    }
+
     auto rc = co_await sendUpdateComponentRequest(componentIndex);
     if (rc)
     {
@@ -100,6 +108,10 @@ requester::Coroutine ComponentUpdater::sendUpdateComponentRequest(size_t offset)
         lg2::error("encode_update_component_req failed, EID={EID}, RC={RC}",
                    "EID", eid, "RC", rc);
         componentUpdaterState.set(ComponentUpdaterSequence::Invalid);
+        pldmRequest = std::make_unique<sdeventplus::source::Defer>(
+            updateManager->event,
+            std::bind(&ComponentUpdater::updateComponentComplete, this,
+                      ComponentUpdateStatus::UpdateFailed));
         co_return PLDM_ERROR;
     }
 
@@ -176,6 +188,10 @@ int ComponentUpdater::processUpdateComponentResponse(mctp_eid_t eid,
             "Decoding UpdateComponent response failed, EID={EID}, RC={RC}",
             "EID", eid, "RC", rc);
         componentUpdaterState.set(ComponentUpdaterSequence::Invalid);
+        pldmRequest = std::make_unique<sdeventplus::source::Defer>(
+            updateManager->event,
+            std::bind(&ComponentUpdater::updateComponentComplete, this,
+                      ComponentUpdateStatus::UpdateFailed));
         return rc;
     }
     if (completionCode)
@@ -270,11 +286,6 @@ Response ComponentUpdater::requestFwData(const pldm_msg* request,
         return response;
     }
 
-    const auto& applicableComponents =
-        std::get<ApplicableComponents>(fwDeviceIDRecord);
-    const auto& comp = compImageInfos[applicableComponents[componentIndex]];
-    auto compOffset = std::get<5>(comp);
-    auto compSize = std::get<6>(comp);
     if (updateManager->fwDebug)
     {
         lg2::info("EID={EID}, ComponentIndex={COMPONENTINDEX}, Offset="
@@ -298,6 +309,25 @@ Response ComponentUpdater::requestFwData(const pldm_msg* request,
                   "EID", eid, "COMPONENTINDEX", componentIndex);
     }
 
+    if (updateManager->isVerificationFailed())
+    {
+        // the package failed the verification which ran alongside the
+        // transfer, stop serving the data so the FD aborts the transfer
+        lg2::error("RequestFirmwareData reported PLDM_FWUP_CANCEL_PENDING, "
+                   "package verification failed, EID={EID}",
+                   "EID", eid);
+        rc = encode_request_firmware_data_resp(
+            request->hdr.instance_id, PLDM_FWUP_CANCEL_PENDING, responseMsg,
+            sizeof(completionCode));
+        if (rc)
+        {
+            lg2::error(
+                "Encoding RequestFirmwareData response failed, EID={EID}, RC={RC}",
+                "EID", eid, "RC", rc);
+        }
+        return response;
+    }
+
     if (length < PLDM_FWUP_BASELINE_TRANSFER_SIZE || length > maxTransferSize)
     {
         lg2::error(
@@ -341,11 +371,22 @@ Response ComponentUpdater::requestFwData(const pldm_msg* request,
 
     response.resize(sizeof(pldm_msg_hdr) + sizeof(completionCode) + length);
     responseMsg = reinterpret_cast<pldm_msg*>(response.data());
-    package.seekg(compOffset + offset);
-    package.read(reinterpret_cast<char*>(response.data() +
-                                         sizeof(pldm_msg_hdr) +
-                                         sizeof(completionCode)),
-                 length - padBytes);
+    auto data = response.data() + sizeof(pldm_msg_hdr) + sizeof(completionCode);
+    auto count = length - padBytes;
+    auto packageReader = updateManager->getPackageReader();
+    auto image = packageReader
+                     ? packageReader->view(
+                           static_cast<size_t>(compOffset) + offset, count)
+                     : std::span<const uint8_t>{};
+    if (image.data() && image.size() == count)
+    {
+        std::copy(image.begin(), image.end(), data);
+    }
+    else
+    {
+        package.seekg(compOffset + offset);
+        package.read(reinterpret_cast<char*>(data), count);
+    }
     rc = encode_request_firmware_data_resp(request->hdr.instance_id,
                                            completionCode, responseMsg,
                                            sizeof(completionCode));
@@ -241,7 +241,19 @@ class ComponentUpdater
         updateManager(updateManager), deviceUpdater(deviceUpdater),
         componentIndex(componentIndex), reqFwDataTimer(nullptr),
         completeCommandsTimeoutTimer(nullptr)
-    {}
+    {
+        const auto& applicableComponents =
+            std::get<ApplicableComponents>(fwDeviceIDRecord);
+        if (componentIndex < applicableComponents.size())
+        {
+            const auto& comp =
+                compImageInfos[applicableComponents[componentIndex]];
+            compOffset = std::get<static_cast<size_t>(
+                ComponentImageInfoPos::CompLocationOffsetPos)>(comp);
+            compSize = std::get<static_cast<size_t>(
+                ComponentImageInfoPos::CompSizePos)>(comp);
+        }
+    }
 
     /**
      * @brief start component updater
@@ -405,6 +417,10 @@ class ComponentUpdater
      */
     size_t componentIndex = 0;
 
+    /** @brief Offset and size of the component image in the package */
+    CompLocationOffset compOffset = 0;
+    CompSize compSize = 0;
+
     size_t numComponents = 0;
 
     /** @brief To send a PLDM request after the current command handling */
@@ -86,6 +86,9 @@ requester::Coroutine DeviceUpdater::startDeviceUpdate()
              .first->startComponentUpdater();
     if (rc)
     {
+        // the component updater completes the component as failed, which
+        // moves on to the next component or completes the device, so the
+        // device gives up its slot on the bus
         lg2::error("Error while initiating component updater for "
                    "ComponentIndex={COMPONENTINDEX}.",
                    "COMPONENTINDEX", componentIndex);
@@ -626,32 +629,19 @@ requester::Coroutine DeviceUpdater::updateComponentCompletion(
             // Activate firmware if atleast one component update is success.
             if (compUpdater.second.second == true)
             {
-                if (updateManager->isStageOnlyUpdate)
+                if (updateManager->isVerificationPending())
                 {
-                    updateModeIdleTimer = std::make_unique<
-                        sdbusplus::Timer>([this]() {
-                        lg2::info(
-                            "Firmware images are successfully staged, EID={EID}",
-                            "EID", eid);
-                        updateManager->updateDeviceCompletion(eid, true,
-                                                              successCompNames);
-                        deviceUpdaterState.nextState(deviceUpdaterState.current,
-                                                     componentIndex,
-                                                     numComponents);
-                    });
-                    updateModeIdleTimer->start(
-                        std::chrono::seconds(UPDATE_MODE_IDLE_TIMEOUT), false);
+                    lg2::info(
+                        "Hold the activation until the package is verified, EID={EID}",
+                        "EID", eid);
+                    heldForVerification = true;
+                    co_return PLDM_SUCCESS;
                 }
-                else
+                if (updateManager->isVerificationFailed())
                 {
-                    auto rc = co_await sendActivateFirmwareRequest();
-                    if (rc)
-                    {
-                        lg2::error("Error while sending ActivateFirmware.");
-                        co_return PLDM_ERROR;
-                    }
+                    co_return co_await cancelDeviceUpdate();
                 }
-                co_return PLDM_SUCCESS;
+                co_return co_await completeDeviceUpdate();
             }
         }
         // None of the component update is success, cancel the update
@@ -674,6 +664,69 @@ requester::Coroutine DeviceUpdater::updateComponentCompletion(
     }
 }
 
+requester::Coroutine DeviceUpdater::completeDeviceUpdate()
+{
+    if (updateManager->isStageOnlyUpdate)
+    {
+        updateModeIdleTimer = std::make_unique<sdbusplus::Timer>([this]() {
+            lg2::info("Firmware images are successfully staged, EID={EID}",
+                      "EID", eid);
+            updateManager->updateDeviceCompletion(eid, true, successCompNames);
+            deviceUpdaterState.nextState(deviceUpdaterState.current,
+                                         componentIndex, numComponents);
+        });
+        updateModeIdleTimer->start(
+            std::chrono::seconds(UPDATE_MODE_IDLE_TIMEOUT), false);
+        co_return PLDM_SUCCESS;
+    }
+
+    auto rc = co_await sendActivateFirmwareRequest();
+    if (rc)
+    {
+        lg2::error("Error while sending ActivateFirmware.");
+        // not every failure of ActivateFirmware completes the device, the
+        // completion frees its slot on the bus
+        deviceUpdaterState.set(DeviceUpdaterSequence::Invalid);
+        updateManager->updateDeviceCompletion(eid, false);
+        co_return PLDM_ERROR;
+    }
+    co_return PLDM_SUCCESS;
+}
+
+requester::Coroutine DeviceUpdater::cancelDeviceUpdate()
+{
+    lg2::error("Package verification failed, cancel the update, EID={EID}",
+               "EID", eid);
+    auto rc = co_await sendCancelUpdateRequest();
+    if (rc)
+    {
+        lg2::error("Error while sending CancelUpdate.");
+    }
+    updateManager->updateDeviceCompletion(eid, false);
+    co_return PLDM_ERROR;
+}
+
+void DeviceUpdater::verificationCompleted(bool passed)
+{
+    if (!heldForVerification)
+    {
+        // the update is still in progress and checks the result once the
+        // components are updated
+        return;
+    }
+    heldForVerification = false;
+
+    verificationRequest = std::make_unique<sdeventplus::source::Defer>(
+        updateManager->event, [this, passed](sdeventplus::source::EventBase&) {
+            if (verificationCoHandle && verificationCoHandle.done())
+            {
+                verificationCoHandle.destroy();
+            }
+            auto co = passed ? completeDeviceUpdate() : cancelDeviceUpdate();
+            verificationCoHandle = co.handle;
+        });
+}
+
 requester::Coroutine DeviceUpdater::sendCancelUpdateRequest()
 {
     deviceUpdaterState.set(DeviceUpdaterSequence::CancelUpdate);
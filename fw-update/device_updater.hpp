@@ -205,6 +205,10 @@ class DeviceUpdater
         {
             deviceUpdaterHandle.destroy();
         }
+        if (verificationCoHandle && verificationCoHandle.done())
+        {
+            verificationCoHandle.destroy();
+        }
         componentUpdaterMap.clear();
     }
 
@@ -308,6 +312,15 @@ class DeviceUpdater
         updateComponentCompletion(const size_t compIndex,
                                   const ComponentUpdateStatus compStatus);
 
+    /** @brief Continue the update held after the last component until the
+     *         package verification running alongside the transfer completed.
+     *         ActivateFirmware is sent if the verification passed, otherwise
+     *         the update is cancelled.
+     *
+     *  @param[in] passed - true if the package verification passed
+     */
+    void verificationCompleted(bool passed);
+
     /** @brief FirmwareDeviceIDRecord in the fw update package that matches this
      *         firmware device
      */
@@ -388,6 +401,21 @@ class DeviceUpdater
     requester::Coroutine processActivateFirmwareResponse(
         mctp_eid_t eid, const pldm_msg* response, size_t respMsgLen);
 
+    /**
+     * @brief Activate the firmware, or wait for the update mode idle timeout
+     *        for a stage only update, once the components are updated
+     *
+     * @return requester::Coroutine
+     */
+    requester::Coroutine completeDeviceUpdate();
+
+    /**
+     * @brief Cancel the update since the package verification failed
+     *
+     * @return requester::Coroutine
+     */
+    requester::Coroutine cancelDeviceUpdate();
+
     /** @brief Endpoint ID of the firmware device */
     mctp_eid_t eid;
 
@@ -462,6 +490,17 @@ class DeviceUpdater
      */
     std::map<ComponentIndex, std::pair<std::unique_ptr<ComponentUpdater>, bool>>
         componentUpdaterMap;
+
+    /** @brief The components are updated and the activation waits for the
+     *         package verification
+     */
+    bool heldForVerification = false;
+
+    /** @brief To continue the update after the verification completed */
+    std::unique_ptr<sdeventplus::source::Defer> verificationRequest;
+
+    /** @brief Coroutine continuing the update after the verification */
+    std::coroutine_handle<> verificationCoHandle;
 };
 
 } // namespace fw_update
@@ -81,7 +81,7 @@ class Manager : public pldm::MctpDiscoveryHandlerIntf
                      std::bind_front(&Manager::createInventory, this),
                      descriptorMap, componentInfoMap, deviceInventoryInfo),
         updateManager(event, handler, requester, descriptorMap,
-                      componentInfoMap, componentNameMap, fwDebug),
+                      componentInfoMap, componentNameMap, mctpBusMap, fwDebug),
         deviceInventoryManager(pldm::utils::DBusHandler::getBus(),
                                deviceInventoryInfo, descriptorMap,
                                dBusHandlerIntf),
@@ -118,6 +118,7 @@ class Manager : public pldm::MctpDiscoveryHandlerIntf
         for (const auto& [eid, uuid, mediumType, networkId, bindingType] :
              mctpInfos)
         {
+            mctpBusMap[eid] = {mediumType, bindingType};
             ComponentIdNameMap componentIdNameMap;
             if (componentNameMapInfo.matchInventoryEntry(mctpInterfaces[uuid],
                                                          componentIdNameMap))
@@ -223,6 +224,9 @@ class Manager : public pldm::MctpDiscoveryHandlerIntf
     /** @brief Component information to create message registries */
     ComponentNameMap componentNameMap;
 
+    /** @brief MCTP medium and binding type of the MCTP endpoints */
+    MctpBusMap mctpBusMap;
+
     /** @brief Device inventory D-Bus object manager */
     device_inventory::Manager deviceInventoryManager;
 
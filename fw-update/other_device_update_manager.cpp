@@ -25,7 +25,10 @@
 #include "update_manager.hpp"
 #include "watch.hpp"
 
+#include <fcntl.h>
 #include <fmt/format.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include <boost/uuid/uuid.hpp>
@@ -37,8 +40,12 @@
 #include <xyz/openbmc_project/Common/error.hpp>
 #include <xyz/openbmc_project/Inventory/Decorator/Asset/server.hpp>
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <map>
 #include <tuple>
 #include <unordered_set>
@@ -53,6 +60,47 @@ namespace fw_update
 
 namespace MatchRules = sdbusplus::bus::match::rules;
 
+bool OtherDeviceUpdateManager::copyPackageRange(int packageFd, off_t offset,
+                                                size_t size, int fd,
+                                                bool useCopyFileRange)
+{
+    while (size > 0)
+    {
+        ssize_t bytes = 0;
+        if (useCopyFileRange)
+        {
+            bytes = copy_file_range(packageFd, &offset, fd, nullptr, size, 0);
+            if (bytes < 0 && (errno == EXDEV || errno == ENOSYS ||
+                              errno == EINVAL || errno == EOPNOTSUPP))
+            {
+                // not supported across these file systems, copy through the
+                // page cache instead
+                useCopyFileRange = false;
+                continue;
+            }
+        }
+        else
+        {
+            bytes = sendfile(fd, packageFd, &offset, size);
+        }
+
+        if (bytes < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (bytes <= 0)
+        {
+            lg2::error("Copying the component image at {OFFSET} failed, "
+                       "{ERROR}",
+                       "OFFSET", offset, "ERROR",
+                       bytes < 0 ? strerror(errno) : "end of package");
+            return false;
+        }
+        size -= bytes;
+    }
+    return true;
+}
+
 Server::Activation::Activations
     OtherDeviceUpdateManager::getOverAllActivationState()
 {
@@ -352,7 +400,7 @@ std::pair<UUID, SKU> OtherDeviceUpdateManager::fetchDescriptorsFromPackage(
 
 TransferPackageState OtherDeviceUpdateManager::txComponentImage(
     const std::string& filePath, const ComponentImageInfo& componentImageInfo,
-    std::istream& package)
+    uintmax_t packageSize)
 {
     // Presence of DeadComponent triggers the Debug Token Install during Update
     // This component needs to be skipped since its handled by
@@ -365,16 +413,9 @@ TransferPackageState OtherDeviceUpdateManager::txComponentImage(
 
     auto compOffset = std::get<5>(componentImageInfo);
     auto compSize = std::get<6>(componentImageInfo);
-    package.seekg(0, std::ios::end);
-    uintmax_t packageSize = package.tellg();
-
-    // An enhancement designed to safeguard the package against
-    // damage in the event of a truncated component. An attempt to
-    // read such a component from the package may lead to an effort
-    // to read a set of bytes beyond the package's boundaries,
-    // triggering the state of the package to be set to
-    // std::ios::failbit. This, in turn, could potentially block the
-    // ability to read other components from the package.
+
+    // A truncated component would be extracted only partially, reject the
+    // package before any of the component images is extracted.
     if (packageSize <
         static_cast<uintmax_t>(compOffset) + static_cast<uintmax_t>(compSize))
     {
@@ -382,24 +423,85 @@ TransferPackageState OtherDeviceUpdateManager::txComponentImage(
         return TransferPackageState::FAILED;
     }
 
-    package.seekg(compOffset); // SEEK to image offset
-    std::vector<uint8_t> buffer(compSize);
-    package.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
-
     const auto& version = std::get<7>(componentImageInfo);
     lg2::info("Extracting {VERSION} to filePath : {FILENAME}", "VERSION",
               version, "FILENAME", filePath);
 
-    std::ofstream outfile(filePath, std::ofstream::binary);
-    outfile.write(reinterpret_cast<const char*>(&buffer[0]),
-                  buffer.size() * sizeof(uint8_t)); // Write to image offset
-    outfile.close();
+    extractions.emplace_back(
+        ComponentImageExtraction{filePath, compOffset, compSize});
     return TransferPackageState::SUCCESS;
 }
 
+bool OtherDeviceUpdateManager::extractComponentImages(int packageFd)
+{
+    auto extract = [packageFd](const ComponentImageExtraction& extraction) {
+        // the ItemUpdater picks up any file closed in its directory, so the
+        // image is written to a temporary file first and renamed to the file
+        // path once it is complete
+        auto tmpPath = extraction.filePath + ".tmp";
+        auto fd = open(tmpPath.c_str(),
+                       O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+        if (fd < 0)
+        {
+            lg2::error("Failed to create {FILENAME}, {ERROR}", "FILENAME",
+                       tmpPath, "ERROR", strerror(errno));
+            return false;
+        }
+
+        bool extracted = copyPackageRange(packageFd, extraction.offset,
+                                          extraction.size, fd);
+        struct stat st;
+        if (extracted && (fstat(fd, &st) < 0 ||
+                          static_cast<uintmax_t>(st.st_size) != extraction.size))
+        {
+            lg2::error("Extracted component image {FILENAME} is incomplete",
+                       "FILENAME", extraction.filePath);
+            extracted = false;
+        }
+        close(fd);
+
+        std::error_code ec;
+        if (extracted)
+        {
+            std::filesystem::rename(tmpPath, extraction.filePath, ec);
+            if (ec)
+            {
+                lg2::error("Failed to rename {TMPNAME} to {FILENAME}, {ERROR}",
+                           "TMPNAME", tmpPath, "FILENAME", extraction.filePath,
+                           "ERROR", ec.message());
+                extracted = false;
+            }
+        }
+        if (!extracted)
+        {
+            std::filesystem::remove(tmpPath, ec);
+        }
+        return extracted;
+    };
+
+    bool extracted = true;
+#ifdef NON_PLDM_PARALLEL_EXTRACTION
+    // the component images are independent of each other
+    std::vector<std::future<bool>> results;
+    for (const auto& extraction : extractions)
+    {
+        results.emplace_back(
+            std::async(std::launch::async, extract, std::cref(extraction)));
+    }
+    for (auto& result : results)
+    {
+        extracted = result.get() && extracted;
+    }
+#else
+    extracted = std::all_of(extractions.begin(), extractions.end(), extract);
+#endif
+    extractions.clear();
+    return extracted;
+}
+
 TransferPackageState OtherDeviceUpdateManager::txSingleComponent(
     const std::string& dirPath, const ComponentImageInfo& componentImageInfo,
-    std::istream& package, const std::string& objPath, const UUID& uuid)
+    uintmax_t packageSize, const std::string& objPath, const UUID& uuid)
 {
     const std::string destinationFilePath =
         dirPath + "/" +
@@ -409,12 +511,13 @@ TransferPackageState OtherDeviceUpdateManager::txSingleComponent(
     const auto& version = std::get<7>(componentImageInfo);
     uuidMappings[uuid] = {version, std::filesystem::path(objPath).filename()};
 
-    return txComponentImage(destinationFilePath, componentImageInfo, package);
+    return txComponentImage(destinationFilePath, componentImageInfo,
+                            packageSize);
 }
 
 TransferPackageState OtherDeviceUpdateManager::txMultipleComponents(
     const std::string& dirPath, const ApplicableComponents& applicableCompVec,
-    const ComponentImageInfos& componentImageInfos, std::istream& package,
+    const ComponentImageInfos& componentImageInfos, uintmax_t packageSize,
     const std::string& objPath, const UUID& uuid)
 {
     for (const auto& component : applicableCompVec)
@@ -427,7 +530,7 @@ TransferPackageState OtherDeviceUpdateManager::txMultipleComponents(
         const std::string destinationDir = dirPath + "/" + compIdString;
 
         const auto transferState = txSingleComponent(
-            destinationDir, componentImageInfo, package, objPath, uuid);
+            destinationDir, componentImageInfo, packageSize, objPath, uuid);
         if (transferState == TransferPackageState::FAILED or
             transferState == TransferPackageState::SKIPPED)
         {
@@ -439,11 +542,24 @@ TransferPackageState OtherDeviceUpdateManager::txMultipleComponents(
 
 size_t OtherDeviceUpdateManager::extractOtherDevicePkgs(
     const FirmwareDeviceIDRecords& fwDeviceIDRecords,
-    const ComponentImageInfos& componentImageInfos, std::istream& package)
+    const ComponentImageInfos& componentImageInfos,
+    const std::filesystem::path& packageFilePath)
 {
 #ifndef NON_PLDM
     return 0;
 #else
+    pldm::utils::CustomFD packageFd(
+        open(packageFilePath.c_str(), O_RDONLY | O_CLOEXEC));
+    struct stat st;
+    if (packageFd() < 0 || fstat(packageFd(), &st) < 0)
+    {
+        lg2::error("Opening the PLDM FW update package {PATH} failed, {ERROR}",
+                   "PATH", packageFilePath, "ERROR", strerror(errno));
+        return 0;
+    }
+    uintmax_t packageSize = st.st_size;
+    extractions.clear();
+
     size_t totalNumImages = 0;
     startWatchingInterfaceAddition();
     for (size_t index = 0; index < fwDeviceIDRecords.size(); ++index)
@@ -490,7 +606,7 @@ size_t OtherDeviceUpdateManager::extractOtherDevicePkgs(
                 componentImageInfos[applicableCompVec[0]];
 
             const auto transferState = txSingleComponent(
-                directoryName, componentImageInfo, package, objPath, uuid);
+                directoryName, componentImageInfo, packageSize, objPath, uuid);
             if (transferState == TransferPackageState::FAILED)
             {
                 return 0;
@@ -503,8 +619,8 @@ size_t OtherDeviceUpdateManager::extractOtherDevicePkgs(
         else
         {
             const auto transferState = txMultipleComponents(
-                directoryName, applicableCompVec, componentImageInfos, package,
-                objPath, uuid);
+                directoryName, applicableCompVec, componentImageInfos,
+                packageSize, objPath, uuid);
             if (transferState == TransferPackageState::FAILED)
             {
                 return 0;
@@ -514,6 +630,11 @@ size_t OtherDeviceUpdateManager::extractOtherDevicePkgs(
         totalNumImages++;
         isImageFileProcessed[uuid] = false;
     }
+
+    if (!extractComponentImages(packageFd()))
+    {
+        return 0;
+    }
     startTimer(totalNumImages * UPDATER_ACTIVATION_WAIT_PER_IMAGE_SEC);
     return totalNumImages;
 #endif
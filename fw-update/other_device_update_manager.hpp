@@ -19,12 +19,18 @@
 #include "common/types.hpp"
 #include "common/utils.hpp"
 
+#include <sys/types.h>
+
 #include <sdbusplus/timer.hpp>
 #include <xyz/openbmc_project/Inventory/Decorator/Asset/server.hpp>
 #include <xyz/openbmc_project/Software/Activation/server.hpp>
 #include <xyz/openbmc_project/Software/ActivationProgress/server.hpp>
 
+#include <cstdint>
+#include <filesystem>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace pldm
 {
@@ -171,13 +177,13 @@ class OtherDeviceUpdateManager
      *
      * @param fwDeviceIDRecords - Device records
      * @param componentImageInfos - Image info like offset, size
-     * @param package - pldm image input stream
+     * @param packageFilePath - path of the pldm image
      * @return size_t - number of other device images
      */
     size_t
         extractOtherDevicePkgs(const FirmwareDeviceIDRecords& fwDeviceIDRecords,
                                const ComponentImageInfos& componentImageInfos,
-                               std::istream& package);
+                               const std::filesystem::path& packageFilePath);
 
     /**
      * @brief Get the Number Of Processed Images object
@@ -265,30 +271,57 @@ class OtherDeviceUpdateManager
         const FirmwareDeviceIDRecord& fwDeviceIDRecord);
 
     /**
-     * @brief Transfers the component image to the location at filepath
+     * @brief Queues the transfer of the component image to the location at
+     *        filepath
      *
      * @param filePath - Path to the destination of the component image
      * @param componentImageInfo - Image info of the component to transfer
-     * @param package - input stream of the package
+     * @param packageSize - size of the package
      */
     TransferPackageState
         txComponentImage(const std::string& filePath,
                          const ComponentImageInfo& componentImageInfo,
-                         std::istream& package);
+                         uintmax_t packageSize);
+
+    /**
+     * @brief Copies the queued component images out of the package
+     *
+     * @param packageFd - file descriptor of the package
+     *
+     * @return true if all the component images are copied
+     */
+    bool extractComponentImages(int packageFd);
+
+    /**
+     * @brief Copy a range of the package to the destination file within the
+     *        kernel, the component image is not read into memory. The file
+     *        system may share the extents instead of copying them.
+     *
+     * @param packageFd - file descriptor of the package
+     * @param offset - offset of the range in the package
+     * @param size - size of the range
+     * @param fd - file descriptor of the destination file
+     * @param useCopyFileRange - try copy_file_range() first, sendfile() is
+     *                           used if false or if it is not supported
+     *
+     * @return true if the whole range is copied
+     */
+    static bool copyPackageRange(int packageFd, off_t offset, size_t size,
+                                 int fd, bool useCopyFileRange = true);
 
     /**
      * @brief Handles the transfers of a single component
      *
      * @param dirPath - Path to the directory destination of the component image
      * @param componentImageInfo - Image info of the component to transfer
-     * @param package - input stream of the package
+     * @param packageSize - size of the package
      * @param objPath - Object Path of the Item Updater
      * @param uuid - UUID of the ItemUpdater
      */
     TransferPackageState
         txSingleComponent(const std::string& dirPath,
                           const ComponentImageInfo& componentImageInfo,
-                          std::istream& package, const std::string& objPath,
+                          uintmax_t packageSize, const std::string& objPath,
                           const UUID& uuid);
 
     /**
@@ -299,7 +332,7 @@ class OtherDeviceUpdateManager
      * @param applicableCompVec - Vector of components to transfer
      * @param componentImageInfos - Vector of Image info of the components to
      * transfer
-     * @param package - input stream of the package
+     * @param packageSize - size of the package
      * @param objPath - Object Path of the Item Updater
      * @param uuid - UUID of the ItemUpdater
      */
@@ -307,7 +340,7 @@ class OtherDeviceUpdateManager
         txMultipleComponents(const std::string& dirPath,
                              const ApplicableComponents& applicableCompVec,
                              const ComponentImageInfos& componentImageInfos,
-                             std::istream& package, const std::string& objPath,
+                             uintmax_t packageSize, const std::string& objPath,
                              const UUID& uuid);
 
     UpdateManager* updateManager;
@@ -370,6 +403,24 @@ class OtherDeviceUpdateManager
      */
     std::unordered_map<std::string, ComponentMap> uuidMappings;
     std::vector<sdbusplus::message::object_path> targets;
+
+    /**
+     * @brief Component image to be copied out of the package
+     *
+     */
+    struct ComponentImageExtraction
+    {
+        std::string filePath;
+        uintmax_t offset;
+        uintmax_t size;
+    };
+
+    /**
+     * @brief Component images queued by txComponentImage, copied once all
+     *        the records of the package are processed
+     *
+     */
+    std::vector<ComponentImageExtraction> extractions;
 };
 
 } // namespace fw_update
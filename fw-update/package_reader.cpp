@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "package_reader.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace pldm
+{
+
+namespace fw_update
+{
+
+PackageReader::PackageReader(const std::filesystem::path& path)
+{
+    auto fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        lg2::error("Opening the PLDM FW update package {PATH} failed, {ERROR}",
+                   "PATH", path, "ERROR", strerror(errno));
+        return;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || st.st_size <= 0)
+    {
+        lg2::error("Invalid size of the PLDM FW update package {PATH}", "PATH",
+                   path);
+        close(fd);
+        return;
+    }
+
+    auto mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED)
+    {
+        lg2::error("Mapping the PLDM FW update package {PATH} failed, {ERROR}",
+                   "PATH", path, "ERROR", strerror(errno));
+        close(fd);
+        return;
+    }
+
+    // the descriptor is kept to check the size of the package before a range
+    // of the mapping is served
+    packageFd = fd;
+    addr = static_cast<uint8_t*>(mapped);
+    length = st.st_size;
+}
+
+PackageReader::~PackageReader()
+{
+    if (addr)
+    {
+        munmap(addr, length);
+    }
+    if (packageFd >= 0)
+    {
+        close(packageFd);
+    }
+}
+
+std::span<const uint8_t> PackageReader::view(size_t offset,
+                                             size_t count) const
+{
+    if (!addr || offset > length || count > length - offset)
+    {
+        return {};
+    }
+
+    // reading a page of the mapping past the end of a truncated package
+    // raises SIGBUS, the caller reads the range from the stream instead
+    struct stat st;
+    if (fstat(packageFd, &st) < 0 ||
+        static_cast<size_t>(st.st_size) < offset + count)
+    {
+        return {};
+    }
+    return {addr + offset, count};
+}
+
+void PackageReader::willNeed(size_t offset, size_t count) const
+{
+    if (!addr || offset >= length)
+    {
+        return;
+    }
+
+    // madvise takes a page aligned address
+    static const size_t pageSize = sysconf(_SC_PAGESIZE);
+    auto start = offset - offset % pageSize;
+    auto end = std::min(length, offset + count);
+    madvise(addr + start, end - start, MADV_WILLNEED);
+}
+
+} // namespace fw_update
+
+} // namespace pldm
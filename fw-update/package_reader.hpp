@@ -0,0 +1,103 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace pldm
+{
+
+namespace fw_update
+{
+
+/** @class PackageReader
+ *
+ *  A read-only memory mapping of the firmware update package, shared by the
+ *  ComponentUpdaters of all the devices being updated. The RequestFirmwareData
+ *  responses are copied straight from the mapping, so concurrent transfers
+ *  neither issue a seek and read per chunk nor contend for a stream position.
+ *
+ *  The package sits in a writable staging directory, a new upload can
+ *  truncate it under the mapping. A range is only served from the mapping
+ *  while the package still covers it, otherwise the caller reads it from the
+ *  package stream. The update flow itself neither rewrites nor removes the
+ *  package before the mapping is released.
+ */
+class PackageReader
+{
+  public:
+    PackageReader() = delete;
+    PackageReader(const PackageReader&) = delete;
+    PackageReader(PackageReader&&) = delete;
+    PackageReader& operator=(const PackageReader&) = delete;
+    PackageReader& operator=(PackageReader&&) = delete;
+
+    /** @brief Map the firmware update package
+     *
+     *  @param[in] path - path of the package
+     */
+    explicit PackageReader(const std::filesystem::path& path);
+
+    ~PackageReader();
+
+    /** @brief Check if the package is mapped */
+    bool valid() const
+    {
+        return addr != nullptr;
+    }
+
+    /** @brief Size of the package in bytes */
+    size_t size() const
+    {
+        return length;
+    }
+
+    /** @brief Get a view of a range of the package
+     *
+     *  @param[in] offset - offset of the range in the package
+     *  @param[in] count - size of the range
+     *
+     *  @return the range, empty if it is not within the package or the
+     *          package file was truncated before it
+     */
+    std::span<const uint8_t> view(size_t offset, size_t count) const;
+
+    /** @brief Advise the kernel to read ahead a range of the package, called
+     *         once per component before its transfer
+     *
+     *  @param[in] offset - offset of the range in the package
+     *  @param[in] count - size of the range
+     */
+    void willNeed(size_t offset, size_t count) const;
+
+  private:
+    /** @brief descriptor of the package, -1 if the package is not mapped */
+    int packageFd = -1;
+
+    /** @brief start of the mapping, nullptr if the package is not mapped */
+    uint8_t* addr = nullptr;
+
+    /** @brief size of the mapping */
+    size_t length = 0;
+};
+
+} // namespace fw_update
+
+} // namespace pldm
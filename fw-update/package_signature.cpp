@@ -24,6 +24,7 @@
 #include <phosphor-logging/lg2.hpp>
 #include <xyz/openbmc_project/Common/error.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -113,70 +114,7 @@ void PackageSignature::verifyAsync(
          onError](std::vector<unsigned char> digestVector) {
             try
             {
-                int verificationErrorCode;
-                bool result = true;
-                EVP_PKEY_CTX* verctx = nullptr;
-                EVP_PKEY* vkey = nullptr;
-                BIGNUM* input = nullptr;
-                BIO* bo = nullptr;
-
-                input = BN_new();
-                std::unique_ptr<BIGNUM, decltype(&::BN_free)> ctxInputPtr{
-                    input, &::BN_free};
-
-                int inputLength = BN_hex2bn(&input, publicKey.c_str());
-                inputLength = (inputLength + 1) / 2;
-
-                std::vector<uint8_t> publicKeyBuffer(inputLength);
-                BN_bn2bin(input, publicKeyBuffer.data());
-
-                bo = BIO_new(BIO_s_mem());
-                std::unique_ptr<BIO, decltype(&::BIO_free)> ctxBoPtr{
-                    bo, &::BIO_free};
-
-                BIO_write(bo, publicKeyBuffer.data(), inputLength);
-                vkey = PEM_read_bio_PUBKEY(bo, &vkey, nullptr, nullptr);
-                std::unique_ptr<EVP_PKEY, decltype(&::EVP_PKEY_free)>
-                    ctxVkeyPtr{vkey, &::EVP_PKEY_free};
-
-                verctx = EVP_PKEY_CTX_new(vkey, nullptr);
-                if (!verctx)
-                {
-                    lg2::error(
-                        "Verifying signature failed, cannot create a verify context");
-                    result = false;
-
-                    onComplete(result);
-                    return;
-                }
-
-                std::unique_ptr<EVP_PKEY_CTX, decltype(&::EVP_PKEY_CTX_free)>
-                    ctxVerctxPtr{verctx, &::EVP_PKEY_CTX_free};
-
-                if (EVP_PKEY_verify_init(verctx) <= 0)
-                {
-                    lg2::error(
-                        "Verifying signature failed, cannot initialize a verify context");
-                    result = false;
-
-                    onComplete(result);
-                    return;
-                }
-
-                verificationErrorCode = EVP_PKEY_verify(
-                    verctx, signature.data(), signature.size(),
-                    digestVector.data(), signatureSha->digestLength);
-
-                if (verificationErrorCode != 1)
-                {
-                    lg2::error(
-                        "Verifying signature failed, EVP_PKEY_verify error {VERIFICATION_ERR_CODE}",
-                        "VERIFICATION_ERR_CODE", verificationErrorCode);
-
-                    result = false;
-                }
-
-                onComplete(result);
+                onComplete(verifyDigest(digestVector, publicKey));
             }
             catch (const std::exception& e)
             {
@@ -189,12 +127,26 @@ void PackageSignature::verifyAsync(
 bool PackageSignature::verify(std::istream& package,
                               const std::string& publicKey,
                               uintmax_t lengthOfSignedData)
+{
+    auto digestVector =
+        signatureSha->calculateDigest(package, lengthOfSignedData);
+
+    return verifyDigest(digestVector, publicKey);
+}
+
+bool PackageSignature::verifyDigest(
+    const std::vector<unsigned char>& digestVector,
+    const std::string& publicKey)
 {
     int verificationErrorCode;
     bool result = true;
 
-    auto digestVector =
-        signatureSha->calculateDigest(package, lengthOfSignedData);
+    if (digestVector.size() != signatureSha->digestLength)
+    {
+        lg2::error("Verifying signature failed, digest size {SIZE} is incorrect",
+                   "SIZE", digestVector.size());
+        return false;
+    }
 
     // Context and key
     EVP_PKEY_CTX* verctx = NULL;
@@ -358,26 +310,14 @@ void PackageSignature::integrityCheckAsync(
 {
     try
     {
-        std::string publicKeyString(publicKeyData.begin(), publicKeyData.end());
-
-        if (publicKeyString.empty())
+        if (publicKeyData.empty())
         {
             onError(
                 "Public key data is empty, unable to perform integrity check.");
             return;
         }
 
-        std::stringstream publicKeyStream;
-
-        publicKeyStream << std::hex << std::setfill('0');
-        for (size_t i = 0; publicKeyString.length() > i; ++i)
-        {
-            publicKeyStream
-                << std::setw(2)
-                << static_cast<unsigned int>(
-                       static_cast<unsigned char>(publicKeyString[i]));
-        }
-        verifyAsync(package, publicKeyStream.str(), lengthOfSignedData,
+        verifyAsync(package, getIntegrityCheckKey(), lengthOfSignedData,
                     onComplete, onError);
     }
     catch (const std::exception& e)
@@ -389,19 +329,59 @@ void PackageSignature::integrityCheckAsync(
 bool PackageSignature::integrityCheck(std::istream& package,
                                       uintmax_t lengthOfSignedData)
 {
-    std::string publicKeyString(publicKeyData.begin(), publicKeyData.end());
+    return verify(package, getIntegrityCheckKey(), lengthOfSignedData);
+}
+
+bool PackageSignature::integrityCheckDigest(
+    const std::vector<unsigned char>& digest)
+{
+    return verifyDigest(digest, getIntegrityCheckKey());
+}
 
+std::string PackageSignature::getIntegrityCheckKey() const
+{
     std::stringstream publicKeyStream;
 
     publicKeyStream << std::hex << std::setfill('0');
-    for (size_t i = 0; publicKeyString.length() > i; ++i)
+    for (auto byte : publicKeyData)
     {
-        publicKeyStream << std::setw(2)
-                        << static_cast<unsigned int>(
-                               static_cast<unsigned char>(publicKeyString[i]));
+        publicKeyStream << std::setw(2) << static_cast<unsigned int>(byte);
     }
 
-    return verify(package, publicKeyStream.str(), lengthOfSignedData);
+    return publicKeyStream.str();
+}
+
+PackageSignatureShaBase::~PackageSignatureShaBase()
+{
+    // the worker uses the members, stop it before they are destroyed
+    if (worker)
+    {
+        worker->cancel();
+        worker->join();
+    }
+}
+
+void PackageSignatureShaBase::processDigest()
+{
+    worker->join();
+
+    std::vector<unsigned char> result;
+    std::string error;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        result.swap(digest);
+        error.swap(errorMsg);
+    }
+
+    // the callbacks may start another calculation
+    auto completeHandler = std::move(onComplete);
+    auto errorHandler = std::move(onError);
+    if (!error.empty())
+    {
+        errorHandler(error);
+        return;
+    }
+    completeHandler(std::move(result));
 }
 
 void PackageSignatureSha384::calculateDigestAsync(
@@ -432,33 +412,45 @@ void PackageSignatureSha384::calculateDigestAsync(
                     digestName);
             return;
         }
-        auto event = sdeventplus::Event::get_default();
-
-        // Initialize all data required to perform digest calculations using
-        // chunks
-        this->package = &package;
-        this->hash = std::make_shared<std::vector<unsigned char>>(digestLength);
-        this->chunkNumber = 0;
-        this->ctxMdctxPtr = ctxMdctxPtr;
-        this->lengthOfSignedData = lengthOfSignedData;
-        this->onComplete = onComplete;
-        this->onError = onError;
 
-        try
+        if (worker && worker->isRunning())
         {
-            this->requestChunkCalculation =
-                std::make_unique<sdeventplus::source::Defer>(
-                    event,
-                    std::bind(&PackageSignatureSha384::handleChunkProcessing,
-                              this, nullptr, this));
+            onError("Digest calculation is already in progress");
+            return;
         }
-        catch (const std::exception& e)
+
+        if (!worker)
         {
-            onError(
-                std::string("Failed to add chunk processing to event loop: ") +
-                e.what());
-            this->requestChunkCalculation.reset();
+            try
+            {
+                auto event = sdeventplus::Event::get_default();
+                worker = std::make_unique<pldm::utils::WorkerThread>(
+                    event, [this]() { processDigest(); });
+            }
+            catch (const std::exception& e)
+            {
+                onError(std::string(
+                            "Failed to add digest handler to event loop: ") +
+                        e.what());
+                return;
+            }
+        }
+        if (!worker->canNotify())
+        {
+            worker.reset();
+            onError("Failed to create eventfd for digest");
+            return;
         }
+
+        // The package is hashed on a worker thread so a large package doesn't
+        // stall the event loop, which also drives the MCTP transfer and the
+        // sensor polling.
+        this->onComplete = std::move(onComplete);
+        this->onError = std::move(onError);
+        worker->start([this, &package, lengthOfSignedData,
+                       ctxMdctxPtr = std::move(ctxMdctxPtr)]() {
+            processChunks(package, lengthOfSignedData, ctxMdctxPtr);
+        });
     }
     else
     {
@@ -482,81 +474,56 @@ void PackageSignatureSha384::calculateDigestAsync(
     }
 }
 
-void PackageSignatureSha384::handleChunkProcessing(sd_event_source* /*source*/,
-                                                   PackageSignatureShaBase* ctx)
+void PackageSignatureShaBase::processChunks(
+    std::istream& package, uintmax_t lengthOfSignedData,
+    std::shared_ptr<EVP_MD_CTX> ctxMdctxPtr)
 {
-    try
-    {
-        uintmax_t processedLength = this->chunkNumber * chunkSize;
-
-        if (processedLength >= this->lengthOfSignedData)
-        {
-            unsigned int mdLength = 0;
-            if (!EVP_DigestFinal(this->ctxMdctxPtr.get(), this->hash->data(),
-                                 &mdLength))
-            {
-                lg2::error("Error in EVP_DigestFinal");
-                this->onError("Failed to finalize the digest");
-                this->requestChunkCalculation.reset();
-                return;
-            }
-
-            this->onComplete(*this->hash);
-            this->requestChunkCalculation.reset();
-            return;
-        }
-
-        size_t currentChunkSize;
+    std::vector<unsigned char> hash(digestLength);
+    std::string error;
+    std::vector<uint8_t> buffer(chunkSize, 0);
+    uintmax_t processedLength = 0;
 
-        if ((this->lengthOfSignedData - processedLength) < chunkSize)
-        {
-            currentChunkSize = this->lengthOfSignedData - processedLength;
-        }
-        else
+    while (processedLength < lengthOfSignedData && !worker->isCancelled())
+    {
+        size_t currentChunkSize = static_cast<size_t>(
+            std::min<uintmax_t>(lengthOfSignedData - processedLength,
+                                chunkSize));
+        package.read(reinterpret_cast<char*>(buffer.data()), currentChunkSize);
+        if (!package)
         {
-            currentChunkSize = chunkSize;
+            error = "Failed to read the package to calculate the digest";
+            break;
         }
 
-        std::vector<uint8_t> buffer(currentChunkSize, 0);
-        this->package->read(reinterpret_cast<char*>(buffer.data()),
-                            buffer.size());
-
-        if (!EVP_DigestUpdate(this->ctxMdctxPtr.get(), buffer.data(),
+        if (!EVP_DigestUpdate(ctxMdctxPtr.get(), buffer.data(),
                               currentChunkSize))
         {
-            this->onError("Failed to update the digest with current chunk");
-            return;
+            error = "Failed to update the digest with current chunk";
+            break;
         }
+        processedLength += currentChunkSize;
+    }
 
-        this->chunkNumber++;
-
-        auto event = sdeventplus::Event::get_default();
+    if (worker->isCancelled())
+    {
+        return;
+    }
 
-        try
-        {
-            this->requestChunkCalculation =
-                std::make_unique<sdeventplus::source::Defer>(
-                    event,
-                    std::bind(&PackageSignatureSha384::handleChunkProcessing,
-                              this, nullptr, ctx));
-        }
-        catch (const std::exception& e)
-        {
-            lg2::error("Failed to re-add chunk processing: {ERR}", "ERR",
-                       e.what());
-            this->onError(
-                "Failed to re-add chunk processing to the event loop");
-            this->requestChunkCalculation.reset();
-        }
+    unsigned int mdLength = 0;
+    if (error.empty() &&
+        !EVP_DigestFinal(ctxMdctxPtr.get(), hash.data(), &mdLength))
+    {
+        lg2::error("Error in EVP_DigestFinal");
+        error = "Failed to finalize the digest";
     }
-    catch (const std::exception& e)
+
     {
-        this->onError(
-            std::string("Exception occurred during chunk processing: ") +
-            e.what());
-        this->requestChunkCalculation.reset();
-        return;
+        std::lock_guard<std::mutex> lock(mutex);
+        digest = std::move(hash);
+        errorMsg = std::move(error);
     }
+
+    worker->notify();
 }
 
 std::vector<unsigned char>
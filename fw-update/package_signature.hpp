@@ -21,6 +21,7 @@
 
 #include "common/types.hpp"
 #include "common/utils.hpp"
+#include "common/worker_thread.hpp"
 
 #include <openssl/evp.h>
 #include <openssl/sha.h>
@@ -32,6 +33,7 @@
 #include <array>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -83,15 +85,23 @@ struct PackageSignatureShaBase
     PackageSignatureShaBase() = default;
     PackageSignatureShaBase(const PackageSignatureShaBase&) = delete;
     PackageSignatureShaBase& operator=(const PackageSignatureShaBase&) = delete;
-    PackageSignatureShaBase(PackageSignatureShaBase&&) = default;
-    PackageSignatureShaBase& operator=(PackageSignatureShaBase&&) = default;
-    virtual ~PackageSignatureShaBase() = default;
+    PackageSignatureShaBase(PackageSignatureShaBase&&) = delete;
+    PackageSignatureShaBase& operator=(PackageSignatureShaBase&&) = delete;
+
+    /** @brief Stop the digest worker thread if it is running */
+    virtual ~PackageSignatureShaBase();
 
     size_t minimumSignatureSize;
     size_t maximumSignatureSize;
     size_t digestLength;
     bool useChunks = true;
 
+    /** @brief Get the OpenSSL name of the digest algorithm */
+    const std::string& getDigestName() const
+    {
+        return digestName;
+    }
+
     /** @brief Calculate digest bases on concrete SHA algorithm.
      *
      *  @param[in] package - package to generate digest
@@ -107,7 +117,9 @@ struct PackageSignatureShaBase
      * algorithm.
      *
      *  This function performs the digest calculation asynchronously, allowing
-     *  for non-blocking operations.
+     *  for non-blocking operations. With useChunks the package is hashed on a
+     *  worker thread, the package stream must not be used by the caller until
+     *  one of the callbacks is invoked on the event loop.
      *
      *  @param[in] package - package to generate digest
      *  @param[in] lengthOfSignedData - size of the signed part of the package
@@ -124,16 +136,30 @@ struct PackageSignatureShaBase
   protected:
     std::string digestName;
     size_t chunkSize = CALCULATE_DIGEST_CHUNK_SIZE;
-    std::istream* package;
-    std::shared_ptr<std::vector<unsigned char>> hash;
-    int chunkNumber;
-    std::shared_ptr<EVP_MD_CTX> ctxMdctxPtr;
-    uintmax_t lengthOfSignedData;
     std::function<void(std::vector<unsigned char>)> onComplete;
     std::function<void(const std::string& errorMsg)> onError;
 
-    /** @brief To send a request to handle chunk calculation */
-    std::unique_ptr<sdeventplus::source::Defer> requestChunkCalculation;
+    /** @brief Guards the result handed from the worker to the event loop */
+    std::mutex mutex;
+    std::vector<unsigned char> digest;
+    std::string errorMsg;
+
+    /** @brief Worker thread calculating the digest, created on first use */
+    std::unique_ptr<pldm::utils::WorkerThread> worker;
+
+    /** @brief Join the worker and invoke the callback with its result, run
+     *         on the event loop when the worker notifies
+     */
+    void processDigest();
+
+    /** @brief Hash the package in chunks, run on the worker thread
+     *
+     *  @param[in] package - package to generate digest
+     *  @param[in] lengthOfSignedData - size of signed part of package
+     *  @param[in] ctxMdctxPtr - initialized digest context
+     */
+    void processChunks(std::istream& package, uintmax_t lengthOfSignedData,
+                       std::shared_ptr<EVP_MD_CTX> ctxMdctxPtr);
 };
 
 /** @struct PackageSignatureSha384
@@ -161,9 +187,6 @@ struct PackageSignatureSha384 : public PackageSignatureShaBase
         std::istream& package, uintmax_t lengthOfSignedData,
         std::function<void(std::vector<unsigned char>)> onComplete,
         std::function<void(const std::string& errorMsg)> onError) override;
-
-    void handleChunkProcessing(sd_event_source* source,
-                               PackageSignatureShaBase* ctx);
 };
 
 /** @class PackageSignature
@@ -204,6 +227,17 @@ class PackageSignature
     virtual bool verify(std::istream& package, const std::string& publicKey,
                         uintmax_t lengthOfSignedData);
 
+    /** @brief Verify the signature against the digest of the signed part of
+     *         the package, calculated while the package was written
+     *
+     *  @param[in] digest - digest of the signed part of the package
+     *  @param[in] publicKey - Public Key
+     *
+     *  @return true if signature verification was successful, false if not
+     */
+    bool verifyDigest(const std::vector<unsigned char>& digest,
+                      const std::string& publicKey);
+
     /** @brief Asynchronous package signature verification function.
      *
      *  This function performs the signature verification asynchronously,
@@ -238,6 +272,16 @@ class PackageSignature
     virtual bool integrityCheck(std::istream& package,
                                 uintmax_t lengthOfSignedData);
 
+    /** @brief Integrity check against the digest of the signed part of the
+     *         package, using the public key stored in the Package Signature
+     *         Header
+     *
+     *  @param[in] digest - digest of the signed part of the package
+     *
+     *  @return true if integrity check was successful, false if not
+     */
+    bool integrityCheckDigest(const std::vector<unsigned char>& digest);
+
     /** @brief Asynchronous package signature integrity check function.
      *
      *  This function performs an integrity check on a package asynchronously.
@@ -289,6 +333,13 @@ class PackageSignature
         return signature;
     }
 
+    /** @brief Get the OpenSSL name of the digest algorithm of the signature
+     */
+    const std::string& getDigestName() const
+    {
+        return signatureSha->getDigestName();
+    }
+
     /** @brief Get Package Signature Header
      *
      *  @param[in] package - package with signature part
@@ -320,6 +371,11 @@ class PackageSignature
         createPackageSignatureParser(std::vector<uint8_t>& pkgSignData);
 
   protected:
+    /** @brief Get the public key stored in the Package Signature Header as a
+     *         hex string
+     */
+    std::string getIntegrityCheckKey() const;
+
     /** @brief SHA hash */
     std::unique_ptr<PackageSignatureShaBase> signatureSha;
 
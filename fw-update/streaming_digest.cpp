@@ -0,0 +1,216 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "config.h"
+
+#include "streaming_digest.hpp"
+
+#include "libpldm/firmware_update.h"
+
+#include "package_signature.hpp"
+
+#include <endian.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace pldm
+{
+
+namespace fw_update
+{
+
+StreamingDigest::StreamingDigest(const std::filesystem::path& path,
+                                 const std::string& digestName) :
+    digestName(digestName),
+    ctx(EVP_MD_CTX_new(), &::EVP_MD_CTX_free)
+{
+    const EVP_MD* md = EVP_get_digestbyname(digestName.c_str());
+    if (!md || !ctx || EVP_DigestInit_ex(ctx.get(), md, nullptr) != 1)
+    {
+        lg2::error("Initializing the {DIGEST} digest for {PATH} failed",
+                   "DIGEST", digestName, "PATH", path);
+        return;
+    }
+
+    fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        lg2::error("Opening the PLDM FW update package {PATH} failed, {ERROR}",
+                   "PATH", path, "ERROR", strerror(errno));
+    }
+}
+
+StreamingDigest::~StreamingDigest()
+{
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+}
+
+bool StreamingDigest::update()
+{
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || static_cast<uintmax_t>(st.st_size) < size)
+    {
+        // the data hashed so far is gone, the package is read back once it
+        // is closed instead
+        lg2::error("PLDM FW update package is truncated while it is written");
+        close(fd);
+        fd = -1;
+        return false;
+    }
+    size = st.st_size;
+    mtime = st.st_mtim;
+
+    readHeader();
+
+    // the Package Signature Header at the end of the package is not signed,
+    // hold it back until the size of the signed data is known
+    auto end = size > pldmFwupSignaturePackageSize
+                   ? size - pldmFwupSignaturePackageSize
+                   : 0;
+    if (end > hashedLength)
+    {
+        if (!hash(ctx.get(), hashedLength, end))
+        {
+            close(fd);
+            fd = -1;
+            return false;
+        }
+        hashedLength = end;
+    }
+    return true;
+}
+
+bool StreamingDigest::matches(const std::filesystem::path& path) const
+{
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat pathSt;
+    struct stat fdSt;
+    if (stat(path.c_str(), &pathSt) < 0 || fstat(fd, &fdSt) < 0)
+    {
+        return false;
+    }
+
+    return pathSt.st_dev == fdSt.st_dev && pathSt.st_ino == fdSt.st_ino &&
+           static_cast<uintmax_t>(fdSt.st_size) == size &&
+           fdSt.st_mtim.tv_sec == mtime.tv_sec &&
+           fdSt.st_mtim.tv_nsec == mtime.tv_nsec;
+}
+
+std::optional<std::vector<unsigned char>>
+    StreamingDigest::digest(uintmax_t length)
+{
+    if (fd < 0 || length < hashedLength || length > size)
+    {
+        return std::nullopt;
+    }
+
+    // the signed data ends within the held back part, hash it on a copy so
+    // that the digest can be calculated for another length
+    std::unique_ptr<EVP_MD_CTX, decltype(&::EVP_MD_CTX_free)> tail(
+        EVP_MD_CTX_new(), &::EVP_MD_CTX_free);
+    if (!tail || EVP_MD_CTX_copy_ex(tail.get(), ctx.get()) != 1 ||
+        !hash(tail.get(), hashedLength, length))
+    {
+        return std::nullopt;
+    }
+
+    std::vector<unsigned char> digestVector(EVP_MAX_MD_SIZE);
+    unsigned int digestLength = 0;
+    if (EVP_DigestFinal_ex(tail.get(), digestVector.data(), &digestLength) !=
+        1)
+    {
+        return std::nullopt;
+    }
+    digestVector.resize(digestLength);
+
+    return digestVector;
+}
+
+void StreamingDigest::readHeader()
+{
+    if (!headerSize && size >= sizeof(pldm_package_header_information))
+    {
+        pldm_package_header_information headerInfo;
+        if (pread(fd, &headerInfo, sizeof(headerInfo), 0) !=
+            static_cast<ssize_t>(sizeof(headerInfo)))
+        {
+            return;
+        }
+        headerSize = std::max<size_t>(le16toh(headerInfo.package_header_size),
+                                      sizeof(headerInfo));
+    }
+
+    if (headerSize && header.empty() && size >= headerSize)
+    {
+        std::vector<uint8_t> data(headerSize);
+        if (pread(fd, data.data(), data.size(), 0) ==
+            static_cast<ssize_t>(data.size()))
+        {
+            header = std::move(data);
+        }
+    }
+}
+
+bool StreamingDigest::hash(EVP_MD_CTX* digestCtx, uintmax_t offset,
+                           uintmax_t end) const
+{
+    std::vector<uint8_t> buffer(
+        std::min<uintmax_t>(CALCULATE_DIGEST_CHUNK_SIZE, end - offset));
+    while (offset < end)
+    {
+        auto count = std::min<uintmax_t>(buffer.size(), end - offset);
+        auto bytes = pread(fd, buffer.data(), count, offset);
+        if (bytes <= 0)
+        {
+            lg2::error(
+                "Reading the PLDM FW update package at {OFFSET} failed, {ERROR}",
+                "OFFSET", offset, "ERROR",
+                bytes < 0 ? strerror(errno) : "end of file");
+            return false;
+        }
+        if (EVP_DigestUpdate(digestCtx, buffer.data(), bytes) != 1)
+        {
+            lg2::error("Updating the {DIGEST} digest failed", "DIGEST",
+                       digestName);
+            return false;
+        }
+        offset += bytes;
+    }
+    return true;
+}
+
+} // namespace fw_update
+
+} // namespace pldm
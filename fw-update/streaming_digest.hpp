@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <openssl/evp.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace pldm
+{
+
+namespace fw_update
+{
+
+/** @class StreamingDigest
+ *
+ *  Hashes the firmware update package incrementally while it is written to
+ *  the staging directory, driven by the IN_MODIFY events of the directory
+ *  watch. The package signature covers the package up to the Package
+ *  Signature Header at its end, so the last pldmFwupSignaturePackageSize
+ *  bytes are hashed only once the size of the signed data is known. The
+ *  package header is kept as well, so neither has to be read back from the
+ *  file once it is closed. The package is expected to be written
+ *  sequentially, data rewritten below the hashed length is not detected.
+ */
+class StreamingDigest
+{
+  public:
+    StreamingDigest() = delete;
+    StreamingDigest(const StreamingDigest&) = delete;
+    StreamingDigest(StreamingDigest&&) = delete;
+    StreamingDigest& operator=(const StreamingDigest&) = delete;
+    StreamingDigest& operator=(StreamingDigest&&) = delete;
+
+    /** @brief Open the package being written
+     *
+     *  @param[in] path - path of the package
+     *  @param[in] digestName - OpenSSL name of the digest algorithm
+     */
+    StreamingDigest(const std::filesystem::path& path,
+                    const std::string& digestName);
+
+    ~StreamingDigest();
+
+    /** @brief Hash the data written since the last update
+     *
+     *  @return false if the package can't be hashed, e.g. it was truncated
+     */
+    bool update();
+
+    /** @brief Check if the digest and the header are of the package at path,
+     *         i.e. the same file which is not modified since the last update
+     *
+     *  @param[in] path - path of the package
+     */
+    bool matches(const std::filesystem::path& path) const;
+
+    /** @brief Get the digest of the beginning of the package
+     *
+     *  @param[in] length - size of the signed data
+     *
+     *  @return the digest, std::nullopt if the package is not hashed up to
+     *          the length
+     */
+    std::optional<std::vector<unsigned char>> digest(uintmax_t length);
+
+    /** @brief Get the package header, empty until it is written */
+    const std::vector<uint8_t>& getHeader() const
+    {
+        return header;
+    }
+
+    /** @brief Get the OpenSSL name of the digest algorithm */
+    const std::string& getDigestName() const
+    {
+        return digestName;
+    }
+
+  private:
+    /** @brief Keep the package header once it is written */
+    void readHeader();
+
+    /** @brief Hash the package up to the end
+     *
+     *  @param[in] digestCtx - digest context
+     *  @param[in] offset - offset to start hashing from
+     *  @param[in] end - offset to hash up to
+     *
+     *  @return false if reading the package failed
+     */
+    bool hash(EVP_MD_CTX* digestCtx, uintmax_t offset, uintmax_t end) const;
+
+    std::string digestName;
+
+    /** @brief descriptor of the package, -1 if it can't be hashed */
+    int fd = -1;
+
+    std::unique_ptr<EVP_MD_CTX, decltype(&::EVP_MD_CTX_free)> ctx;
+
+    /** @brief size of the package hashed into ctx */
+    uintmax_t hashedLength = 0;
+
+    /** @brief size of the package at the last update */
+    uintmax_t size = 0;
+
+    /** @brief modification time of the package at the last update */
+    struct timespec mtime = {};
+
+    /** @brief size of the package header, 0 until the header information is
+     *         written
+     */
+    size_t headerSize = 0;
+
+    std::vector<uint8_t> header;
+};
+
+} // namespace fw_update
+
+} // namespace pldm
@@ -48,7 +48,7 @@ class ComponentUpdaterTest : public testing::Test
         reqHandler(event, dbusImplRequester, sockManager, false,
                    std::chrono::seconds(1), 2, std::chrono::milliseconds(100)),
         updateManager(event, reqHandler, dbusImplRequester, descriptorMap,
-                      componentInfoMap, componentNameMap, true),
+                      componentInfoMap, componentNameMap, mctpBusMap, true),
         deviceUpdater(0, package, fwDeviceIDRecord, compImageInfos, compInfo,
                       compIdNameInfo, 512, &updateManager, false)
     {
@@ -83,6 +83,7 @@ class ComponentUpdaterTest : public testing::Test
     DescriptorMap descriptorMap;
     ComponentInfoMap componentInfoMap;
     ComponentNameMap componentNameMap;
+    MctpBusMap mctpBusMap;
     UpdateManager updateManager;
     DeviceUpdater deviceUpdater;
 };
@@ -165,6 +166,69 @@ TEST_F(ComponentUpdaterTest, ReadPackage512B)
     EXPECT_EQ(response, compFirst512B);
 }
 
+TEST_F(ComponentUpdaterTest, ReadMappedPackage)
+{
+    mctp_eid_t eid = 0;
+    size_t componentOffset = 0;
+    ComponentUpdater componentUpdater(eid, package, fwDeviceIDRecord,
+                                      compImageInfos, compInfo, compIdNameInfo,
+                                      512, &updateManager, &deviceUpdater,
+                                      componentOffset, false);
+
+    // offset 0x200 and length 0x200 of the 1024 bytes component
+    constexpr std::array<uint8_t, sizeof(pldm_msg_hdr) +
+                                      sizeof(pldm_request_firmware_data_req)>
+        reqFwDataReq{0x8A, 0x05, 0x15, 0x00, 0x02, 0x00,
+                     0x00, 0x00, 0x02, 0x00, 0x00};
+    auto requestMsg = reinterpret_cast<const pldm_msg*>(reqFwDataReq.data());
+    componentUpdater.componentUpdaterState.set(
+        ComponentUpdaterSequence::RequestFirmwareData);
+    auto streamResponse = componentUpdater.requestFwData(
+        requestMsg, sizeof(pldm_request_firmware_data_req));
+
+    // the same data is served from the mapping of the package
+    updateManager.mapPackage("./test_pkg");
+    ASSERT_NE(nullptr, updateManager.getPackageReader());
+    componentUpdater.componentUpdaterState.set(
+        ComponentUpdaterSequence::RequestFirmwareData);
+    auto mappedResponse = componentUpdater.requestFwData(
+        requestMsg, sizeof(pldm_request_firmware_data_req));
+    EXPECT_EQ(sizeof(pldm_msg_hdr) + 1 + 512, mappedResponse.size());
+    EXPECT_EQ(streamResponse, mappedResponse);
+
+    updateManager.closePackage();
+    EXPECT_EQ(nullptr, updateManager.getPackageReader());
+}
+
+TEST_F(ComponentUpdaterTest, VerificationFailedDuringTransfer)
+{
+    mctp_eid_t eid = 0;
+    size_t componentOffset = 0;
+    ComponentUpdater componentUpdater(eid, package, fwDeviceIDRecord,
+                                      compImageInfos, compInfo, compIdNameInfo,
+                                      512, &updateManager, &deviceUpdater,
+                                      componentOffset, false);
+
+    constexpr std::array<uint8_t, sizeof(pldm_msg_hdr) +
+                                      sizeof(pldm_request_firmware_data_req)>
+        reqFwDataReq{0x8A, 0x05, 0x15, 0x00, 0x00, 0x00,
+                     0x00, 0x00, 0x02, 0x00, 0x00};
+    auto requestMsg = reinterpret_cast<const pldm_msg*>(reqFwDataReq.data());
+
+    // the package verification failed while the component is transferred
+    updateManager.verificationCompleted(false);
+    EXPECT_FALSE(updateManager.isVerificationPending());
+    EXPECT_TRUE(updateManager.isVerificationFailed());
+
+    componentUpdater.componentUpdaterState.set(
+        ComponentUpdaterSequence::RequestFirmwareData);
+    auto response = componentUpdater.requestFwData(
+        requestMsg, sizeof(pldm_request_firmware_data_req));
+    const std::vector<uint8_t> cancelPending{0x0A, 0x05, 0x15,
+                                             PLDM_FWUP_CANCEL_PENDING};
+    EXPECT_EQ(cancelPending, response);
+}
+
 TEST_F(ComponentUpdaterTest, sendUpdateComponentRequest)
 {
     mctp_eid_t eid = 0;
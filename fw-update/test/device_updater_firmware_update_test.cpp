@@ -47,7 +47,7 @@ class DeviceUpdaterTestWithMockedFirmwareUpdateFunctions : public testing::Test
         reqHandler(event, dbusImplRequester, sockManager, false,
                    std::chrono::seconds(1), 2, std::chrono::milliseconds(100)),
         updateManager(event, reqHandler, dbusImplRequester, descriptorMap,
-                      componentInfoMap, componentNameMap, true)
+                      componentInfoMap, componentNameMap, mctpBusMap, true)
     {
         fwDeviceIDRecord = {
             1,
@@ -92,6 +92,7 @@ class DeviceUpdaterTestWithMockedFirmwareUpdateFunctions : public testing::Test
     DescriptorMap descriptorMap;
     ComponentInfoMap componentInfoMap;
     ComponentNameMap componentNameMap;
+    MctpBusMap mctpBusMap;
     UpdateManager updateManager;
 };
 
@@ -358,6 +359,8 @@ TEST_F(DeviceUpdaterTestWithMockedFirmwareUpdateFunctions,
         componentUpdater.processUpdateComponentResponse(
             eid, requestMsg, sizeof(struct pldm_update_component_resp));
     });
+    // the component is completed as failed, so is the device
+    EXPECT_NE(nullptr, componentUpdater.pldmRequest);
 }
 
 TEST_F(DeviceUpdaterTestWithMockedFirmwareUpdateFunctions,
@@ -453,4 +456,5 @@ TEST_F(DeviceUpdaterTestWithMockedFirmwareUpdateFunctions,
 
     EXPECT_NO_THROW(
         { componentUpdater.sendUpdateComponentRequest(componentOffset); });
+    EXPECT_NE(nullptr, componentUpdater.pldmRequest);
 }
\ No newline at end of file
@@ -25,6 +25,8 @@
 #include "pldmd/dbus_impl_requester.hpp"
 #include "requester/handler.hpp"
 
+#include <systemd/sd-event.h>
+
 #include <sdbusplus/bus.hpp>
 #include <sdbusplus/test/sdbus_mock.hpp>
 #include <sdeventplus/test/sdevent.hpp>
@@ -47,7 +49,7 @@ class DeviceUpdaterTest : public testing::Test
         reqHandler(event, dbusImplRequester, sockManager, false,
                    std::chrono::seconds(1), 2, std::chrono::milliseconds(100)),
         updateManager(event, reqHandler, dbusImplRequester, descriptorMap,
-                      componentInfoMap, componentNameMap, true)
+                      componentInfoMap, componentNameMap, mctpBusMap, true)
     {
         fwDeviceIDRecord = {
             1,
@@ -80,6 +82,7 @@ class DeviceUpdaterTest : public testing::Test
     DescriptorMap descriptorMap;
     ComponentInfoMap componentInfoMap;
     ComponentNameMap componentNameMap;
+    MctpBusMap mctpBusMap;
     UpdateManager updateManager;
 };
 
@@ -395,4 +398,65 @@ TEST_F(DeviceUpdaterTest, updateComponentCompletion)
         deviceUpdater.updateComponentCompletion(
             0, ComponentUpdateStatus::UpdateFailed);
     });
-}
\ No newline at end of file
+}
+
+TEST_F(DeviceUpdaterTest, holdActivationUntilVerificationFailed)
+{
+    mctp_eid_t eid = 0;
+    size_t componentOffset = 0;
+
+    // the completion looks up the component names in the parsed package
+    uintmax_t packageSize = package.tellg();
+    std::vector<uint8_t> packageHeader(sizeof(pldm_package_header_information));
+    package.seekg(0);
+    package.read(reinterpret_cast<char*>(packageHeader.data()),
+                 packageHeader.size());
+    auto pkgHeaderInfo =
+        reinterpret_cast<const pldm_package_header_information*>(
+            packageHeader.data());
+    packageHeader.resize(sizeof(pldm_package_header_information) +
+                         pkgHeaderInfo->package_version_string_length);
+    package.seekg(0);
+    package.read(reinterpret_cast<char*>(packageHeader.data()),
+                 packageHeader.size());
+    updateManager.parser = parsePkgHeader(packageHeader);
+    ASSERT_NE(nullptr, updateManager.parser);
+    packageHeader.resize(updateManager.parser->pkgHeaderSize);
+    package.seekg(0);
+    package.read(reinterpret_cast<char*>(packageHeader.data()),
+                 packageHeader.size());
+    updateManager.parser->parse(packageHeader, packageSize);
+
+    updateManager.deviceUpdaterMap.emplace(
+        eid, std::make_unique<DeviceUpdater>(
+                 eid, package, fwDeviceIDRecord, compImageInfos, compInfo,
+                 compIdNameInfo, 512, &updateManager, false));
+    auto& deviceUpdater = *updateManager.deviceUpdaterMap[eid];
+    std::unique_ptr<ComponentUpdater> compUpdater =
+        std::make_unique<ComponentUpdater>(
+            eid, package, fwDeviceIDRecord, compImageInfos, compInfo,
+            compIdNameInfo, 512, &updateManager, &deviceUpdater,
+            componentOffset, false);
+    deviceUpdater.componentUpdaterMap.emplace(
+        componentOffset, std::make_pair(std::move(compUpdater), false));
+
+    // the last component is updated while the package is being verified,
+    // ActivateFirmware is held
+    updateManager.verificationPending = true;
+    deviceUpdater.updateComponentCompletion(
+        0, ComponentUpdateStatus::UpdateComplete);
+    EXPECT_TRUE(deviceUpdater.heldForVerification);
+    EXPECT_EQ(DeviceUpdaterSequence::RequestUpdate,
+              deviceUpdater.deviceUpdaterState.current);
+    EXPECT_FALSE(updateManager.deviceUpdateCompletionMap.contains(eid));
+
+    // the failed verification sends CancelUpdate on the next iteration
+    // instead of ActivateFirmware
+    updateManager.verificationCompleted(false);
+    EXPECT_FALSE(deviceUpdater.heldForVerification);
+    EXPECT_EQ(DeviceUpdaterSequence::RequestUpdate,
+              deviceUpdater.deviceUpdaterState.current);
+    sd_event_run(event.get(), 0);
+    EXPECT_EQ(DeviceUpdaterSequence::CancelUpdate,
+              deviceUpdater.deviceUpdaterState.current);
+}
@@ -14,9 +14,11 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#define private public
 #include "fw-update/activation.hpp"
 #include "fw-update/other_device_update_manager.hpp"
 
+#include <fcntl.h>
 #include <stddef.h>
 #include <systemd/sd-bus.h>
 #include <systemd/sd-event.h>
@@ -27,6 +29,10 @@
 #include <sdbusplus/sdbus.hpp>
 #include <sdbusplus/test/sdbus_mock.hpp>
 
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
 #include <gtest/gtest.h>
 
 using namespace pldm;
@@ -43,8 +49,23 @@ class OtherDeviceUpdateManagerTest : public testing::Test
         reqHandler(event, dbusImplRequester, sockManager, false,
                    std::chrono::seconds(1), 2, std::chrono::milliseconds(100)),
         updateManager(event, reqHandler, dbusImplRequester, descriptorMap,
-                      componentInfoMap, componentNameMap, true)
-    {}
+                      componentInfoMap, componentNameMap, mctpBusMap, true)
+    {
+        char tmpl[] = "/tmp/other_device_update_manager_test.XXXXXX";
+        imageDir = mkdtemp(tmpl);
+    }
+
+    ~OtherDeviceUpdateManagerTest()
+    {
+        std::filesystem::remove_all(imageDir);
+    }
+
+    static std::vector<uint8_t> readFile(const std::filesystem::path& path)
+    {
+        std::ifstream stream(path, std::ios::in | std::ios::binary);
+        return {std::istreambuf_iterator<char>(stream),
+                std::istreambuf_iterator<char>()};
+    }
 
     testing::NiceMock<sdbusplus::SdBusMock> sdbusMock;
     sdbusplus::bus::bus busMock;
@@ -56,7 +77,9 @@ class OtherDeviceUpdateManagerTest : public testing::Test
     DescriptorMap descriptorMap;
     ComponentInfoMap componentInfoMap;
     ComponentNameMap componentNameMap;
+    MctpBusMap mctpBusMap;
     UpdateManager updateManager;
+    std::filesystem::path imageDir;
 };
 
 TEST_F(OtherDeviceUpdateManagerTest, activate)
@@ -149,10 +172,94 @@ TEST_F(OtherDeviceUpdateManagerTest, extractOtherDevicePkgs)
     ComponentImageInfos compImageInfos{
         {10, 100, 0xFFFFFFFF, 0, 0, 139, 27, "VersionString2"}};
 
-    std::istringstream dummyStream("10 20 30 40");
-
     size_t result = otherDeviceUpdateManager.extractOtherDevicePkgs(
-        fwDeviceIDRecords, compImageInfos, dummyStream);
+        fwDeviceIDRecords, compImageInfos, "./test_pkg");
 
     EXPECT_EQ(result, expectedResult);
 }
+
+TEST_F(OtherDeviceUpdateManagerTest, extractComponentImage)
+{
+    OtherDeviceUpdateManager otherDeviceUpdateManager(busMock, &updateManager,
+                                                      updatePolicy.targets());
+
+    const auto packageData = readFile("./test_pkg");
+    ASSERT_EQ(1163, packageData.size());
+    constexpr uint32_t compOffset = 139;
+    constexpr uint32_t compSize = 1024;
+    ComponentImageInfo compImageInfo{
+        10, 100, 0xFFFFFFFF, 0, 0, compOffset, compSize, "VersionString3"};
+
+    const auto filePath = imageDir / "image";
+    EXPECT_EQ(TransferPackageState::SUCCESS,
+              otherDeviceUpdateManager.txComponentImage(
+                  filePath, compImageInfo, packageData.size()));
+    // the image is copied once all the records are checked
+    EXPECT_FALSE(std::filesystem::exists(filePath));
+
+    pldm::utils::CustomFD packageFd(open("./test_pkg", O_RDONLY | O_CLOEXEC));
+    ASSERT_GE(packageFd(), 0);
+    EXPECT_TRUE(otherDeviceUpdateManager.extractComponentImages(packageFd()));
+    EXPECT_TRUE(otherDeviceUpdateManager.extractions.empty());
+
+    const std::vector<uint8_t> expected(packageData.begin() + compOffset,
+                                        packageData.begin() + compOffset +
+                                            compSize);
+    EXPECT_EQ(expected, readFile(filePath));
+    // the image is written to a temporary file and renamed once complete
+    auto tmpPath = filePath;
+    tmpPath += ".tmp";
+    EXPECT_FALSE(std::filesystem::exists(tmpPath));
+}
+
+TEST_F(OtherDeviceUpdateManagerTest, rejectTruncatedComponentImage)
+{
+    OtherDeviceUpdateManager otherDeviceUpdateManager(busMock, &updateManager,
+                                                      updatePolicy.targets());
+
+    // the component runs one byte past the end of the package
+    ComponentImageInfo compImageInfo{
+        10, 100, 0xFFFFFFFF, 0, 0, 139, 1025, "VersionString3"};
+    const auto filePath = imageDir / "image";
+    EXPECT_EQ(TransferPackageState::FAILED,
+              otherDeviceUpdateManager.txComponentImage(filePath,
+                                                        compImageInfo, 1163));
+    EXPECT_TRUE(otherDeviceUpdateManager.extractions.empty());
+
+    // a package truncated after it was checked leaves no partial image
+    otherDeviceUpdateManager.extractions.emplace_back(
+        OtherDeviceUpdateManager::ComponentImageExtraction{filePath, 139,
+                                                           1025});
+    pldm::utils::CustomFD packageFd(open("./test_pkg", O_RDONLY | O_CLOEXEC));
+    ASSERT_GE(packageFd(), 0);
+    EXPECT_FALSE(otherDeviceUpdateManager.extractComponentImages(packageFd()));
+    EXPECT_FALSE(std::filesystem::exists(filePath));
+    auto tmpPath = filePath;
+    tmpPath += ".tmp";
+    EXPECT_FALSE(std::filesystem::exists(tmpPath));
+}
+
+TEST_F(OtherDeviceUpdateManagerTest, copyPackageRangeWithSendfile)
+{
+    const auto packageData = readFile("./test_pkg");
+    constexpr off_t offset = 139;
+    constexpr size_t size = 1024;
+    const std::vector<uint8_t> expected(packageData.begin() + offset,
+                                        packageData.begin() + offset + size);
+
+    pldm::utils::CustomFD packageFd(open("./test_pkg", O_RDONLY | O_CLOEXEC));
+    ASSERT_GE(packageFd(), 0);
+    for (bool useCopyFileRange : {true, false})
+    {
+        const auto filePath = imageDir / "image";
+        {
+            pldm::utils::CustomFD fd(
+                open(filePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                     0644));
+            ASSERT_GE(fd(), 0);
+            EXPECT_TRUE(OtherDeviceUpdateManager::copyPackageRange(
+                packageFd(), offset, size, fd(), useCopyFileRange));
+        }
+        EXPECT_EQ(expected, readFile(filePath));
+    }
+}
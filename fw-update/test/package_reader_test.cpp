@@ -0,0 +1,58 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "fw-update/package_reader.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::fw_update;
+
+TEST(PackageReader, viewPackage)
+{
+    std::ifstream stream("./test_pkg", std::ios::in | std::ios::binary);
+    std::vector<uint8_t> contents{std::istreambuf_iterator<char>(stream),
+                                  std::istreambuf_iterator<char>()};
+
+    PackageReader reader("./test_pkg");
+    ASSERT_TRUE(reader.valid());
+    EXPECT_EQ(contents.size(), reader.size());
+
+    auto all = reader.view(0, reader.size());
+    EXPECT_TRUE(std::equal(all.begin(), all.end(), contents.begin(),
+                           contents.end()));
+
+    auto range = reader.view(139, 512);
+    ASSERT_EQ(512, range.size());
+    EXPECT_TRUE(std::equal(range.begin(), range.end(),
+                           contents.begin() + 139));
+    reader.willNeed(139, 1024);
+
+    // the ranges beyond the package are not viewable
+    EXPECT_TRUE(reader.view(reader.size() - 1, 2).empty());
+    EXPECT_TRUE(reader.view(reader.size() + 1, 0).empty());
+}
+
+TEST(PackageReader, missingPackage)
+{
+    PackageReader reader("./no_such_pkg");
+    EXPECT_FALSE(reader.valid());
+    EXPECT_EQ(0, reader.size());
+    EXPECT_TRUE(reader.view(0, 1).empty());
+}
@@ -19,8 +19,12 @@
 #include "fw-update/package_parser.hpp"
 #include "fw-update/package_signature.hpp"
 
+#include <systemd/sd-event.h>
+
+#include <sdeventplus/event.hpp>
 #include <xyz/openbmc_project/Common/error.hpp>
 
+#include <optional>
 #include <sstream>
 #include <typeinfo>
 
@@ -1933,4 +1937,40 @@ TEST_F(PackageSignatureTest, signatureV3WithUseChunksEnabled)
 
     EXPECT_EQ(pkgSignHdrData.size(), pldmFwupSignaturePackageSize);
     EXPECT_TRUE(verificationResult);
-}
\ No newline at end of file
+}
+
+TEST_F(PackageSignatureTest, signatureV3IntegrityCheckAsync)
+{
+    std::string strPkg((char*)signedPackageV3WithPublicKey.data(),
+                       signedPackageV3WithPublicKey.size());
+    std::istringstream package(strPkg);
+
+    uintmax_t calcPkgSize = calculatePackageSize(package);
+
+    std::vector<uint8_t> pkgSignHdrData =
+        PackageSignature::getSignatureHeader(package, calcPkgSize);
+
+    PackageSignatureV3TestUseChunks packageSignatureParser(pkgSignHdrData,
+                                                           true);
+
+    packageSignatureParser.parseHeader();
+
+    uintmax_t sizeOfSignedData =
+        packageSignatureParser.calculateSizeOfSignedData(calcPkgSize);
+
+    // the digest is calculated on a worker thread and the result is handed
+    // back on the event loop
+    auto event = sdeventplus::Event::get_default();
+    std::optional<bool> integrityCheckResult;
+    packageSignatureParser.integrityCheckAsync(
+        package, sizeOfSignedData,
+        [&integrityCheckResult](bool result) { integrityCheckResult = result; },
+        [](const std::string& errorMsg) { FAIL() << errorMsg; });
+    for (int i = 0; i < 50 && !integrityCheckResult; i++)
+    {
+        sd_event_run(event.get(), 100000);
+    }
+
+    ASSERT_TRUE(integrityCheckResult);
+    EXPECT_TRUE(*integrityCheckResult);
+}
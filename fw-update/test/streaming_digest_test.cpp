@@ -0,0 +1,139 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "fw-update/package_signature.hpp"
+#include "fw-update/streaming_digest.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::fw_update;
+
+class StreamingDigestTest : public testing::Test
+{
+  protected:
+    StreamingDigestTest()
+    {
+        std::ifstream stream("./test_pkg", std::ios::in | std::ios::binary);
+        package.assign(std::istreambuf_iterator<char>(stream),
+                       std::istreambuf_iterator<char>());
+
+        char tmpl[] = "/tmp/streaming_digest_test.XXXXXX";
+        auto fd = mkstemp(tmpl);
+        close(fd);
+        path = tmpl;
+    }
+
+    ~StreamingDigestTest()
+    {
+        std::filesystem::remove(path);
+    }
+
+    /** @brief Append to the package the way it is written while staged */
+    void write(size_t offset, size_t count)
+    {
+        std::ofstream stream(path, std::ios::out | std::ios::binary |
+                                       std::ios::app);
+        stream.write(package.data() + offset, count);
+    }
+
+    std::vector<unsigned char> expectedDigest(uintmax_t length)
+    {
+        std::stringstream stream(std::string(package.begin(), package.end()));
+        PackageSignatureSha384 sha;
+        return sha.calculateDigest(stream, length);
+    }
+
+    std::vector<char> package;
+    std::filesystem::path path;
+};
+
+TEST_F(StreamingDigestTest, hashWhileWritten)
+{
+    ASSERT_GT(package.size(), pldmFwupSignaturePackageSize);
+
+    StreamingDigest digest(path, packageSignatureSha384Name);
+    constexpr size_t writeSize = 100;
+    for (size_t offset = 0; offset < package.size(); offset += writeSize)
+    {
+        write(offset, std::min(writeSize, package.size() - offset));
+        EXPECT_TRUE(digest.update());
+    }
+    ASSERT_TRUE(digest.matches(path));
+
+    // the package header is kept once it is written
+    auto headerInfo =
+        reinterpret_cast<const pldm_package_header_information*>(
+            package.data());
+    const auto& header = digest.getHeader();
+    ASSERT_EQ(headerInfo->package_header_size, header.size());
+    EXPECT_EQ(std::vector<uint8_t>(package.begin(),
+                                   package.begin() + header.size()),
+              header);
+
+    // the digest is available for any length within the held back data
+    auto hashedLength = package.size() - pldmFwupSignaturePackageSize;
+    for (auto length : {hashedLength, package.size() - 1, package.size()})
+    {
+        auto result = digest.digest(length);
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(expectedDigest(length), *result);
+    }
+
+    EXPECT_FALSE(digest.digest(hashedLength - 1).has_value());
+    EXPECT_FALSE(digest.digest(package.size() + 1).has_value());
+}
+
+TEST_F(StreamingDigestTest, truncatedPackage)
+{
+    StreamingDigest digest(path, packageSignatureSha384Name);
+    write(0, package.size());
+    EXPECT_TRUE(digest.update());
+
+    std::filesystem::resize_file(path, package.size() / 2);
+    EXPECT_FALSE(digest.update());
+    EXPECT_FALSE(digest.matches(path));
+    EXPECT_FALSE(digest.digest(package.size() / 2).has_value());
+}
+
+TEST_F(StreamingDigestTest, modifiedPackage)
+{
+    StreamingDigest digest(path, packageSignatureSha384Name);
+    write(0, package.size());
+    EXPECT_TRUE(digest.update());
+    EXPECT_TRUE(digest.matches(path));
+
+    // written after the last update
+    write(0, 1);
+    EXPECT_FALSE(digest.matches(path));
+
+    // replaced by another file
+    auto other = path;
+    other += ".other";
+    std::filesystem::copy_file(path, other);
+    std::filesystem::rename(other, path);
+    EXPECT_TRUE(digest.update());
+    EXPECT_FALSE(digest.matches(path));
+}
@@ -40,7 +40,7 @@ class PackageAssociationEmptyTargetFiltering : public testing::Test
         reqHandler(event, dbusImplRequester, sockManager, false, seconds(1), 2,
                    milliseconds(100)),
         updateManager(event, reqHandler, dbusImplRequester, descriptorMap,
-                      componentInfoMap, componentNameMap, false)
+                      componentInfoMap, componentNameMap, mctpBusMap, false)
     {}
 
     sdeventplus::Event event;
@@ -50,6 +50,7 @@ class PackageAssociationEmptyTargetFiltering : public testing::Test
     const DescriptorMap descriptorMap;
     const ComponentInfoMap componentInfoMap;
     ComponentNameMap componentNameMap;
+    MctpBusMap mctpBusMap;
     UpdateManager updateManager;
 
     // Package to firmware device associations, the FD identifer records via
@@ -264,7 +265,7 @@ class PackageAssociationTargetFiltering : public testing::Test
         reqHandler(event, dbusImplRequester, sockManager, false, seconds(1), 2,
                    milliseconds(100)),
         updateManager(event, reqHandler, dbusImplRequester, descriptorMap,
-                      componentInfoMap, componentNameMap, false)
+                      componentInfoMap, componentNameMap, mctpBusMap, false)
     {}
 
     sdeventplus::Event event;
@@ -320,6 +321,7 @@ class PackageAssociationTargetFiltering : public testing::Test
     ComponentNameMap componentNameMap{
         {eid1, {{65280, "ERoT_FPGA_Firmware"}, {80, "FPGAFirmware"}}},
         {eid2, {{65280, "ERoT_HMC_Firmware"}, {16, "HMCFirmware"}}}};
+    MctpBusMap mctpBusMap;
 };
 
 TEST_F(PackageAssociationTargetFiltering, MatchingTwoComponents)
@@ -398,7 +400,7 @@ class PackageAssociationMultipleDescSameType : public testing::Test
         reqHandler(event, dbusImplRequester, sockManager, false, seconds(1), 2,
                    milliseconds(100)),
         updateManager(event, reqHandler, dbusImplRequester, descriptorMap,
-                      componentInfoMap, componentNameMap, false)
+                      componentInfoMap, componentNameMap, mctpBusMap, false)
     {}
 
     sdeventplus::Event event;
@@ -408,6 +410,7 @@ class PackageAssociationMultipleDescSameType : public testing::Test
     const DescriptorMap descriptorMap;
     const ComponentInfoMap componentInfoMap;
     ComponentNameMap componentNameMap;
+    MctpBusMap mctpBusMap;
     UpdateManager updateManager;
 
     const FirmwareDeviceIDRecords inFwDeviceIDRecords{
@@ -48,13 +48,14 @@ class UpdateManagerTest : public testing::Test
     DescriptorMap descriptorMap;
     ComponentInfoMap componentInfoMap;
     ComponentNameMap componentNameMap;
+    MctpBusMap mctpBusMap;
 };
 
 TEST_F(UpdateManagerTest, getActivationMethod_Automatic)
 {
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     const std::string activationMethodResult = "Automatic";
 
@@ -70,7 +71,7 @@ TEST_F(UpdateManagerTest, getActivationMethod_SelfContained)
 {
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     const std::string activationMethodResult = "Self-Contained";
 
@@ -86,7 +87,7 @@ TEST_F(UpdateManagerTest, getActivationMethod_AutomaticOrSelfContained)
 {
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     const std::string activationMethodResult = "Automatic or Self-Contained";
 
@@ -102,7 +103,7 @@ TEST_F(UpdateManagerTest, getActivationMethod_MediumSpecificReset)
 {
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     const std::string activationMethodResult = "Medium-specific reset";
 
@@ -118,7 +119,7 @@ TEST_F(UpdateManagerTest, getActivationMethod_SystemReboot)
 {
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     const std::string activationMethodResult = "System reboot";
 
@@ -134,7 +135,7 @@ TEST_F(UpdateManagerTest, getActivationMethod_AcPowerCycle)
 {
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     const std::string activationMethodResult = "AC power cycle";
 
@@ -150,7 +151,7 @@ TEST_F(UpdateManagerTest, getActivationMethod_DcOrAcPowerCycle)
 {
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     const std::string activationMethodResult =
         "DC power cycle or AC power cycle";
@@ -167,7 +168,7 @@ TEST_F(UpdateManagerTest, clearFirmwareUpdatePackage)
 {
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     EXPECT_NO_THROW({ updateManager.clearFirmwareUpdatePackage(); });
 }
@@ -179,7 +180,7 @@ TEST_F(UpdateManagerTest, updateDeviceCompletion)
 
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     std::vector<ComponentName> successCompNames = {
         "TestComponentName1", "TestComponentName2", "TestComponentName3"};
@@ -196,7 +197,7 @@ TEST_F(UpdateManagerTest, updateDeviceCompletion_withStatusEqualsFalse)
 
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     EXPECT_NO_THROW({ updateManager.updateDeviceCompletion(eid, status); });
 }
@@ -208,7 +209,7 @@ TEST_F(UpdateManagerTest, updateDeviceCompletion_withoutSuccessCompNames)
 
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     EXPECT_NO_THROW({ updateManager.updateDeviceCompletion(eid, status); });
 }
@@ -217,7 +218,7 @@ TEST_F(UpdateManagerTest, updateActivationProgress)
 {
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     EXPECT_NO_THROW({ updateManager.updateActivationProgress(); });
 }
@@ -226,7 +227,7 @@ TEST_F(UpdateManagerTest, clearActivationInfo)
 {
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     EXPECT_NO_THROW({ updateManager.clearActivationInfo(); });
 }
@@ -235,7 +236,7 @@ TEST_F(UpdateManagerTest, activatePackage_throw_exception)
 {
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     EXPECT_THROW(updateManager.activatePackage(),
                  sdbusplus::exception::SdBusError);
@@ -245,7 +246,7 @@ TEST_F(UpdateManagerTest, processPackage_empty_descriptorMap)
 {
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     updateManager.processPackage("./test_pkg");
 }
@@ -266,7 +267,7 @@ TEST_F(UpdateManagerTest, processPackage_no_matching_devices_found)
     ComponentNameMap componentNameMap;
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap2, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     updateManager.processPackage("./test_pkg");
 }
@@ -293,7 +294,7 @@ TEST_F(UpdateManagerTest, processPackage_new)
 
     UpdateManager updateManager(event, reqHandler2, dbusImplRequester,
                                 descriptorMap2, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     int result = updateManager.processPackage("./test_pkg");
 
@@ -306,7 +307,7 @@ TEST_F(UpdateManagerTest, handleRequest_empty_descriptorMap)
 
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     mctp_eid_t eid = 0;
 
@@ -342,7 +343,7 @@ TEST_F(UpdateManagerTest, handleRequest_request_fw_data)
 
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap2, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     constexpr std::array<uint8_t, sizeof(pldm_msg_hdr) +
                                       sizeof(pldm_request_firmware_data_req)>
@@ -377,7 +378,7 @@ TEST_F(UpdateManagerTest, handleRequest_transfer_complete)
 
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap2, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     constexpr std::array<uint8_t, sizeof(pldm_msg_hdr) +
                                       sizeof(pldm_request_firmware_data_req)>
@@ -413,7 +414,7 @@ TEST_F(UpdateManagerTest, handleRequest_verify_complete)
 
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap2, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     constexpr std::array<uint8_t, sizeof(pldm_msg_hdr) +
                                       sizeof(pldm_request_firmware_data_req)>
@@ -449,7 +450,7 @@ TEST_F(UpdateManagerTest, handleRequest_apply_complete)
 
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap2, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     constexpr std::array<uint8_t, sizeof(pldm_msg_hdr) +
                                       sizeof(pldm_request_firmware_data_req)>
@@ -485,7 +486,7 @@ TEST_F(UpdateManagerTest, handleRequest_not_supported_command)
 
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap2, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     constexpr std::array<uint8_t, sizeof(pldm_msg_hdr) +
                                       sizeof(pldm_request_firmware_data_req)>
@@ -508,7 +509,7 @@ TEST_F(UpdateManagerTest, setActivationStatus)
 
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     const Server::Activation::Activations activationState =
         Server::Activation::Activations::Active;
@@ -522,7 +523,7 @@ TEST_F(UpdateManagerTest, updateOtherDeviceComponents)
 {
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     std::unordered_map<std::string, bool> otherDeviceMap = {
         {"device1", true}, {"device2", false}, {"device3", true}};
@@ -536,7 +537,7 @@ TEST_F(UpdateManagerTest, resetActivationBlocksTransition)
 {
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     EXPECT_NO_THROW({ updateManager.resetActivationBlocksTransition(); });
 }
@@ -577,7 +578,7 @@ TEST_F(UpdateManagerTest, getComponentName)
 
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap2, componentInfoMap2,
-                                componentNameMap2, true);
+                                componentNameMap2, mctpBusMap, true);
 
     FirmwareDeviceIDRecord fwDeviceIDRecord = {
         1,
@@ -633,7 +634,7 @@ TEST_F(UpdateManagerTest, getComponentName_DoesNotFindComponent)
 
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap2, componentInfoMap2,
-                                componentNameMap2, true);
+                                componentNameMap2, mctpBusMap, true);
 
     FirmwareDeviceIDRecord fwDeviceIDRecord = {
         1,
@@ -686,7 +687,7 @@ TEST_F(UpdateManagerTest, getComponentName_ForEmptyComponentNameMap)
 
     UpdateManager updateManager(event, reqHandler, dbusImplRequester,
                                 descriptorMap2, componentInfoMap2,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     FirmwareDeviceIDRecord fwDeviceIDRecord = {
         1,
@@ -728,7 +729,7 @@ TEST_F(UpdateManagerTest, processPackage_Package_v3_truncated)
 
     UpdateManager updateManager(event, reqHandler2, dbusImplRequester,
                                 descriptorMap2, componentInfoMap,
-                                componentNameMap, true);
+                                componentNameMap, mctpBusMap, true);
 
     int result = updateManager.processPackage("./test_pkg_v3_signed_truncated");
 
@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "fw-update/update_scheduler.hpp"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm;
+using namespace pldm::fw_update;
+
+static const MctpMedium pcie =
+    "xyz.openbmc_project.MCTP.Endpoint.MediaTypes.PCIe";
+static const MctpBinding pcieBinding =
+    "xyz.openbmc_project.MCTP.Binding.BindingTypes.PCIe";
+static const MctpMedium smbus =
+    "xyz.openbmc_project.MCTP.Endpoint.MediaTypes.SMBus";
+static const MctpBinding smbusBinding =
+    "xyz.openbmc_project.MCTP.Binding.BindingTypes.SMBus";
+
+TEST(UpdateScheduler, noLimit)
+{
+    std::vector<EID> started;
+    UpdateScheduler scheduler(0, [&started](EID eid) {
+        started.emplace_back(eid);
+    });
+
+    scheduler.schedule(1, smbus, smbusBinding);
+    scheduler.schedule(2, smbus, smbusBinding);
+    scheduler.schedule(3, pcie, pcieBinding);
+    scheduler.start();
+
+    // the buses with the higher bandwidth are started first
+    EXPECT_EQ((std::vector<EID>{3, 1, 2}), started);
+    EXPECT_EQ(2, scheduler.getRunning(smbus, smbusBinding));
+    EXPECT_EQ(1, scheduler.getRunning(pcie, pcieBinding));
+}
+
+TEST(UpdateScheduler, limitPerBus)
+{
+    std::vector<EID> started;
+    UpdateScheduler scheduler(1, [&started](EID eid) {
+        started.emplace_back(eid);
+    });
+
+    scheduler.schedule(1, smbus, smbusBinding);
+    scheduler.schedule(2, smbus, smbusBinding);
+    scheduler.schedule(3, pcie, pcieBinding);
+    scheduler.schedule(4, pcie, pcieBinding);
+    scheduler.start();
+
+    EXPECT_EQ((std::vector<EID>{3, 1}), started);
+    EXPECT_EQ(1, scheduler.getRunning(smbus, smbusBinding));
+    EXPECT_EQ(1, scheduler.getQueued(smbus, smbusBinding));
+
+    // the buses are independent of each other
+    scheduler.completed(3);
+    EXPECT_EQ((std::vector<EID>{3, 1, 4}), started);
+    EXPECT_EQ(1, scheduler.getQueued(smbus, smbusBinding));
+
+    // completing a device again doesn't start another one
+    scheduler.completed(3);
+    EXPECT_EQ(1, scheduler.getRunning(pcie, pcieBinding));
+
+    scheduler.completed(1);
+    EXPECT_EQ((std::vector<EID>{3, 1, 4, 2}), started);
+    EXPECT_EQ(0, scheduler.getQueued(smbus, smbusBinding));
+}
+
+TEST(UpdateScheduler, startFailure)
+{
+    std::vector<EID> started;
+    UpdateScheduler* schedulerPtr = nullptr;
+    UpdateScheduler scheduler(1, [&started, &schedulerPtr](EID eid) {
+        started.emplace_back(eid);
+        // the update of the device fails right away
+        schedulerPtr->completed(eid);
+    });
+    schedulerPtr = &scheduler;
+
+    scheduler.schedule(1, smbus, smbusBinding);
+    scheduler.schedule(2, smbus, smbusBinding);
+    scheduler.schedule(3, smbus, smbusBinding);
+    scheduler.start();
+
+    EXPECT_EQ((std::vector<EID>{1, 2, 3}), started);
+    EXPECT_EQ(0, scheduler.getRunning(smbus, smbusBinding));
+    EXPECT_EQ(0, scheduler.getQueued(smbus, smbusBinding));
+}
+
+TEST(UpdateScheduler, cancelQueued)
+{
+    std::vector<EID> started;
+    UpdateScheduler scheduler(1, [&started](EID eid) {
+        started.emplace_back(eid);
+    });
+
+    scheduler.schedule(1, smbus, smbusBinding);
+    scheduler.schedule(2, smbus, smbusBinding);
+    scheduler.start();
+    scheduler.cancel();
+    scheduler.completed(1);
+
+    EXPECT_EQ((std::vector<EID>{1}), started);
+    EXPECT_EQ(0, scheduler.getRunning(smbus, smbusBinding));
+}
+
+TEST(UpdateScheduler, statistics)
+{
+    UpdateScheduler scheduler(0, [](EID) {});
+
+    scheduler.schedule(1, pcie, pcieBinding);
+    scheduler.start();
+    scheduler.transferred(1, 512);
+    scheduler.transferred(1, 512);
+    // not scheduled
+    scheduler.transferred(2, 512);
+    scheduler.completed(1);
+
+    EXPECT_EQ(1024, scheduler.getStatistics(1).bytes);
+    EXPECT_EQ(0, scheduler.getStatistics(2).bytes);
+}
+
+TEST(UpdateScheduler, rounds)
+{
+    UpdateScheduler unlimited(0, [](EID) {});
+    unlimited.schedule(1, smbus, smbusBinding);
+    unlimited.schedule(2, smbus, smbusBinding);
+    EXPECT_EQ(1, unlimited.getRounds());
+
+    UpdateScheduler scheduler(2, [](EID) {});
+    EXPECT_EQ(1, scheduler.getRounds());
+
+    scheduler.schedule(1, smbus, smbusBinding);
+    scheduler.schedule(2, smbus, smbusBinding);
+    scheduler.schedule(3, smbus, smbusBinding);
+    scheduler.schedule(4, pcie, pcieBinding);
+    // the bus with the most devices takes the most rounds
+    EXPECT_EQ(2, scheduler.getRounds());
+
+    scheduler.start();
+    EXPECT_EQ(2, scheduler.getRounds());
+    scheduler.completed(1);
+    scheduler.completed(2);
+    EXPECT_EQ(1, scheduler.getRounds());
+}
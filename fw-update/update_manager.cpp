@@ -23,6 +23,7 @@
 
 #include <phosphor-logging/lg2.hpp>
 
+#include <algorithm>
 #include <bitset>
 #include <cassert>
 #include <cmath>
@@ -43,13 +44,21 @@ UpdateManager::UpdateManager(
     Event& event, pldm::requester::Handler<pldm::requester::Request>& handler,
     Requester& requester, const DescriptorMap& descriptorMap,
     const ComponentInfoMap& componentInfoMap,
-    ComponentNameMap& componentNameMap, bool fwDebug) :
+    ComponentNameMap& componentNameMap, const MctpBusMap& mctpBusMap,
+    bool fwDebug) :
     event(event),
     handler(handler), requester(requester), fwDebug(fwDebug),
     descriptorMap(descriptorMap), componentInfoMap(componentInfoMap),
-    componentNameMap(componentNameMap),
+    componentNameMap(componentNameMap), mctpBusMap(mctpBusMap),
     watch(event.get(), std::bind_front(&UpdateManager::processPackage, this),
-          std::bind_front(&UpdateManager::processStagedPackage, this), this)
+          std::bind_front(&UpdateManager::processStagedPackage, this), this),
+    updateScheduler(FW_UPDATE_MAX_DEVICES_PER_BUS, [this](EID eid) {
+        auto search = deviceUpdaterMap.find(eid);
+        if (search != deviceUpdaterMap.end())
+        {
+            search->second->startFwUpdateFlow();
+        }
+    })
 {
     watch.initImmediateUpdateWatch();
     watch.initStagedUpdateWatch();
@@ -327,21 +336,15 @@ int UpdateManager::processPackage(const std::filesystem::path& packageFilePath)
         return -1;
     }
 
-    package.seekg(0);
-    std::vector<uint8_t> packageHeader(sizeof(pldm_package_header_information));
-    package.read(reinterpret_cast<char*>(packageHeader.data()),
-                 sizeof(pldm_package_header_information));
+    auto packageHeader = readPackageHeader(
+        packageFilePath, sizeof(pldm_package_header_information));
 
     auto pkgHeaderInfo =
         reinterpret_cast<const pldm_package_header_information*>(
             packageHeader.data());
     auto pkgHeaderInfoSize = sizeof(pldm_package_header_information) +
                              pkgHeaderInfo->package_version_string_length;
-    packageHeader.clear();
-    packageHeader.resize(pkgHeaderInfoSize);
-    package.seekg(0);
-    package.read(reinterpret_cast<char*>(packageHeader.data()),
-                 pkgHeaderInfoSize);
+    packageHeader = readPackageHeader(packageFilePath, pkgHeaderInfoSize);
 
     parser = parsePkgHeader(packageHeader);
     if (parser == nullptr)
@@ -360,10 +363,7 @@ int UpdateManager::processPackage(const std::filesystem::path& packageFilePath)
         return -1;
     }
 
-    package.seekg(0);
-    packageHeader.resize(parser->pkgHeaderSize);
-    package.read(reinterpret_cast<char*>(packageHeader.data()),
-                 parser->pkgHeaderSize);
+    packageHeader = readPackageHeader(packageFilePath, parser->pkgHeaderSize);
     try
     {
         parser->parse(packageHeader, packageSize);
@@ -424,7 +424,7 @@ int UpdateManager::processPackage(const std::filesystem::path& packageFilePath)
         otherDevicesImageCount =
             otherDeviceUpdateManager->extractOtherDevicePkgs(
                 parser->getFwDeviceIDRecords(),
-                parser->getComponentImageInfos(), package);
+                parser->getComponentImageInfos(), packageFilePath);
     }
     else
     {
@@ -469,6 +469,11 @@ int UpdateManager::processPackage(const std::filesystem::path& packageFilePath)
         }
     }
 
+    if (!deviceUpdaterMap.empty())
+    {
+        mapPackage(packageFilePath);
+    }
+
     // delay activation object creation if there are non-pldm updates
     if (otherDevicesImageCount == 0)
     {
@@ -487,55 +492,115 @@ void UpdateManager::performSecurityChecksAsync(
 #ifdef PLDM_PACKAGE_INTEGRITY_CHECK
 
     securityCheckType = SecurityCheckType::Integrity;
+    auto [integrityCheckComplete, integrityCheckError] =
+        pipelineSecurityChecks(onComplete, onError);
     // Perform integrity check on the firmware package
     packageIntegrityCheckAsync(
-        [onComplete](bool integrityCheck) {
+        [integrityCheckComplete(integrityCheckComplete)](bool integrityCheck) {
             if (integrityCheck)
             {
                 lg2::info(
                     "Firmware package integrity check completed successfully");
-                onComplete(true);
+                integrityCheckComplete(true);
             }
             else
             {
                 lg2::error("Firmware package integrity check failed");
-                onComplete(false);
+                integrityCheckComplete(false);
             }
         },
-        onError);
+        integrityCheckError);
 
 #endif
 
 #ifdef PLDM_PACKAGE_VERIFICATION
     securityCheckType = SecurityCheckType::Authentication;
-    try
+    auto [verificationComplete, verificationError] =
+        pipelineSecurityChecks(onComplete, onError);
+    // Verify the signature of the firmware package
+    verifyPackageAsync(verificationComplete, verificationError);
+
+#endif
+
+    // Return the overall result of security checks
+    if (securityCheckType == SecurityCheckType::Disabled)
     {
-        // Verify the signature of the firmware package
-        if (!verifyPackage())
-        {
-            onComplete(false);
-        }
-        else
-        {
-            onComplete(true);
-        }
+        onComplete(true);
     }
-    catch (const std::exception& e)
+}
+
+std::pair<std::function<void(bool)>,
+          std::function<void(const std::string& errorMsg)>>
+    UpdateManager::pipelineSecurityChecks(
+        std::function<void(bool)> onComplete,
+        std::function<void(const std::string& errorMsg)> onError)
+{
+#if defined(PLDM_PACKAGE_VERIFICATION_PIPELINED) && !defined(DEBUG_TOKEN)
+    if (deviceUpdaterMap.empty())
     {
-        lg2::error("Invalid PLDM package signature");
-        onError(std::string("Package verification failed with exception: ") +
-                e.what());
+        return {onComplete, onError};
     }
 
+    lg2::info("Start the PLDM firmware transfer while the package is verified");
+    verificationPending = true;
+    verificationFailed = false;
+    prepareActivation();
+    startPLDMUpdate();
+    pldmUpdateStarted = true;
+
+    auto checkComplete = [this, onComplete](bool passed) {
+        verificationCompleted(passed);
+        onComplete(passed);
+    };
+    auto checkError = [this, onError](const std::string& errorMsg) {
+        verificationCompleted(false);
+        onError(errorMsg);
+    };
+    return {checkComplete, checkError};
+#else
+    return {onComplete, onError};
 #endif
+}
 
-    // Return the overall result of security checks
-    if (securityCheckType == SecurityCheckType::Disabled)
+void UpdateManager::verificationCompleted(bool passed)
+{
+    verificationPending = false;
+    verificationFailed = !passed;
+    if (!passed && progressTimer)
     {
-        onComplete(true);
+        // the activation is failed by the security checks callback, the
+        // DeviceUpdaters still cancel the update on the devices
+        progressTimer->stop();
+        progressTimer.reset();
+    }
+
+    if (!passed)
+    {
+        // the queued devices are not started
+        updateScheduler.cancel();
+    }
+
+    for (const auto& [eid, deviceUpdaterPtr] : deviceUpdaterMap)
+    {
+        deviceUpdaterPtr->verificationCompleted(passed);
     }
 }
 
+bool UpdateManager::openVerificationPackage()
+{
+    verificationPackage.close();
+    verificationPackage.open(fwPackageFilePath,
+                             std::ios::binary | std::ios::in);
+    if (!verificationPackage.good())
+    {
+        lg2::error("Failed to open the package for the verification, "
+                   "PACKAGE={PACKAGE}",
+                   "PACKAGE", fwPackageFilePath.string());
+        return false;
+    }
+    return true;
+}
+
 bool UpdateManager::verifyPackage()
 {
     std::string compName = "Firmware Update Service";
@@ -598,6 +663,8 @@ bool UpdateManager::verifyPackage()
         uintmax_t sizeOfSignedData =
             packageSignatureParser->calculateSizeOfSignedData(calcPkgSize);
 
+        // the signature is always verified on the package as it is now, a
+        // rewrite of the staged data is not seen by the streamed digest
         bool isSignedProperly = packageSignatureParser->verify(
             package, PLDM_PACKAGE_VERIFICATION_KEY, sizeOfSignedData);
 
@@ -630,6 +697,96 @@ bool UpdateManager::verifyPackage()
     return true;
 }
 
+void UpdateManager::verifyPackageAsync(
+    std::function<void(bool)> onComplete,
+    std::function<void(const std::string& errorMsg)> onError)
+{
+    const static std::string compName = "Firmware Update Service";
+    const static std::string messageError =
+        "Validating FW Package signature failed";
+    const static std::string messageErrorUnsupportedVersion =
+        "Unsupported version of package signature";
+    const static std::string resolution =
+        "Retry firmware update operation with correctly signed FW package.";
+
+    const auto calcPkgSize = parser->calculatePackageSize();
+    std::vector<uint8_t> pkgSignHdrData;
+
+    try
+    {
+        pkgSignHdrData =
+            PackageSignature::getSignatureHeader(package, calcPkgSize);
+    }
+    catch (const std::exception& e)
+    {
+        lg2::error("Failed to get signature header.");
+        createLogEntry(resourceErrorDetected, compName, messageError,
+                       resolution);
+        onComplete(false);
+        return;
+    }
+
+    if (pkgSignHdrData.empty())
+    {
+#ifdef PLDM_PACKAGE_VERIFICATION_MUST_BE_SIGNED
+        createLogEntry(resourceErrorDetected, compName,
+                       "Package does not contain signature header",
+                       resolution);
+        onComplete(false);
+#else
+        lg2::info("FW package does not contain signature header");
+        onComplete(true);
+#endif
+        return;
+    }
+
+    packageSignatureParser.reset();
+    try
+    {
+        packageSignatureParser =
+            PackageSignature::createPackageSignatureParser(pkgSignHdrData);
+        packageSignatureParser->parseHeader();
+    }
+    catch (const std::exception& e)
+    {
+        createLogEntry(resourceErrorDetected, compName,
+                       packageSignatureParser ? messageError
+                                              : messageErrorUnsupportedVersion,
+                       resolution);
+        onComplete(false);
+        return;
+    }
+
+    // the signature is always verified on the package as it is now, a
+    // rewrite of the staged data is not seen by the streamed digest
+    if (!openVerificationPackage())
+    {
+        createLogEntry(resourceErrorDetected, compName, messageError,
+                       resolution);
+        onComplete(false);
+        return;
+    }
+
+    auto sizeOfSignedData =
+        packageSignatureParser->calculateSizeOfSignedData(calcPkgSize);
+    packageSignatureParser->verifyAsync(
+        verificationPackage, PLDM_PACKAGE_VERIFICATION_KEY, sizeOfSignedData,
+        [onComplete](bool isSignedProperly) {
+            if (isSignedProperly)
+            {
+                lg2::info("FW package signature was successfully verified");
+                onComplete(true);
+            }
+            else
+            {
+                createLogEntry(resourceErrorDetected, compName, messageError,
+                               resolution);
+                onComplete(false);
+            }
+        },
+        onError);
+}
+
 void UpdateManager::packageIntegrityCheckAsync(
     std::function<void(bool)> onComplete,
     std::function<void(const std::string& errorMsg)> onError)
@@ -690,8 +847,33 @@ void UpdateManager::packageIntegrityCheckAsync(
 
         auto sizeOfSignedData =
             packageSignatureParser->calculateSizeOfSignedData(calcPkgSize);
+        if (auto digest = getStreamedDigest(fwPackageFilePath,
+                                            sizeOfSignedData))
+        {
+            if (packageSignatureParser->integrityCheckDigest(*digest))
+            {
+                lg2::info("Integrity check successful for FW Package");
+                onComplete(true);
+            }
+            else
+            {
+                createLogEntry(resourceErrorDetected, compName, messageError,
+                               resolution);
+                onComplete(false);
+            }
+            return;
+        }
+
+        if (!openVerificationPackage())
+        {
+            createLogEntry(resourceErrorDetected, compName, messageError,
+                           resolution);
+            onComplete(false);
+            return;
+        }
+
         packageSignatureParser->integrityCheckAsync(
-            package, sizeOfSignedData,
+            verificationPackage, sizeOfSignedData,
             [onComplete](bool integritycheckResult) {
                 if (integritycheckResult)
                 {
@@ -775,8 +957,12 @@ bool UpdateManager::packageIntegrityCheck()
         uintmax_t sizeOfSignedData =
             packageSignatureParser->calculateSizeOfSignedData(calcPkgSize);
 
+        auto digest = getStreamedDigest(stagedfwPackageFilePath,
+                                        sizeOfSignedData);
         bool integritycheckResult =
-            packageSignatureParser->integrityCheck(package, sizeOfSignedData);
+            digest ? packageSignatureParser->integrityCheckDigest(*digest)
+                   : packageSignatureParser->integrityCheck(package,
+                                                            sizeOfSignedData);
 
         if (integritycheckResult)
         {
@@ -912,6 +1098,13 @@ void UpdateManager::updateDeviceCompletion(
     mctp_eid_t eid, bool status,
     const std::vector<ComponentName>& successCompNames)
 {
+    // a device failing the update may report the completion more than once,
+    // the first one completes it
+    if (!deviceUpdateCompletionMap.emplace(eid, status).second)
+    {
+        return;
+    }
+
     // Update listCompNames with the components successfully updated
     if (status && !successCompNames.empty())
     {
@@ -928,12 +1121,17 @@ void UpdateManager::updateDeviceCompletion(
         }
     }
 
-    /* update completion map */
-    deviceUpdateCompletionMap.emplace(eid, status);
+    if (verificationFailed)
+    {
+        // the activation is already failed by the security checks
+        return;
+    }
 
     updateActivationProgress();
     /* Update package completion */
     updatePackageCompletion();
+    /* Start the next device queued for the bus */
+    updateScheduler.completed(eid);
     return;
 }
 
@@ -946,7 +1144,17 @@ Response UpdateManager::handleRequest(mctp_eid_t eid, uint8_t command,
         auto search = deviceUpdaterMap.find(eid);
         if (command == PLDM_REQUEST_FIRMWARE_DATA)
         {
-            return search->second->requestFwData(request, reqMsgLen);
+            auto fwDataResponse =
+                search->second->requestFwData(request, reqMsgLen);
+            constexpr auto fwDataOffset =
+                sizeof(pldm_msg_hdr) + sizeof(uint8_t);
+            if (fwDataResponse.size() > fwDataOffset &&
+                fwDataResponse[sizeof(pldm_msg_hdr)] == PLDM_SUCCESS)
+            {
+                updateScheduler.transferred(
+                    eid, fwDataResponse.size() - fwDataOffset);
+            }
+            return fwDataResponse;
         }
         else if (command == PLDM_TRANSFER_COMPLETE)
         {
@@ -987,10 +1195,15 @@ Response UpdateManager::handleRequest(mctp_eid_t eid, uint8_t command,
 software::Activation::Activations UpdateManager::activatePackage()
 {
     namespace software = sdbusplus::xyz::openbmc_project::Software::server;
-    createProgressUpdateTimer();
-    progressTimer->start(std::chrono::minutes(PROGRESS_UPDATE_INTERVAL), true);
-    activationBlocksTransition = std::make_unique<ActivationBlocksTransition>(
-        pldm::utils::DBusHandler::getBus(), objPath, this);
+    if (pldmUpdateStarted)
+    {
+        // the PLDM firmware update started while the package was verified
+        pldmUpdateStarted = false;
+        return startNonPLDMUpdate() == software::Activation::Activations::Failed
+                   ? software::Activation::Activations::Failed
+                   : software::Activation::Activations::Activating;
+    }
+    prepareActivation();
 #ifdef DEBUG_TOKEN
     debugToken =
         std::make_unique<DebugToken>(pldm::utils::DBusHandler::getBus(), this);
@@ -1008,8 +1221,17 @@ software::Activation::Activations UpdateManager::activatePackage()
     return software::Activation::Activations::Activating;
 }
 
+void UpdateManager::prepareActivation()
+{
+    createProgressUpdateTimer();
+    progressTimer->start(std::chrono::minutes(PROGRESS_UPDATE_INTERVAL), true);
+    activationBlocksTransition = std::make_unique<ActivationBlocksTransition>(
+        pldm::utils::DBusHandler::getBus(), objPath, this);
+}
+
 void UpdateManager::startPLDMUpdate()
 {
+    updateScheduler.clear();
     for (const auto& [eid, deviceUpdaterPtr] : deviceUpdaterMap)
     {
         const auto& applicableComponents =
@@ -1020,8 +1242,24 @@ void UpdateManager::startPLDMUpdate()
             createMessageRegistry(eid, deviceUpdaterPtr->fwDeviceIDRecord,
                                   compIndex, targetDetermined);
         }
-        deviceUpdaterPtr->startFwUpdateFlow();
+
+        // the devices with an unknown bus share a bus of their own
+        auto search = mctpBusMap.find(eid);
+        if (search != mctpBusMap.end())
+        {
+            updateScheduler.schedule(eid, search->second.first,
+                                     search->second.second);
+        }
+        else
+        {
+            updateScheduler.schedule(eid, {}, {});
+        }
     }
+    // firmware-update-time is the time to update the devices updated at the
+    // same time, the queued devices are updated in further rounds
+    totalInterval = FIRMWARE_UPDATE_TIME / PROGRESS_UPDATE_INTERVAL *
+                    updateScheduler.getRounds();
+    updateScheduler.start();
 }
 
 software::Activation::Activations UpdateManager::startNonPLDMUpdate()
@@ -1069,10 +1307,18 @@ void UpdateManager::clearActivationInfo()
     objPath.clear();
     fwDeviceIDRecords.clear();
 
+    updateScheduler.clear();
     deviceUpdaterMap.clear();
     deviceUpdateCompletionMap.clear();
     parser.reset();
     package.close();
+    packageReader.reset();
+    // stops the digest worker before its package stream is closed
+    packageSignatureParser.reset();
+    verificationPackage.close();
+    pldmUpdateStarted = false;
+    verificationPending = false;
+    verificationFailed = false;
     clearFirmwareUpdatePackage();
     totalNumComponentUpdates = 0;
     compUpdateCompletedCount = 0;
@@ -1166,7 +1412,9 @@ void UpdateManager::updatePackageCompletion()
 void UpdateManager::updateActivationProgress()
 {
     compUpdateCompletedCount++;
-    if (compUpdateCompletedCount == totalNumComponentUpdates)
+    // the progress timer is stopped if the package verification failed
+    // during the transfer
+    if (compUpdateCompletedCount == totalNumComponentUpdates && progressTimer)
     {
         progressTimer->stop();
         progressTimer.reset();
@@ -1229,6 +1477,11 @@ void UpdateManager::resetActivationBlocksTransition()
 void UpdateManager::clearFirmwareUpdatePackage()
 {
     package.close();
+    packageReader.reset();
+    if (streamingDigest && streamingDigest->matches(fwPackageFilePath))
+    {
+        streamingDigest.reset();
+    }
     // do not remove staged package after update complete, there is a redfish
     // api to delete and delete intf handler will do that.
     if (fwPackageFilePath != stagedfwPackageFilePath)
@@ -1237,6 +1490,58 @@ void UpdateManager::clearFirmwareUpdatePackage()
     }
 }
 
+void UpdateManager::mapPackage(const std::filesystem::path& packageFilePath)
+{
+    packageReader = std::make_unique<PackageReader>(packageFilePath);
+    if (!packageReader->valid())
+    {
+        // RequestFirmwareData is served from the package stream
+        packageReader.reset();
+    }
+}
+
+std::optional<std::vector<unsigned char>> UpdateManager::getStreamedDigest(
+    const std::filesystem::path& packageFilePath, uintmax_t sizeOfSignedData)
+{
+    if (!streamingDigest || !packageSignatureParser ||
+        streamingDigest->getDigestName() !=
+            packageSignatureParser->getDigestName() ||
+        !streamingDigest->matches(packageFilePath))
+    {
+        return std::nullopt;
+    }
+
+    auto digest = streamingDigest->digest(sizeOfSignedData);
+    if (digest)
+    {
+        lg2::info("Using the digest of the FW package calculated while it was "
+                  "staged");
+    }
+    return digest;
+}
+
+std::vector<uint8_t>
+    UpdateManager::readPackageHeader(const std::filesystem::path& packageFilePath,
+                                     size_t size)
+{
+    std::vector<uint8_t> packageHeader(size);
+#ifndef PLDM_PACKAGE_VERIFICATION
+    // the header parsed for the update must be the one the signature is
+    // verified on, so it is read back from an authenticated package
+    if (streamingDigest && streamingDigest->getHeader().size() >= size &&
+        streamingDigest->matches(packageFilePath))
+    {
+        const auto& header = streamingDigest->getHeader();
+        std::copy_n(header.begin(), size, packageHeader.begin());
+        return packageHeader;
+    }
+#endif
+
+    package.seekg(0);
+    package.read(reinterpret_cast<char*>(packageHeader.data()), size);
+    return packageHeader;
+}
+
 void UpdateManager::setActivationStatus(
     const software::Activation::Activations& state)
 {
@@ -1328,7 +1633,16 @@ void UpdateManager::updateStagedPackageProperties(
         std::make_unique<PackageSignatureSha384>();
     try
     {
-        auto digestVector = signatureSha->calculateDigest(package, packageSize);
+        std::optional<std::vector<unsigned char>> streamedDigest;
+        if (streamingDigest &&
+            streamingDigest->getDigestName() == packageSignatureSha384Name &&
+            streamingDigest->matches(stagedfwPackageFilePath))
+        {
+            streamedDigest = streamingDigest->digest(packageSize);
+        }
+        auto digestVector =
+            streamedDigest ? *streamedDigest
+                           : signatureSha->calculateDigest(package, packageSize);
         std::ostringstream tempStream;
         for (int byte : digestVector)
         {
@@ -1401,21 +1715,15 @@ int UpdateManager::processStagedPackage(
         return -1;
     }
 
-    package.seekg(0);
-    std::vector<uint8_t> packageHeader(sizeof(pldm_package_header_information));
-    package.read(reinterpret_cast<char*>(packageHeader.data()),
-                 sizeof(pldm_package_header_information));
+    auto packageHeader = readPackageHeader(
+        packageFilePath, sizeof(pldm_package_header_information));
 
     auto pkgHeaderInfo =
         reinterpret_cast<const pldm_package_header_information*>(
             packageHeader.data());
     auto pkgHeaderInfoSize = sizeof(pldm_package_header_information) +
                              pkgHeaderInfo->package_version_string_length;
-    packageHeader.clear();
-    packageHeader.resize(pkgHeaderInfoSize);
-    package.seekg(0);
-    package.read(reinterpret_cast<char*>(packageHeader.data()),
-                 pkgHeaderInfoSize);
+    packageHeader = readPackageHeader(packageFilePath, pkgHeaderInfoSize);
 
     parser = parsePkgHeader(packageHeader);
     if (parser == nullptr)
@@ -1425,10 +1733,7 @@ int UpdateManager::processStagedPackage(
         return -1;
     }
 
-    package.seekg(0);
-    packageHeader.resize(parser->pkgHeaderSize);
-    package.read(reinterpret_cast<char*>(packageHeader.data()),
-                 parser->pkgHeaderSize);
+    packageHeader = readPackageHeader(packageFilePath, parser->pkgHeaderSize);
     try
     {
         parser->parse(packageHeader, packageSize);
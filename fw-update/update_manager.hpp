@@ -24,16 +24,21 @@
 #include "error_handling.hpp"
 #include "other_device_update_manager.hpp"
 #include "package_parser.hpp"
+#include "package_reader.hpp"
 #include "package_signature.hpp"
 #include "pldmd/dbus_impl_requester.hpp"
 #include "requester/handler.hpp"
+#include "streaming_digest.hpp"
+#include "update_scheduler.hpp"
 #include "watch.hpp"
 
 #include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <optional>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #ifdef OEM_NVIDIA
 #include "oem-nvidia/debug_token.hpp"
@@ -88,7 +93,8 @@ class UpdateManager
         pldm::requester::Handler<pldm::requester::Request>& handler,
         Requester& requester, const DescriptorMap& descriptorMap,
         const ComponentInfoMap& componentInfoMap,
-        ComponentNameMap& componentNameMap, bool fwDebug);
+        ComponentNameMap& componentNameMap, const MctpBusMap& mctpBusMap,
+        bool fwDebug);
 
     /** @brief Handle PLDM request for the commands in the FW update
      *         specification
@@ -319,6 +325,36 @@ class UpdateManager
     bool isStageOnlyUpdate;
 
     bool fwDebug;
+
+    /**
+     * @brief Map the firmware update package for the ComponentUpdaters to
+     *        serve RequestFirmwareData from
+     *
+     * @param[in] packageFilePath - package file path
+     */
+    void mapPackage(const std::filesystem::path& packageFilePath);
+
+    /**
+     * @brief Get the mapping of the firmware update package
+     *
+     * @return the mapping, nullptr if the package is not mapped
+     */
+    const PackageReader* getPackageReader() const
+    {
+        return packageReader.get();
+    }
+
+    /**
+     * @brief Set the digest of the package calculated while it was written
+     *        to the staging directory
+     *
+     * @param[in] digest - digest of the package
+     */
+    void setStreamingDigest(std::unique_ptr<StreamingDigest> digest)
+    {
+        streamingDigest = std::move(digest);
+    }
+
     /**
      * @brief start pldm firmware update
      *
@@ -382,6 +418,7 @@ class UpdateManager
     void closePackage()
     {
         package.close();
+        packageReader.reset();
     }
 
     /**
@@ -410,6 +447,49 @@ class UpdateManager
 
     std::unique_ptr<PackageSignature> packageSignatureParser;
 
+    /**
+     * @brief Asynchronous signature verification of firmware package using
+     *        the public key stored on the machine
+     *
+     * @param[in] onComplete - callback invoked with the verification result
+     * @param[in] onError - callback invoked if the verification failed with
+     *                      an exception
+     */
+    void verifyPackageAsync(
+        std::function<void(bool)> onComplete,
+        std::function<void(const std::string& errorMsg)> onError);
+
+    /**
+     * @brief Check if the package verification runs alongside the PLDM
+     *        firmware transfer and the activation is held until it passes
+     *
+     * @return true if the verification is in progress
+     */
+    bool isVerificationPending() const
+    {
+        return verificationPending;
+    }
+
+    /**
+     * @brief Check if the package verification which ran alongside the PLDM
+     *        firmware transfer failed, the update is cancelled
+     *
+     * @return true if the verification failed
+     */
+    bool isVerificationFailed() const
+    {
+        return verificationFailed;
+    }
+
+    /**
+     * @brief Complete the package verification running alongside the PLDM
+     *        firmware transfer, the DeviceUpdaters held after the last
+     *        component activate the firmware or cancel the update
+     *
+     * @param[in] passed - true if the package verification passed
+     */
+    void verificationCompleted(bool passed);
+
   private:
     /** @brief Device identifiers of the managed FDs */
     const DescriptorMap& descriptorMap;
@@ -417,6 +497,8 @@ class UpdateManager
     const ComponentInfoMap& componentInfoMap;
     /** @brief Component information needed for the update of the managed FDs */
     const ComponentNameMap& componentNameMap;
+    /** @brief MCTP medium and binding type of the managed FDs */
+    const MctpBusMap& mctpBusMap;
     Watch watch;
     std::unique_ptr<Activation> activation;
     std::unique_ptr<ActivationProgress> activationProgress;
@@ -434,6 +516,62 @@ class UpdateManager
     std::unique_ptr<PackageParser> parser;
     std::ifstream package;
 
+    /** @brief Package stream read by the digest worker thread, separate from
+     *         the stream serving the firmware transfer
+     */
+    std::ifstream verificationPackage;
+
+    /** @brief The PLDM firmware update is started before the activation
+     *         while the package is verified
+     */
+    bool pldmUpdateStarted = false;
+
+    /** @brief The package verification runs alongside the transfer */
+    bool verificationPending = false;
+
+    /** @brief The package verification which ran alongside the transfer
+     *         failed
+     */
+    bool verificationFailed = false;
+
+    /** @brief Mapping of the package shared by the ComponentUpdaters */
+    std::unique_ptr<PackageReader> packageReader;
+
+    /** @brief Digest of the last package written to the staging directory */
+    std::unique_ptr<StreamingDigest> streamingDigest;
+
+    /** @brief Limits the number of devices updated at the same time over an
+     *         MCTP bus
+     */
+    UpdateScheduler updateScheduler;
+
+    /**
+     * @brief Get the streamed digest of the signed data of the package, for
+     *        the integrity check and the staged package hash only
+     *
+     * @param[in] packageFilePath - package file path
+     * @param[in] sizeOfSignedData - size of the signed data
+     *
+     * @return the digest, std::nullopt if the package has to be read back
+     */
+    std::optional<std::vector<unsigned char>>
+        getStreamedDigest(const std::filesystem::path& packageFilePath,
+                          uintmax_t sizeOfSignedData);
+
+    /**
+     * @brief Read the beginning of the package header, from the streamed
+     *        package header if it is available and the package is not
+     *        authenticated
+     *
+     * @param[in] packageFilePath - package file path
+     * @param[in] size - size of the data to read
+     *
+     * @return the package header data
+     */
+    std::vector<uint8_t>
+        readPackageHeader(const std::filesystem::path& packageFilePath,
+                          size_t size);
+
     std::unordered_map<mctp_eid_t, std::unique_ptr<DeviceUpdater>>
         deviceUpdaterMap;
     std::unordered_map<mctp_eid_t, bool> deviceUpdateCompletionMap;
@@ -476,14 +614,13 @@ class UpdateManager
      * @brief Counter to keep track of update progress interval
      *
      */
-    uint8_t updateInterval;
+    size_t updateInterval;
 
     /**
      * @brief Total intervals to update progress percent
      *
      */
-    uint8_t totalInterval = static_cast<uint8_t>(
-        std::floor((FIRMWARE_UPDATE_TIME / PROGRESS_UPDATE_INTERVAL)));
+    size_t totalInterval = FIRMWARE_UPDATE_TIME / PROGRESS_UPDATE_INTERVAL;
 
     /**
      * @brief Create a Progress Update Timer. This timer updates progress
@@ -493,6 +630,38 @@ class UpdateManager
      */
     void createProgressUpdateTimer();
 
+    /**
+     * @brief Start the progress timer and block the BMC reboot for the
+     *        activation
+     *
+     */
+    void prepareActivation();
+
+    /**
+     * @brief Open the stream the digest worker thread reads the package from
+     *
+     * @return true on success
+     */
+    bool openVerificationPackage();
+
+    /**
+     * @brief Start the PLDM firmware transfer while the package is verified,
+     *        if enabled. RequestUpdate, PassComponentTable and the transfer
+     *        proceed, the DeviceUpdaters hold ActivateFirmware until the
+     *        verification passes and cancel the update if it fails.
+     *
+     * @param[in] onComplete - callback invoked with the verification result
+     * @param[in] onError - callback invoked if the verification failed with
+     *                      an exception
+     *
+     * @return the callbacks to pass to the verification
+     */
+    std::pair<std::function<void(bool)>,
+              std::function<void(const std::string& errorMsg)>>
+        pipelineSecurityChecks(
+            std::function<void(bool)> onComplete,
+            std::function<void(const std::string& errorMsg)> onError);
+
     /**
      * @brief update staged package properties in D-Bus path
      *
@@ -0,0 +1,199 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "update_scheduler.hpp"
+
+#include "inventory_manager.hpp"
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace pldm
+{
+
+namespace fw_update
+{
+
+/** @brief Order of the buses by bandwidth, the same as the endpoints of a
+ *         device are ordered by the InventoryManager
+ */
+static std::pair<Priority, Priority>
+    getBusPriority(const std::pair<MctpMedium, MctpBinding>& bus)
+{
+    constexpr auto lowest = std::numeric_limits<Priority>::max();
+    auto medium = mediumPriority.find(bus.first);
+    auto binding = bindingPriority.find(bus.second);
+    return {medium != mediumPriority.end() ? medium->second : lowest,
+            binding != bindingPriority.end() ? binding->second : lowest};
+}
+
+void UpdateScheduler::schedule(EID eid, const MctpMedium& medium,
+                               const MctpBinding& binding)
+{
+    Bus bus{medium, binding};
+    devices[eid] = Device{bus, false, false, {}, {}};
+    buses[bus].queued.emplace_back(eid);
+}
+
+void UpdateScheduler::start()
+{
+    std::vector<Bus> order;
+    for (const auto& [bus, busQueue] : buses)
+    {
+        order.emplace_back(bus);
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [](const Bus& lhs, const Bus& rhs) {
+        return getBusPriority(lhs) < getBusPriority(rhs);
+    });
+
+    for (const auto& bus : order)
+    {
+        startQueued(bus);
+    }
+}
+
+void UpdateScheduler::startQueued(const Bus& bus)
+{
+    auto& busQueue = buses[bus];
+    // a device failing to start completes from the callback, which starts
+    // the next device of the bus itself
+    while (!busQueue.queued.empty() &&
+           (!maxUpdatesPerBus || busQueue.running < maxUpdatesPerBus))
+    {
+        auto eid = busQueue.queued.front();
+        busQueue.queued.pop_front();
+        busQueue.running++;
+
+        auto& device = devices[eid];
+        device.started = true;
+        device.startTime = std::chrono::steady_clock::now();
+        if (maxUpdatesPerBus)
+        {
+            lg2::info(
+                "Start the firmware update, EID={EID}, MEDIUM={MEDIUM}, BINDING={BINDING}, RUNNING={RUNNING}, QUEUED={QUEUED}",
+                "EID", eid, "MEDIUM", bus.first, "BINDING", bus.second,
+                "RUNNING", busQueue.running, "QUEUED", busQueue.queued.size());
+        }
+        startCallback(eid);
+    }
+}
+
+void UpdateScheduler::transferred(EID eid, size_t bytes)
+{
+    auto search = devices.find(eid);
+    if (search != devices.end())
+    {
+        search->second.statistics.bytes += bytes;
+    }
+}
+
+void UpdateScheduler::completed(EID eid)
+{
+    auto search = devices.find(eid);
+    if (search == devices.end() || !search->second.started ||
+        search->second.completed)
+    {
+        return;
+    }
+
+    auto& device = search->second;
+    device.completed = true;
+    device.statistics.duration =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - device.startTime);
+    auto durationInMs = device.statistics.duration.count();
+    lg2::info(
+        "Firmware update of the device completed, EID={EID}, MEDIUM={MEDIUM}, BINDING={BINDING}, BYTES={BYTES}, TIME_MS={TIME_MS}, THROUGHPUT_BPS={THROUGHPUT_BPS}",
+        "EID", eid, "MEDIUM", device.bus.first, "BINDING", device.bus.second,
+        "BYTES", device.statistics.bytes, "TIME_MS", durationInMs,
+        "THROUGHPUT_BPS",
+        durationInMs ? device.statistics.bytes * 1000 / durationInMs : 0);
+
+    auto bus = device.bus;
+    auto& busQueue = buses[bus];
+    if (busQueue.running)
+    {
+        busQueue.running--;
+    }
+    startQueued(bus);
+}
+
+void UpdateScheduler::cancel()
+{
+    for (auto& [bus, busQueue] : buses)
+    {
+        if (!busQueue.queued.empty())
+        {
+            lg2::info(
+                "Firmware update of the queued devices is cancelled, MEDIUM={MEDIUM}, BINDING={BINDING}, QUEUED={QUEUED}",
+                "MEDIUM", bus.first, "BINDING", bus.second, "QUEUED",
+                busQueue.queued.size());
+        }
+        busQueue.queued.clear();
+    }
+}
+
+void UpdateScheduler::clear()
+{
+    buses.clear();
+    devices.clear();
+}
+
+size_t UpdateScheduler::getRunning(const MctpMedium& medium,
+                                   const MctpBinding& binding) const
+{
+    auto search = buses.find({medium, binding});
+    return search != buses.end() ? search->second.running : 0;
+}
+
+size_t UpdateScheduler::getQueued(const MctpMedium& medium,
+                                  const MctpBinding& binding) const
+{
+    auto search = buses.find({medium, binding});
+    return search != buses.end() ? search->second.queued.size() : 0;
+}
+
+size_t UpdateScheduler::getRounds() const
+{
+    size_t rounds = 1;
+    if (!maxUpdatesPerBus)
+    {
+        return rounds;
+    }
+
+    for (const auto& [bus, busQueue] : buses)
+    {
+        auto numDevices = busQueue.running + busQueue.queued.size();
+        rounds = std::max(rounds, (numDevices + maxUpdatesPerBus - 1) /
+                                      maxUpdatesPerBus);
+    }
+    return rounds;
+}
+
+DeviceUpdateStatistics UpdateScheduler::getStatistics(EID eid) const
+{
+    auto search = devices.find(eid);
+    return search != devices.end() ? search->second.statistics
+                                   : DeviceUpdateStatistics{};
+}
+
+} // namespace fw_update
+
+} // namespace pldm
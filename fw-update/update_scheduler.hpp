@@ -0,0 +1,180 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "common/types.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+namespace pldm
+{
+
+namespace fw_update
+{
+
+/** @brief MCTP medium and binding type of the endpoints, by EID */
+using MctpBusMap = std::unordered_map<EID, std::pair<MctpMedium, MctpBinding>>;
+
+/** @struct DeviceUpdateStatistics
+ *
+ *  Firmware data transferred to a device and the time the update of the
+ *  device took since it was started by the UpdateScheduler.
+ */
+struct DeviceUpdateStatistics
+{
+    uint64_t bytes = 0;
+    std::chrono::milliseconds duration{};
+};
+
+/** @class UpdateScheduler
+ *
+ *  Starts the firmware update of the devices grouped by the MCTP medium and
+ *  binding type they are reached through. At most maxUpdatesPerBus devices
+ *  are updated at the same time over a bus, the next device queued for the
+ *  bus is started once one completes. The buses are independent, so devices
+ *  behind a slow SMBus don't hold back the devices reached over PCIe.
+ */
+class UpdateScheduler
+{
+  public:
+    using StartCallback = std::function<void(EID)>;
+
+    UpdateScheduler() = delete;
+    UpdateScheduler(const UpdateScheduler&) = delete;
+    UpdateScheduler(UpdateScheduler&&) = delete;
+    UpdateScheduler& operator=(const UpdateScheduler&) = delete;
+    UpdateScheduler& operator=(UpdateScheduler&&) = delete;
+
+    /** @brief Constructor
+     *
+     *  @param[in] maxUpdatesPerBus - maximum number of devices updated at the
+     *                                same time over a bus, 0 for no limit
+     *  @param[in] startCallback - starts the firmware update of a device
+     */
+    UpdateScheduler(size_t maxUpdatesPerBus, StartCallback startCallback) :
+        maxUpdatesPerBus(maxUpdatesPerBus),
+        startCallback(std::move(startCallback))
+    {}
+
+    /** @brief Queue the firmware update of a device
+     *
+     *  @param[in] eid - MCTP endpoint ID of the device
+     *  @param[in] medium - MCTP medium type the device is reached through
+     *  @param[in] binding - MCTP binding type the device is reached through
+     */
+    void schedule(EID eid, const MctpMedium& medium,
+                  const MctpBinding& binding);
+
+    /** @brief Start the queued firmware updates, the buses with the higher
+     *         bandwidth first
+     */
+    void start();
+
+    /** @brief Account the firmware data transferred to a device
+     *
+     *  @param[in] eid - MCTP endpoint ID of the device
+     *  @param[in] bytes - size of the firmware data
+     */
+    void transferred(EID eid, size_t bytes);
+
+    /** @brief Complete the firmware update of a device and start the next
+     *         device queued for the bus
+     *
+     *  @param[in] eid - MCTP endpoint ID of the device
+     */
+    void completed(EID eid);
+
+    /** @brief Drop the queued firmware updates, the devices being updated
+     *         are not affected
+     */
+    void cancel();
+
+    /** @brief Clear the scheduled devices and their statistics */
+    void clear();
+
+    /** @brief Get the number of devices being updated over a bus
+     *
+     *  @param[in] medium - MCTP medium type
+     *  @param[in] binding - MCTP binding type
+     */
+    size_t getRunning(const MctpMedium& medium,
+                      const MctpBinding& binding) const;
+
+    /** @brief Get the number of devices queued for a bus
+     *
+     *  @param[in] medium - MCTP medium type
+     *  @param[in] binding - MCTP binding type
+     */
+    size_t getQueued(const MctpMedium& medium,
+                     const MctpBinding& binding) const;
+
+    /** @brief Get the number of rounds the bus with the most devices takes
+     *         to update them, maxUpdatesPerBus devices at a time
+     *
+     *  A device keeps its slot until its update completes. In a stage-only
+     *  update that is UPDATE_MODE_IDLE_TIMEOUT after its components are
+     *  transferred, once the device leaves update mode.
+     *
+     *  @return the number of rounds, at least 1
+     */
+    size_t getRounds() const;
+
+    /** @brief Get the statistics of the firmware update of a device
+     *
+     *  @param[in] eid - MCTP endpoint ID of the device
+     *
+     *  @return the statistics, empty if the device is not scheduled
+     */
+    DeviceUpdateStatistics getStatistics(EID eid) const;
+
+  private:
+    using Bus = std::pair<MctpMedium, MctpBinding>;
+
+    struct BusQueue
+    {
+        std::deque<EID> queued;
+        size_t running = 0;
+    };
+
+    struct Device
+    {
+        Bus bus;
+        bool started = false;
+        bool completed = false;
+        std::chrono::steady_clock::time_point startTime;
+        DeviceUpdateStatistics statistics;
+    };
+
+    /** @brief Start the queued devices of the bus up to the limit */
+    void startQueued(const Bus& bus);
+
+    size_t maxUpdatesPerBus;
+    StartCallback startCallback;
+    std::map<Bus, BusQueue> buses;
+    std::unordered_map<EID, Device> devices;
+};
+
+} // namespace fw_update
+
+} // namespace pldm
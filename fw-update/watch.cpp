@@ -22,10 +22,13 @@
 #include <unistd.h>
 
 #include <phosphor-logging/lg2.hpp>
+#include <sdeventplus/event.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <filesystem>
+#include <iterator>
 #include <regex>
 #include <stdexcept>
 #include <string>
@@ -40,6 +43,13 @@ namespace fw_update
 using namespace std::string_literals;
 namespace fs = std::filesystem;
 
+#ifdef PLDM_PACKAGE_STREAMING_DIGEST
+// the package is hashed on every write to the staging directory
+constexpr uint32_t watchMask = IN_CLOSE_WRITE | IN_MODIFY;
+#else
+constexpr uint32_t watchMask = IN_CLOSE_WRITE;
+#endif
+
 Watch::Watch(sd_event* loop,
              std::function<int(std::string&)> imageCallbackImmediate,
              std::function<int(std::string&)> imageCallbackSplitStage,
@@ -51,6 +61,16 @@ Watch::Watch(sd_event* loop,
 
 Watch::~Watch()
 {
+    if (worker)
+    {
+        // wake the worker up to return, it is joined when it is destroyed
+        {
+            std::lock_guard<std::mutex> lock(streamMutex);
+            worker->cancel();
+        }
+        streamCondition.notify_all();
+    }
+
     if (-1 != fdImmediate)
     {
         if (-1 != wdImmediate)
@@ -92,20 +112,30 @@ int Watch::callbackImmediate(sd_event_source* /* s */, int fd, uint32_t revents,
     while (offset < bytes)
     {
         auto event = reinterpret_cast<inotify_event*>(&buffer[offset]);
+        if ((event->mask & IN_MODIFY) && !(event->mask & IN_ISDIR))
+        {
+            static_cast<Watch*>(userdata)->streamPackage(
+                std::string{FIRMWARE_PACKAGE_STAGING_DIR} + '/' + event->name,
+                event->mask);
+        }
         if ((event->mask & IN_CLOSE_WRITE) && !(event->mask & IN_ISDIR))
         {
             auto tarballPath =
                 std::string{FIRMWARE_PACKAGE_STAGING_DIR} + '/' + event->name;
-            lg2::info("Received event for new file in immediate path "
-                      "{IMMEDIATE_FILE_PATH}",
-                      "IMMEDIATE_FILE_PATH", tarballPath);
-            auto rc = static_cast<Watch*>(userdata)->imageCallbackImmediate(
-                tarballPath);
-            if (rc < 0)
-            {
-                // log<level::ERR>("Error processing image",
-                //                 entry("IMAGE=%s", tarballPath.c_str()));
-            }
+            auto watch = static_cast<Watch*>(userdata);
+            watch->streamPackage(
+                tarballPath, event->mask, [watch, tarballPath]() mutable {
+                    lg2::info("Received event for new file in immediate path "
+                              "{IMMEDIATE_FILE_PATH}",
+                              "IMMEDIATE_FILE_PATH", tarballPath);
+                    auto rc = watch->imageCallbackImmediate(tarballPath);
+                    if (rc < 0)
+                    {
+                        // log<level::ERR>("Error processing image",
+                        //                 entry("IMAGE=%s",
+                        //                 tarballPath.c_str()));
+                    }
+                });
         }
 
         offset += offsetof(inotify_event, name) + event->len;
@@ -140,20 +170,30 @@ int Watch::callbackSplitStaged(sd_event_source* /* s */, int fd,
     while (offset < bytes)
     {
         auto event = reinterpret_cast<inotify_event*>(&buffer[offset]);
+        if ((event->mask & IN_MODIFY) && !(event->mask & IN_ISDIR))
+        {
+            static_cast<Watch*>(userdata)->streamPackage(
+                std::string{FIRMWARE_PACKAGE_SPLIT_STAGING_DIR} + '/' +
+                    event->name,
+                event->mask);
+        }
         if ((event->mask & IN_CLOSE_WRITE) && !(event->mask & IN_ISDIR))
         {
             auto tarballPath = std::string{FIRMWARE_PACKAGE_SPLIT_STAGING_DIR} +
                                '/' + event->name;
-            lg2::info("Received event for new file in staged path "
-                      "{STAGE_FILE_PATH}",
-                      "STAGE_FILE_PATH", tarballPath);
-            auto rc = static_cast<Watch*>(userdata)->imageCallbackSplitStage(
-                tarballPath);
-            if (rc < 0)
-            {
-                lg2::error("Error processing image {STAGE_FILE_PATH}",
-                           "STAGE_FILE_PATH", tarballPath);
-            }
+            auto watch = static_cast<Watch*>(userdata);
+            watch->streamPackage(
+                tarballPath, event->mask, [watch, tarballPath]() mutable {
+                    lg2::info("Received event for new file in staged path "
+                              "{STAGE_FILE_PATH}",
+                              "STAGE_FILE_PATH", tarballPath);
+                    auto rc = watch->imageCallbackSplitStage(tarballPath);
+                    if (rc < 0)
+                    {
+                        lg2::error("Error processing image {STAGE_FILE_PATH}",
+                                   "STAGE_FILE_PATH", tarballPath);
+                    }
+                });
         }
 
         offset += offsetof(inotify_event, name) + event->len;
@@ -256,7 +296,7 @@ void Watch::addFileEventWatchImmediate()
     }
 
     wdImmediate = inotify_add_watch(fdImmediate, FIRMWARE_PACKAGE_STAGING_DIR,
-                                    IN_CLOSE_WRITE);
+                                    watchMask);
     if (-1 == wdImmediate)
     {
         auto error = errno;
@@ -313,7 +353,7 @@ void Watch::addFileEventWatchStaged()
     }
 
     wdSplitStage = inotify_add_watch(
-        fdSplitStage, FIRMWARE_PACKAGE_SPLIT_STAGING_DIR, IN_CLOSE_WRITE);
+        fdSplitStage, FIRMWARE_PACKAGE_SPLIT_STAGING_DIR, watchMask);
     if (-1 == wdSplitStage)
     {
         auto error = errno;
@@ -331,6 +371,159 @@ void Watch::addFileEventWatchStaged()
     }
 }
 
+void Watch::streamPackage(const std::string& imagePath, uint32_t mask,
+                          std::function<void()> onClosed)
+{
+    std::unique_lock<std::mutex> lock(streamMutex);
+    auto it = streamedPackages.find(imagePath);
+    if ((mask & IN_MODIFY) && it == streamedPackages.end())
+    {
+        StreamedPackage streamed;
+        streamed.digest = std::make_unique<StreamingDigest>(
+            imagePath, packageSignatureSha384Name);
+        it = streamedPackages.emplace(imagePath, std::move(streamed)).first;
+
+        if (!worker)
+        {
+            // pread and the SHA-384 of a large package would stall the event
+            // loop, which also drives the MCTP transfers and the sensor
+            // polling
+            try
+            {
+                sdeventplus::Event event(loop);
+                worker = std::make_unique<pldm::utils::WorkerThread>(
+                    event, [this]() { packagesHashed(); });
+                if (!worker->canNotify() ||
+                    !worker->start([this]() { hashPackages(); }))
+                {
+                    worker.reset();
+                }
+            }
+            catch (const std::exception& e)
+            {
+                lg2::error("Failed to start hashing the FW package off the "
+                           "event loop, {ERROR}",
+                           "ERROR", e);
+                worker.reset();
+            }
+        }
+    }
+
+    if (it == streamedPackages.end())
+    {
+        lock.unlock();
+        if (onClosed)
+        {
+            onClosed();
+        }
+        return;
+    }
+
+    auto& streamed = it->second;
+    if (mask & IN_CLOSE_WRITE)
+    {
+        streamed.closed = true;
+        if (onClosed)
+        {
+            streamed.onHashed.emplace_back(std::move(onClosed));
+        }
+    }
+
+    if (worker && !streamed.done)
+    {
+        streamed.updateRequested = true;
+        lock.unlock();
+        streamCondition.notify_one();
+        return;
+    }
+
+    if (!worker)
+    {
+        // a package which can't be hashed is read back once it is closed
+        streamed.hashed = streamed.digest->update();
+    }
+
+    if (streamed.closed)
+    {
+        auto callbacks = finishPackage(it);
+        lock.unlock();
+        for (auto& callback : callbacks)
+        {
+            callback();
+        }
+    }
+}
+
+void Watch::hashPackages()
+{
+    std::unique_lock<std::mutex> lock(streamMutex);
+    while (!worker->isCancelled())
+    {
+        auto it = std::ranges::find_if(streamedPackages, [](const auto& entry) {
+            return entry.second.updateRequested && !entry.second.done;
+        });
+        if (it == streamedPackages.end())
+        {
+            streamCondition.wait(lock);
+            continue;
+        }
+
+        // the event loop doesn't touch the digest until the package is done,
+        // and doesn't remove the package either
+        auto& streamed = it->second;
+        streamed.updateRequested = false;
+        auto closed = streamed.closed;
+        lock.unlock();
+        auto hashed = streamed.digest->update();
+        lock.lock();
+
+        if (!hashed || closed)
+        {
+            streamed.hashed = hashed;
+            streamed.done = true;
+            worker->notify();
+        }
+    }
+}
+
+void Watch::packagesHashed()
+{
+    std::vector<std::function<void()>> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(streamMutex);
+        for (auto it = streamedPackages.begin(); it != streamedPackages.end();)
+        {
+            // a package which can't be hashed is kept until it is closed
+            if (!it->second.done || !it->second.closed)
+            {
+                ++it;
+                continue;
+            }
+            auto next = std::next(it);
+            std::ranges::move(finishPackage(it), std::back_inserter(callbacks));
+            it = next;
+        }
+    }
+
+    for (auto& callback : callbacks)
+    {
+        callback();
+    }
+}
+
+std::vector<std::function<void()>> Watch::finishPackage(
+    std::map<std::string, StreamedPackage>::iterator it)
+{
+    auto& streamed = it->second;
+    if (streamed.hashed)
+    {
+        updateManager->setStreamingDigest(std::move(streamed.digest));
+    }
+    auto callbacks = std::move(streamed.onHashed);
+    streamedPackages.erase(it);
+    return callbacks;
+}
+
 bool Watch::isServiceCompleted(const std::string& serviceName)
 {
     using namespace pldm::utils;
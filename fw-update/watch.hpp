@@ -20,11 +20,18 @@
 
 #include "common/types.hpp"
 #include "common/utils.hpp"
+#include "common/worker_thread.hpp"
+#include "streaming_digest.hpp"
 
 #include <systemd/sd-event.h>
 
+#include <condition_variable>
 #include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace pldm
 {
@@ -146,6 +153,73 @@ class Watch
      * @return false - if service is running or failed
      */
     bool isServiceCompleted(const std::string& serviceName);
+
+    /**
+     * @brief hash the package while it is written and hand the digest over
+     *        to the UpdateManager once the package is closed
+     *
+     * The package is hashed on the worker thread, the package is processed
+     * by onClosed once the data written up to the close is hashed.
+     *
+     * @param[in] imagePath - path of the package
+     * @param[in] mask - inotify event mask
+     * @param[in] onClosed - processes the package, for IN_CLOSE_WRITE
+     */
+    void streamPackage(const std::string& imagePath, uint32_t mask,
+                       std::function<void()> onClosed = {});
+
+    /** @brief Hash the packages being written, the job of the worker */
+    void hashPackages();
+
+    /** @brief Hand the digests of the closed packages over to the
+     *         UpdateManager and process the packages, invoked on the event
+     *         loop by the worker
+     */
+    void packagesHashed();
+
+    /** @brief a package being written */
+    struct StreamedPackage
+    {
+        std::unique_ptr<StreamingDigest> digest;
+
+        /** @brief the package is written since the worker last hashed it */
+        bool updateRequested = false;
+
+        /** @brief the package is closed */
+        bool closed = false;
+
+        /** @brief the worker is done with the package, it is either closed
+         *         or can't be hashed
+         */
+        bool done = false;
+
+        /** @brief false if the package can't be hashed */
+        bool hashed = true;
+
+        /** @brief process the package once it is hashed, on the event loop */
+        std::vector<std::function<void()>> onHashed;
+    };
+
+    /** @brief Remove the package and hand its digest over to the
+     *         UpdateManager, called with streamMutex held
+     *
+     *  @return the callbacks processing the package
+     */
+    std::vector<std::function<void()>> finishPackage(
+        std::map<std::string, StreamedPackage>::iterator it);
+
+    /** @brief guards streamedPackages, shared with the worker */
+    std::mutex streamMutex;
+    std::condition_variable streamCondition;
+
+    /** @brief packages being written, by path */
+    std::map<std::string, StreamedPackage> streamedPackages;
+
+    /** @brief hashes the packages off the event loop, nullptr if it can't be
+     *         started and the packages are hashed on the event loop
+     */
+    std::unique_ptr<pldm::utils::WorkerThread> worker;
+
     /**
      * @brief subscribe for service stage change events
      *
@@ -1109,6 +1109,92 @@ out:
 	return rc;
 }
 
+int pldm_bios_table_attr_value_entry_update_in_place(
+    void *table, size_t *length, size_t buffer_length, void *table_entry,
+    const void *entry, size_t entry_length)
+{
+	POINTER_CHECK(table);
+	POINTER_CHECK(length);
+	POINTER_CHECK(table_entry);
+	POINTER_CHECK(entry);
+
+	uint8_t *begin = table;
+	uint8_t *dst = table_entry;
+	const struct pldm_bios_attr_val_table_entry *old_entry = table_entry;
+	const struct pldm_bios_attr_val_table_entry *new_entry = entry;
+	if (*length > buffer_length || *length <= pad_and_check_max ||
+	    dst < begin || (size_t)(dst - begin) >= *length - pad_and_check_max)
+		return PLDM_ERROR_INVALID_LENGTH;
+	if (old_entry->attr_handle != new_entry->attr_handle ||
+	    old_entry->attr_type != new_entry->attr_type)
+		return PLDM_ERROR_INVALID_DATA;
+	if (entry_length < sizeof(*new_entry) ||
+	    attr_value_table_entry_length(new_entry) != entry_length)
+		return PLDM_ERROR_INVALID_LENGTH;
+
+	size_t offset = dst - begin;
+	size_t old_length = attr_value_table_entry_length(old_entry);
+	size_t crc_length = *length - sizeof(uint32_t);
+	if (old_length == entry_length) {
+		if (offset + entry_length > crc_length)
+			return PLDM_ERROR_INVALID_LENGTH;
+		uint32_t checksum;
+		memcpy(&checksum, begin + crc_length, sizeof(checksum));
+		checksum = crc32_patch(le32toh(checksum), dst, entry,
+				       entry_length,
+				       crc_length - offset - entry_length);
+		memcpy(dst, entry, entry_length);
+		checksum_append(begin + crc_length, checksum);
+		return PLDM_SUCCESS;
+	}
+
+	/* find the end of the entries after the updated one */
+	struct pldm_bios_table_iter iter = {
+	    .table_data = begin,
+	    .table_len = *length,
+	    .current_pos = offset,
+	    .entry_length_handler = attr_value_table_entry_length};
+	while (!pldm_bios_table_iter_is_end(&iter))
+		pldm_bios_table_iter_next(&iter);
+	size_t size_without_pad = iter.current_pos;
+	if (size_without_pad < offset + old_length)
+		return PLDM_ERROR_INVALID_LENGTH;
+
+	size_t new_size = size_without_pad - old_length + entry_length;
+	if (new_size + pldm_bios_table_pad_checksum_size(new_size) >
+	    buffer_length)
+		return PLDM_ERROR_INVALID_LENGTH;
+
+	memmove(dst + entry_length, dst + old_length,
+		size_without_pad - offset - old_length);
+	memcpy(dst, entry, entry_length);
+	*length =
+	    pldm_bios_table_append_pad_checksum(table, buffer_length, new_size);
+	return PLDM_SUCCESS;
+}
+
+int pldm_bios_table_attr_value_update_in_place(void *table, size_t *length,
+					       size_t buffer_length,
+					       const void *entry,
+					       size_t entry_length)
+{
+	POINTER_CHECK(table);
+	POINTER_CHECK(length);
+	POINTER_CHECK(entry);
+	if (entry_length < sizeof(struct pldm_bios_attr_val_table_entry))
+		return PLDM_ERROR_INVALID_LENGTH;
+
+	const struct pldm_bios_attr_val_table_entry *new_entry = entry;
+	const void *table_entry = pldm_bios_table_attr_value_find_by_handle(
+	    table, *length, le16toh(new_entry->attr_handle));
+	if (table_entry == NULL)
+		return PLDM_ERROR_INVALID_DATA;
+
+	return pldm_bios_table_attr_value_entry_update_in_place(
+	    table, length, buffer_length, (void *)table_entry, entry,
+	    entry_length);
+}
+
 bool pldm_bios_table_checksum(const uint8_t *table, size_t size)
 {
 	if (table == NULL)
@@ -714,6 +714,44 @@ int pldm_bios_table_attr_value_copy_and_update(
     const void *src_table, size_t src_length, void *dest_table,
     size_t *dest_length, const void *entry, size_t entry_length);
 
+/** @brief Update an entry of the attribute value table in place
+ *
+ *  If the new entry has the same length as the existing one, which is always
+ *  true for an integer entry and for an enumeration entry with the same
+ *  number of current values, only the entry is overwritten and the checksum
+ *  is updated from the changed bytes. Otherwise the entries after it are
+ *  moved within the buffer, and the pad and checksum are rebuilt.
+ *
+ *  @param[in,out] table - Pointer to the buffer of the table
+ *  @param[in,out] length - Length of the table as input parameter and will
+ *                          be assigned the length of the updated table, if
+ *                          the function returns PLDM_SUCCESS
+ *  @param[in] buffer_length - Size of the buffer of the table
+ *  @param[in,out] table_entry - Pointer to the entry to update in the table
+ *  @param[in] entry - Pointer to the new entry, must not be in the table
+ *  @param[in] entry_length - Size of the new entry
+ *  @return pldm_completion_codes
+ */
+int pldm_bios_table_attr_value_entry_update_in_place(
+    void *table, size_t *length, size_t buffer_length, void *table_entry,
+    const void *entry, size_t entry_length);
+
+/** @brief Find an entry of the attribute value table by the handle of the
+ *         new entry and update it in place
+ *  @param[in,out] table - Pointer to the buffer of the table
+ *  @param[in,out] length - Length of the table as input parameter and will
+ *                          be assigned the length of the updated table, if
+ *                          the function returns PLDM_SUCCESS
+ *  @param[in] buffer_length - Size of the buffer of the table
+ *  @param[in] entry - Pointer to the new entry, must not be in the table
+ *  @param[in] entry_length - Size of the new entry
+ *  @return pldm_completion_codes
+ */
+int pldm_bios_table_attr_value_update_in_place(void *table, size_t *length,
+					       size_t buffer_length,
+					       const void *entry,
+					       size_t entry_length);
+
 /** @brief Verify the crc value of the complete table
  *  @param[in] table - Pointer to a buffer of a bios table
  *  @param[in] size - Size of the buffer of a bios table
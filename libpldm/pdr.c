@@ -4,21 +4,164 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* Initial number of record handle hash buckets, the table doubles whenever
+ * the record count exceeds twice the bucket count.
+ */
+#define PDR_HASH_INITIAL_BITS 4
+#define PDR_HASH_MAX_LOAD 2
+#define PDR_TYPE_COUNT 256
+
+#define PDR_ARENA_DEFAULT_SLAB_SIZE 4096
+#define PDR_ARENA_ALIGN sizeof(void *)
+
+/** @struct pldm_pdr_slab
+ *  A chunk of contiguous storage records of an arena repository are carved
+ *  from
+ */
+struct pldm_pdr_slab {
+	struct pldm_pdr_slab *next;
+	uint8_t *base;
+	size_t size;
+	size_t used;
+};
+
 typedef struct pldm_pdr_record {
 	uint32_t record_handle;
 	uint32_t size;
 	uint8_t *data;
 	struct pldm_pdr_record *next;
 	bool is_remote;
+	uint8_t type;
+	uint32_t seq;
+	struct pldm_pdr_record *hash_next;
+	struct pldm_pdr_record *type_next;
 } pldm_pdr_record;
 
+struct pldm_pdr_type_index {
+	pldm_pdr_record *first;
+	pldm_pdr_record *last;
+};
+
 typedef struct pldm_pdr {
 	uint32_t record_count;
 	uint32_t size;
 	pldm_pdr_record *first;
 	pldm_pdr_record *last;
+	uint32_t next_seq;
+	uint8_t hash_bits;
+	pldm_pdr_record **hash;
+	struct pldm_pdr_type_index types[PDR_TYPE_COUNT];
+	bool is_arena;
+	size_t slab_size;
+	struct pldm_pdr_slab *slabs;
+	uint8_t *user_buffer;
 } pldm_pdr;
 
+static struct pldm_pdr_slab *arena_add_slab(pldm_pdr *repo, size_t size)
+{
+	struct pldm_pdr_slab *slab = malloc(sizeof(struct pldm_pdr_slab) + size);
+	assert(slab != NULL);
+	slab->base = (uint8_t *)(slab + 1);
+	slab->size = size;
+	slab->used = 0;
+	slab->next = repo->slabs;
+	repo->slabs = slab;
+
+	return slab;
+}
+
+static size_t arena_padding(const struct pldm_pdr_slab *slab)
+{
+	uintptr_t addr = (uintptr_t)(slab->base + slab->used);
+	return (PDR_ARENA_ALIGN - (addr % PDR_ARENA_ALIGN)) % PDR_ARENA_ALIGN;
+}
+
+static void *arena_alloc(pldm_pdr *repo, size_t size)
+{
+	struct pldm_pdr_slab *slab = repo->slabs;
+	if (slab == NULL ||
+	    slab->size - slab->used < arena_padding(slab) + size) {
+		size_t slab_size = repo->slab_size;
+		if (slab_size < size + PDR_ARENA_ALIGN) {
+			slab_size = size + PDR_ARENA_ALIGN;
+		}
+		slab = arena_add_slab(repo, slab_size);
+	}
+
+	slab->used += arena_padding(slab);
+	void *ptr = slab->base + slab->used;
+	slab->used += size;
+
+	return ptr;
+}
+
+static inline uint32_t hash_record_handle(uint32_t record_handle,
+					  uint8_t hash_bits)
+{
+	/* Fibonacci hashing spreads both the sequential BMC handles and the
+	 * sparse remote handles over the buckets
+	 */
+	return (uint32_t)(record_handle * 2654435761U) >> (32 - hash_bits);
+}
+
+static void hash_insert(pldm_pdr *repo, pldm_pdr_record *record)
+{
+	pldm_pdr_record **slot =
+	    &repo->hash[hash_record_handle(record->record_handle,
+					   repo->hash_bits)];
+
+	/* Append so that a lookup finds the first added record among the
+	 * ones sharing a record handle, like a walk of the list would
+	 */
+	while (*slot != NULL) {
+		slot = &(*slot)->hash_next;
+	}
+	record->hash_next = NULL;
+	*slot = record;
+}
+
+static void hash_rebuild(pldm_pdr *repo, uint8_t hash_bits)
+{
+	pldm_pdr_record **hash =
+	    calloc((size_t)1 << hash_bits, sizeof(pldm_pdr_record *));
+	assert(hash != NULL);
+
+	free(repo->hash);
+	repo->hash = hash;
+	repo->hash_bits = hash_bits;
+
+	pldm_pdr_record *record = repo->first;
+	while (record != NULL) {
+		hash_insert(repo, record);
+		record = record->next;
+	}
+}
+
+static void type_index_insert(pldm_pdr *repo, pldm_pdr_record *record)
+{
+	struct pldm_pdr_type_index *index = &repo->types[record->type];
+
+	record->type_next = NULL;
+	if (index->first == NULL) {
+		index->first = record;
+	} else {
+		index->last->type_next = record;
+	}
+	index->last = record;
+}
+
+static void index_rebuild(pldm_pdr *repo)
+{
+	memset(repo->types, 0, sizeof(repo->types));
+	pldm_pdr_record *record = repo->first;
+	while (record != NULL) {
+		type_index_insert(repo, record);
+		record = record->next;
+	}
+
+	hash_rebuild(repo, repo->hash_bits);
+}
+
 static inline uint32_t get_next_record_handle(const pldm_pdr *repo,
 					      const pldm_pdr_record *record)
 {
@@ -46,6 +189,17 @@ static void add_record(pldm_pdr *repo, pldm_pdr_record *record)
 	}
 	repo->size += record->size;
 	++repo->record_count;
+
+	record->seq = repo->next_seq++;
+	type_index_insert(repo, record);
+	if (repo->hash == NULL ||
+	    repo->record_count >
+		((uint32_t)PDR_HASH_MAX_LOAD << repo->hash_bits)) {
+		hash_rebuild(repo, repo->hash == NULL ? PDR_HASH_INITIAL_BITS
+						      : repo->hash_bits + 1);
+	} else {
+		hash_insert(repo, record);
+	}
 }
 
 static inline uint32_t get_new_record_handle(const pldm_pdr *repo)
@@ -58,21 +212,32 @@ static inline uint32_t get_new_record_handle(const pldm_pdr *repo)
 	return last_used_hdl + 1;
 }
 
-static pldm_pdr_record *make_new_record(const pldm_pdr *repo,
-					const uint8_t *data, uint32_t size,
-					uint32_t record_handle, bool is_remote)
+static pldm_pdr_record *make_new_record(pldm_pdr *repo, const uint8_t *data,
+					uint32_t size, uint32_t record_handle,
+					bool is_remote)
 {
 	assert(repo != NULL);
 	assert(size != 0);
 
-	pldm_pdr_record *record = malloc(sizeof(pldm_pdr_record));
+	pldm_pdr_record *record = NULL;
+	if (repo->is_arena) {
+		record = arena_alloc(repo, pldm_pdr_get_arena_record_size(size));
+	} else {
+		record = malloc(sizeof(pldm_pdr_record));
+	}
 	assert(record != NULL);
 	record->record_handle =
 	    record_handle == 0 ? get_new_record_handle(repo) : record_handle;
 	record->size = size;
 	record->is_remote = is_remote;
+	record->type = 0;
+	record->data = NULL;
 	if (data != NULL) {
-		record->data = malloc(size);
+		if (repo->is_arena) {
+			record->data = (uint8_t *)(record + 1);
+		} else {
+			record->data = malloc(size);
+		}
 		assert(record->data != NULL);
 		memcpy(record->data, data, size);
 		/* If record handle is 0, that is an indication for this API to
@@ -86,8 +251,11 @@ static pldm_pdr_record *make_new_record(const pldm_pdr *repo,
 			    (struct pldm_pdr_hdr *)(record->data);
 			hdr->record_handle = htole32(record->record_handle);
 		}
+		record->type = ((struct pldm_pdr_hdr *)(record->data))->type;
 	}
 	record->next = NULL;
+	record->hash_next = NULL;
+	record->type_next = NULL;
 
 	return record;
 }
@@ -113,14 +281,70 @@ pldm_pdr *pldm_pdr_init()
 	repo->size = 0;
 	repo->first = NULL;
 	repo->last = NULL;
+	repo->next_seq = 0;
+	repo->hash_bits = 0;
+	repo->hash = NULL;
+	memset(repo->types, 0, sizeof(repo->types));
+	repo->is_arena = false;
+	repo->slab_size = 0;
+	repo->slabs = NULL;
+	repo->user_buffer = NULL;
+
+	return repo;
+}
+
+pldm_pdr *pldm_pdr_init_arena(size_t slab_size)
+{
+	pldm_pdr *repo = pldm_pdr_init();
+	repo->is_arena = true;
+	repo->slab_size = slab_size ? slab_size : PDR_ARENA_DEFAULT_SLAB_SIZE;
 
 	return repo;
 }
 
+pldm_pdr *pldm_pdr_init_from_buffer(uint8_t *buffer, size_t size,
+				    size_t slab_size)
+{
+	assert(buffer != NULL);
+
+	pldm_pdr *repo = pldm_pdr_init_arena(slab_size);
+	struct pldm_pdr_slab *slab = malloc(sizeof(struct pldm_pdr_slab));
+	assert(slab != NULL);
+	slab->base = buffer;
+	slab->size = size;
+	slab->used = 0;
+	slab->next = NULL;
+	repo->slabs = slab;
+	repo->user_buffer = buffer;
+
+	return repo;
+}
+
+size_t pldm_pdr_get_arena_record_size(uint32_t size)
+{
+	size_t record_size = sizeof(pldm_pdr_record) + size;
+	return (record_size + PDR_ARENA_ALIGN - 1) & ~(PDR_ARENA_ALIGN - 1);
+}
+
 void pldm_pdr_destroy(pldm_pdr *repo)
 {
 	assert(repo != NULL);
 
+	if (repo->is_arena) {
+		/* Records live in the slabs, the slab of a caller provided
+		 * buffer only owns its bookkeeping
+		 */
+		struct pldm_pdr_slab *slab = repo->slabs;
+		while (slab != NULL) {
+			struct pldm_pdr_slab *next = slab->next;
+			free(slab);
+			slab = next;
+		}
+		free(repo->hash);
+		free(repo);
+		return;
+	}
+
 	pldm_pdr_record *record = repo->first;
 	while (record != NULL) {
 		pldm_pdr_record *next = record->next;
@@ -131,6 +355,7 @@ void pldm_pdr_destroy(pldm_pdr *repo)
 		free(record);
 		record = next;
 	}
+	free(repo->hash);
 	free(repo);
 }
 
@@ -147,7 +372,11 @@ const pldm_pdr_record *pldm_pdr_find_record(const pldm_pdr *repo,
 	if (!record_handle && (repo->first != NULL)) {
 		record_handle = repo->first->record_handle;
 	}
-	pldm_pdr_record *record = repo->first;
+	pldm_pdr_record *record = NULL;
+	if (repo->hash != NULL) {
+		record = repo->hash[hash_record_handle(record_handle,
+						       repo->hash_bits)];
+	}
 	while (record != NULL) {
 		if (record->record_handle == record_handle) {
 			*size = record->size;
@@ -156,7 +385,7 @@ const pldm_pdr_record *pldm_pdr_find_record(const pldm_pdr *repo,
 			    get_next_record_handle(repo, record);
 			return record;
 		}
-		record = record->next;
+		record = record->hash_next;
 	}
 
 	*size = 0;
@@ -195,20 +424,27 @@ pldm_pdr_find_record_by_type(const pldm_pdr *repo, uint8_t pdr_type,
 {
 	assert(repo != NULL);
 
-	pldm_pdr_record *record = repo->first;
+	pldm_pdr_record *record = repo->types[pdr_type].first;
 	if (curr_record != NULL) {
-		record = curr_record->next;
-	}
-	while (record != NULL) {
-		struct pldm_pdr_hdr *hdr = (struct pldm_pdr_hdr *)record->data;
-		if (hdr->type == pdr_type) {
-			if (data && size) {
-				*size = record->size;
-				*data = record->data;
+		if (curr_record->type == pdr_type) {
+			record = curr_record->type_next;
+		} else {
+			/* Skip the records of the type added before the
+			 * current record
+			 */
+			while (record != NULL &&
+			       record->seq < curr_record->seq) {
+				record = record->type_next;
 			}
-			return record;
 		}
-		record = record->next;
+	}
+
+	if (record != NULL) {
+		if (data && size) {
+			*size = record->size;
+			*data = record->data;
+		}
+		return record;
 	}
 
 	if (size) {
@@ -771,12 +1007,13 @@ void pldm_pdr_remove_remote_pdrs(pldm_pdr *repo)
 			if (repo->last == record) {
 				repo->last = prev;
 			}
-			if (record->data) {
-				free(record->data);
-			}
 			--repo->record_count;
 			repo->size -= record->size;
-			free(record);
+			/* Arena records are released with the repository */
+			if (!repo->is_arena) {
+				free(record->data);
+				free(record);
+			}
 			removed = true;
 		} else {
 			prev = record;
@@ -797,9 +1034,52 @@ void pldm_pdr_remove_remote_pdrs(pldm_pdr *repo)
 			}
 			record = record->next;
 		}
+
+		/* Handles were renumbered and records dropped out of the
+		 * chains, so both indexes are built again
+		 */
+		index_rebuild(repo);
 	}
 }
 
+bool pldm_pdr_remove_record(pldm_pdr *repo, uint32_t record_handle)
+{
+	assert(repo != NULL);
+
+	pldm_pdr_record *record = repo->first;
+	pldm_pdr_record *prev = NULL;
+	while (record != NULL && record->record_handle != record_handle) {
+		prev = record;
+		record = record->next;
+	}
+	if (record == NULL) {
+		return false;
+	}
+
+	if (prev == NULL) {
+		repo->first = record->next;
+	} else {
+		prev->next = record->next;
+	}
+	if (repo->last == record) {
+		repo->last = prev;
+	}
+	--repo->record_count;
+	repo->size -= record->size;
+	/* Arena records are released with the repository */
+	if (!repo->is_arena) {
+		free(record->data);
+		free(record);
+	}
+
+	/* The other records keep their handles, only the chains the record
+	 * was linked in need to be built again
+	 */
+	index_rebuild(repo);
+
+	return true;
+}
+
 void entity_association_tree_find(pldm_entity_node *node, pldm_entity *entity,
 				  pldm_entity_node **out)
 {
@@ -34,6 +34,44 @@ typedef struct pldm_pdr_record pldm_pdr_record;
  */
 pldm_pdr *pldm_pdr_init();
 
+/** @brief Make a new PDR repository which stores its records in arena slabs
+ *
+ *  Records (bookkeeping and PDR data) are appended to contiguous slabs
+ *  instead of being allocated one by one, and are only released when the
+ *  repository is destroyed.
+ *
+ *  @param[in] slab_size - size in bytes of each slab; 0 selects a default
+ *  size. A record larger than a slab gets a slab of its own.
+ *
+ *  @return opaque pointer that acts as a handle to the repository; like
+ *  pldm_pdr_init(), an allocation failure is asserted rather than reported
+ */
+pldm_pdr *pldm_pdr_init_arena(size_t slab_size);
+
+/** @brief Make a new arena PDR repository whose first slab is a caller
+ *  provided buffer
+ *
+ *  @param[in] buffer - storage for the records, it must outlive the
+ *  repository and is not freed by pldm_pdr_destroy()
+ *  @param[in] size - size of buffer in bytes, see
+ *  pldm_pdr_get_arena_record_size() to pre-size it
+ *  @param[in] slab_size - size in bytes of the slabs allocated once buffer is
+ *  exhausted; 0 selects a default size
+ *
+ *  @return opaque pointer that acts as a handle to the repository; like
+ *  pldm_pdr_init(), an allocation failure is asserted rather than reported
+ */
+pldm_pdr *pldm_pdr_init_from_buffer(uint8_t *buffer, size_t size,
+				    size_t slab_size);
+
+/** @brief Get the arena space a record of the given PDR size takes
+ *
+ *  @param[in] size - size of the PDR in bytes
+ *
+ *  @return size_t - bytes used in an arena slab by the record
+ */
+size_t pldm_pdr_get_arena_record_size(uint32_t size);
+
 /** @brief Destroy a PDR repository (and free up associated resources)
  *
  *  @param[in/out] repo - pointer to opaque pointer acting as a PDR repo handle
@@ -144,6 +182,15 @@ bool pldm_pdr_record_is_remote(const pldm_pdr_record *record);
  */
 void pldm_pdr_remove_remote_pdrs(pldm_pdr *repo);
 
+/** @brief Remove a PDR record, the handles of the other records are kept
+ *
+ *  @param[in] repo - opaque pointer acting as a PDR repo handle
+ *  @param[in] record_handle - handle of the record to be removed
+ *
+ *  @return true if the record was found and removed
+ */
+bool pldm_pdr_remove_record(pldm_pdr *repo, uint32_t record_handle);
+
 /** @brief Update the validity of TL PDR - the validity is decided based on
  * whether the valid bit is set or not as per the spec DSP0248
  *
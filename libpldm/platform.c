@@ -2206,6 +2206,16 @@ int decode_poll_for_platform_event_message_resp(
 	*event_class = response->event_class;
 	*event_data_size = response->event_data_size;
 
+	size_t expected_length =
+	    PLDM_POLL_FOR_PLATFORM_EVENT_MESSAGE_MIN_RESP_BYTES +
+	    (size_t)*event_data_size;
+	if (*transfer_flag == PLATFORM_EVENT_END) {
+		expected_length += sizeof(uint32_t);
+	}
+	if (payload_length < expected_length) {
+		return PLDM_ERROR_INVALID_LENGTH;
+	}
+
 	if (*event_data_size > 0) {
 		memcpy(event_data, response->event_data,
 		       response->event_data_size);
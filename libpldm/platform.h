@@ -235,6 +235,15 @@ enum pldm_effecter_init {
 	PLDM_DISABLE_EFFECTER
 };
 
+/** @brief PLDM sensor initialization schemes
+ */
+enum pldm_sensor_init {
+	PLDM_SENSOR_NO_INIT,
+	PLDM_SENSOR_USE_INIT_PDR,
+	PLDM_SENSOR_ENABLE,
+	PLDM_SENSOR_DISABLE
+};
+
 /** @brief PLDM Platform M&C completion codes
  */
 enum pldm_platform_completion_codes {
@@ -942,6 +942,117 @@ TEST(AttrValTable, CopyAndUpdateTest)
     EXPECT_EQ(rc, PLDM_ERROR_INVALID_LENGTH);
 }
 
+TEST(AttrValTable, UpdateInPlaceTest)
+{
+    std::vector<uint8_t> enumEntry{
+        0, 0, /* attr handle */
+        0,    /* attr type */
+        2,    /* number of current value */
+        0,    /* current value string handle index */
+        1,    /* current value string handle index */
+    };
+    std::vector<uint8_t> stringEntry{
+        1,   0,        /* attr handle */
+        1,             /* attr type */
+        3,   0,        /* current string length */
+        'a', 'b', 'c', /* defaut value string handle index */
+    };
+    std::vector<uint8_t> integerEntry{
+        2,  0,                   /* attr handle */
+        3,                       /* attr type */
+        10, 0, 0, 0, 0, 0, 0, 0, /* current value */
+    };
+
+    Table table;
+    buildTable(table, enumEntry, stringEntry, integerEntry);
+    auto length = table.size();
+
+    // fixed size entries are patched with the checksum updated
+    std::vector<uint8_t> integerEntry1{
+        2,  0,                    /* attr handle */
+        3,                        /* attr type */
+        20, 1, 0, 0, 0, 0, 0, 0, /* current value */
+    };
+    auto rc = pldm_bios_table_attr_value_update_in_place(
+        table.data(), &length, table.size(), integerEntry1.data(),
+        integerEntry1.size());
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    Table expectTable;
+    buildTable(expectTable, enumEntry, stringEntry, integerEntry1);
+    EXPECT_EQ(length, expectTable.size());
+    EXPECT_THAT(table, ElementsAreArray(expectTable));
+
+    std::vector<uint8_t> enumEntry1{
+        0, 0, /* attr handle */
+        0,    /* attr type */
+        2,    /* number of current value */
+        1,    /* current value string handle index */
+        0,    /* current value string handle index */
+    };
+    rc = pldm_bios_table_attr_value_update_in_place(
+        table.data(), &length, table.size(), enumEntry1.data(),
+        enumEntry1.size());
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    expectTable.resize(0);
+    buildTable(expectTable, enumEntry1, stringEntry, integerEntry1);
+    EXPECT_THAT(table, ElementsAreArray(expectTable));
+
+    // a longer string moves the following entries
+    std::vector<uint8_t> stringEntry1{
+        1,   0,                  /* attr handle */
+        1,                       /* attr type */
+        5,   0,                  /* current string length */
+        'd', 'e', 'f', 'a', 'b', /* defaut value string handle index */
+    };
+    table.resize(length + 10);
+    rc = pldm_bios_table_attr_value_update_in_place(
+        table.data(), &length, table.size(), stringEntry1.data(),
+        stringEntry1.size());
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    expectTable.resize(0);
+    buildTable(expectTable, enumEntry1, stringEntry1, integerEntry1);
+    EXPECT_EQ(length, expectTable.size());
+    table.resize(length);
+    EXPECT_THAT(table, ElementsAreArray(expectTable));
+
+    // and a shorter one compacts them
+    rc = pldm_bios_table_attr_value_update_in_place(
+        table.data(), &length, table.size(), stringEntry.data(),
+        stringEntry.size());
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    expectTable.resize(0);
+    buildTable(expectTable, enumEntry1, stringEntry, integerEntry1);
+    EXPECT_EQ(length, expectTable.size());
+    table.resize(length);
+    EXPECT_THAT(table, ElementsAreArray(expectTable));
+
+    // no room to grow
+    std::vector<uint8_t> stringEntry2{
+        1,   0,                                  /* attr handle */
+        1,                                       /* attr type */
+        8,   0,                                  /* current string length */
+        'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', /* current string */
+    };
+    rc = pldm_bios_table_attr_value_update_in_place(
+        table.data(), &length, table.size(), stringEntry2.data(),
+        stringEntry2.size());
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_LENGTH);
+    EXPECT_THAT(table, ElementsAreArray(expectTable));
+
+    stringEntry1[2] = PLDM_BIOS_INTEGER; // set attribute type to integer
+    rc = pldm_bios_table_attr_value_update_in_place(
+        table.data(), &length, table.size(), stringEntry1.data(),
+        stringEntry1.size());
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+
+    integerEntry1[0] = 3; // unknown attribute handle
+    rc = pldm_bios_table_attr_value_update_in_place(
+        table.data(), &length, table.size(), integerEntry1.data(),
+        integerEntry1.size());
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+    EXPECT_THAT(table, ElementsAreArray(expectTable));
+}
+
 TEST(StringTable, EntryEncodeTest)
 {
     std::vector<uint8_t> stringEntry{
@@ -0,0 +1,98 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#include "libpldm/utils.h"
+
+/* Times the crc32 and crc8 implementations on buffers of the size of a PLDM
+ * message, a BIOS table and a firmware component. Run with
+ * `meson test --benchmark`.
+ */
+
+using Clock = std::chrono::steady_clock;
+
+static double elapsedMs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start)
+        .count();
+}
+
+int main()
+{
+    const std::pair<crc32_impl, const char*> impls[] = {
+        {CRC32_IMPL_TABLE, "table"},
+        {CRC32_IMPL_SLICE_BY_8, "slice-by-8"},
+        {CRC32_IMPL_HW, "hw"},
+    };
+    const std::pair<crc8_impl, const char*> crc8Impls[] = {
+        {CRC8_IMPL_TABLE, "table"},
+        {CRC8_IMPL_SLICE_BY_8, "slice-by-8"},
+    };
+
+    for (size_t size : {64u, 4096u, 65536u, 16u * 1024 * 1024})
+    {
+        std::vector<uint8_t> data(size);
+        for (size_t i = 0; i < data.size(); i++)
+        {
+            data[i] = static_cast<uint8_t>(i * 31 + (i >> 8));
+        }
+        // checksum about 256MB of data per implementation
+        size_t loops = 256u * 1024 * 1024 / size;
+
+        crc32_select_impl(CRC32_IMPL_TABLE);
+        auto expected = crc32(data.data(), data.size());
+
+        for (const auto& [impl, name] : impls)
+        {
+            if (crc32_select_impl(impl) != 0)
+            {
+                printf("%s size:%zu unsupported\n", name, size);
+                continue;
+            }
+
+            uint32_t checksum = 0;
+            auto start = Clock::now();
+            for (size_t i = 0; i < loops; i++)
+            {
+                checksum = crc32(data.data(), data.size());
+            }
+            auto ms = elapsedMs(start);
+            if (checksum != expected)
+            {
+                fprintf(stderr, "%s size:%zu checksum mismatch\n", name,
+                        size);
+                return EXIT_FAILURE;
+            }
+            printf("%s size:%zu %.3fms %.1fMB/s\n", name, size, ms,
+                   loops * size / 1024.0 / 1024.0 / (ms / 1000.0));
+        }
+
+        crc8_select_impl(CRC8_IMPL_TABLE);
+        auto expectedCrc = crc8(data.data(), data.size());
+
+        for (const auto& [impl, name] : crc8Impls)
+        {
+            crc8_select_impl(impl);
+
+            uint8_t crc = 0;
+            auto start = Clock::now();
+            for (size_t i = 0; i < loops; i++)
+            {
+                crc = crc8(data.data(), data.size());
+            }
+            auto ms = elapsedMs(start);
+            if (crc != expectedCrc)
+            {
+                fprintf(stderr, "crc8 %s size:%zu checksum mismatch\n", name,
+                        size);
+                return EXIT_FAILURE;
+            }
+            printf("crc8 %s size:%zu %.3fms %.1fMB/s\n", name, size, ms,
+                   loops * size / 1024.0 / 1024.0 / (ms / 1000.0));
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,98 @@
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "libpldm/pdr.h"
+#include "libpldm/platform.h"
+
+/* Times the PDR repo operations on repos of the size of a BMC repo merged
+ * with large host repos. Run with `meson test --benchmark`.
+ */
+
+using Clock = std::chrono::steady_clock;
+
+static double elapsedMs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start)
+        .count();
+}
+
+static int benchRepo(uint32_t count, bool arena)
+{
+    std::array<uint8_t, sizeof(pldm_pdr_hdr) + 32> data{};
+    auto hdr = reinterpret_cast<pldm_pdr_hdr*>(data.data());
+
+    auto start = Clock::now();
+    auto repo = arena ? pldm_pdr_init_arena(0) : pldm_pdr_init();
+    for (uint32_t i = 0; i < count; i++)
+    {
+        hdr->type = PLDM_STATE_SENSOR_PDR + (i % 8);
+        pldm_pdr_add(repo, data.data(), data.size(), 0, i % 2);
+    }
+    auto addMs = elapsedMs(start);
+
+    // walk the repo the way GetPDR requesters do
+    uint8_t* outData = nullptr;
+    uint32_t size = 0;
+    uint32_t nextRecHdl = 0;
+    uint32_t found = 0;
+    start = Clock::now();
+    uint32_t handle = 0;
+    do
+    {
+        if (pldm_pdr_find_record(repo, handle, &outData, &size, &nextRecHdl))
+        {
+            found++;
+        }
+        handle = nextRecHdl;
+    } while (handle);
+    auto findMs = elapsedMs(start);
+
+    start = Clock::now();
+    uint32_t typed = 0;
+    auto rec = pldm_pdr_find_record_by_type(repo, PLDM_STATE_SENSOR_PDR,
+                                            nullptr, &outData, &size);
+    while (rec)
+    {
+        typed++;
+        rec = pldm_pdr_find_record_by_type(repo, PLDM_STATE_SENSOR_PDR, rec,
+                                           &outData, &size);
+    }
+    auto typeMs = elapsedMs(start);
+
+    start = Clock::now();
+    pldm_pdr_remove_remote_pdrs(repo);
+    auto removeMs = elapsedMs(start);
+
+    printf("%s records:%u add:%.3fms find_all:%.3fms find_by_type:%.3fms "
+           "remove_remote:%.3fms\n",
+           arena ? "arena" : "malloc", count, addMs, findMs, typeMs,
+           removeMs);
+
+    auto remaining = pldm_pdr_get_record_count(repo);
+    start = Clock::now();
+    pldm_pdr_destroy(repo);
+    printf("%s records:%u destroy:%.3fms\n", arena ? "arena" : "malloc",
+           count, elapsedMs(start));
+
+    return found == count && typed == (count + 7) / 8 &&
+                   remaining == count / 2
+               ? EXIT_SUCCESS
+               : EXIT_FAILURE;
+}
+
+int main()
+{
+    for (uint32_t count : {10000u, 50000u, 100000u})
+    {
+        if (benchRepo(count, false) != EXIT_SUCCESS ||
+            benchRepo(count, true) != EXIT_SUCCESS)
+        {
+            fprintf(stderr, "unexpected result with %u records\n", count);
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -1,4 +1,5 @@
 #include <array>
+#include <vector>
 
 #include "libpldm/pdr.h"
 #include "libpldm/platform.h"
@@ -206,6 +207,44 @@ TEST(PDRUpdate, testRemove)
     pldm_pdr_destroy(repo);
 }
 
+TEST(PDRUpdate, testRemoveRecord)
+{
+    std::array<uint8_t, 10> data{};
+
+    auto repo = pldm_pdr_init();
+    EXPECT_FALSE(pldm_pdr_remove_record(repo, 1));
+    auto first = pldm_pdr_add(repo, data.data(), data.size(), 0, false);
+    auto second = pldm_pdr_add(repo, data.data(), data.size(), 0, false);
+    auto third = pldm_pdr_add(repo, data.data(), data.size(), 0, false);
+
+    EXPECT_TRUE(pldm_pdr_remove_record(repo, second));
+    EXPECT_FALSE(pldm_pdr_remove_record(repo, second));
+    EXPECT_EQ(pldm_pdr_get_record_count(repo), 2u);
+    EXPECT_EQ(pldm_pdr_get_repo_size(repo), 2 * data.size());
+
+    uint8_t* outData = nullptr;
+    uint32_t size{};
+    uint32_t nextRecHdl{};
+    EXPECT_EQ(pldm_pdr_find_record(repo, second, &outData, &size, &nextRecHdl),
+              nullptr);
+    EXPECT_NE(pldm_pdr_find_record(repo, first, &outData, &size, &nextRecHdl),
+              nullptr);
+    EXPECT_EQ(nextRecHdl, third);
+
+    // the last record is removed, the next record gets the next handle
+    EXPECT_TRUE(pldm_pdr_remove_record(repo, third));
+    EXPECT_NE(pldm_pdr_find_record(repo, first, &outData, &size, &nextRecHdl),
+              nullptr);
+    EXPECT_EQ(nextRecHdl, 0u);
+    EXPECT_EQ(pldm_pdr_add(repo, data.data(), data.size(), 0, false), second);
+
+    EXPECT_TRUE(pldm_pdr_remove_record(repo, first));
+    EXPECT_TRUE(pldm_pdr_remove_record(repo, second));
+    EXPECT_EQ(pldm_pdr_get_record_count(repo), 0u);
+    EXPECT_EQ(pldm_pdr_get_repo_size(repo), 0u);
+    pldm_pdr_destroy(repo);
+}
+
 TEST(PDRAccess, testGet)
 {
     auto repo = pldm_pdr_init();
@@ -392,6 +431,147 @@ TEST(PDRAccess, testFindByType)
     pldm_pdr_destroy(repo);
 }
 
+TEST(PDRAccess, testFindInLargeRepo)
+{
+    auto repo = pldm_pdr_init();
+
+    std::array<uint8_t, sizeof(pldm_pdr_hdr)> data{};
+    pldm_pdr_hdr* hdr = reinterpret_cast<pldm_pdr_hdr*>(data.data());
+    constexpr uint32_t count = 1000;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        hdr->type = i % 3;
+        pldm_pdr_add(repo, data.data(), data.size(), 0, i % 2);
+    }
+    // sparse handles like the ones of a merged host repo
+    hdr->type = 1;
+    pldm_pdr_add(repo, data.data(), data.size(), 0x01000000u, true);
+
+    uint8_t* outData = nullptr;
+    uint32_t size{};
+    uint32_t nextRecHdl{};
+    for (uint32_t handle = 1; handle <= count; handle++)
+    {
+        auto rec = pldm_pdr_find_record(repo, handle, &outData, &size,
+                                        &nextRecHdl);
+        ASSERT_NE(rec, nullptr);
+        EXPECT_EQ(pldm_pdr_get_record_handle(repo, rec), handle);
+        EXPECT_EQ(nextRecHdl, handle == count ? 0x01000000u : handle + 1);
+    }
+    EXPECT_NE(pldm_pdr_find_record(repo, 0x01000000u, &outData, &size,
+                                   &nextRecHdl),
+              nullptr);
+    EXPECT_EQ(nextRecHdl, 0u);
+    EXPECT_EQ(pldm_pdr_find_record(repo, count + 1, &outData, &size,
+                                   &nextRecHdl),
+              nullptr);
+
+    // records of a type come back in repo order
+    uint32_t found = 0;
+    uint32_t lastHandle = 0;
+    auto rec = pldm_pdr_find_record_by_type(repo, 1, nullptr, &outData, &size);
+    while (rec != nullptr)
+    {
+        EXPECT_GT(pldm_pdr_get_record_handle(repo, rec), lastHandle);
+        lastHandle = pldm_pdr_get_record_handle(repo, rec);
+        found++;
+        rec = pldm_pdr_find_record_by_type(repo, 1, rec, &outData, &size);
+    }
+    EXPECT_EQ(found, count / 3 + 1);
+
+    // search from a record of another type
+    auto first = pldm_pdr_find_record(repo, 3, &outData, &size, &nextRecHdl);
+    rec = pldm_pdr_find_record_by_type(repo, 1, first, &outData, &size);
+    EXPECT_EQ(pldm_pdr_get_record_handle(repo, rec), 5u);
+
+    // removing the remote records renumbers the local ones
+    pldm_pdr_remove_remote_pdrs(repo);
+    EXPECT_EQ(pldm_pdr_get_record_count(repo), count / 2);
+    for (uint32_t handle = 1; handle <= count / 2; handle++)
+    {
+        rec = pldm_pdr_find_record(repo, handle, &outData, &size,
+                                   &nextRecHdl);
+        ASSERT_NE(rec, nullptr);
+        EXPECT_EQ(le32toh(reinterpret_cast<pldm_pdr_hdr*>(outData)
+                              ->record_handle),
+                  handle);
+    }
+    EXPECT_EQ(pldm_pdr_find_record(repo, count / 2 + 1, &outData, &size,
+                                   &nextRecHdl),
+              nullptr);
+
+    found = 0;
+    rec = pldm_pdr_find_record_by_type(repo, 1, nullptr, &outData, &size);
+    while (rec != nullptr)
+    {
+        EXPECT_FALSE(pldm_pdr_record_is_remote(rec));
+        found++;
+        rec = pldm_pdr_find_record_by_type(repo, 1, rec, &outData, &size);
+    }
+    EXPECT_EQ(found, count / 6);
+
+    pldm_pdr_destroy(repo);
+}
+
+TEST(PDRArena, testAddFindRemove)
+{
+    auto repo = pldm_pdr_init_arena(64);
+
+    std::array<uint8_t, sizeof(pldm_pdr_hdr) + 4> data{};
+    pldm_pdr_hdr* hdr = reinterpret_cast<pldm_pdr_hdr*>(data.data());
+    for (uint8_t i = 0; i < 20; i++)
+    {
+        hdr->type = i % 2;
+        data[sizeof(pldm_pdr_hdr)] = i;
+        pldm_pdr_add(repo, data.data(), data.size(), 0, i % 2);
+    }
+    // larger than a slab
+    std::array<uint8_t, 200> big{};
+    EXPECT_EQ(pldm_pdr_add(repo, big.data(), big.size(), 0, false), 21u);
+    EXPECT_EQ(pldm_pdr_get_record_count(repo), 21u);
+
+    uint8_t* outData = nullptr;
+    uint32_t size{};
+    uint32_t nextRecHdl{};
+    auto rec = pldm_pdr_find_record(repo, 10, &outData, &size, &nextRecHdl);
+    ASSERT_NE(rec, nullptr);
+    EXPECT_EQ(size, data.size());
+    EXPECT_EQ(outData[sizeof(pldm_pdr_hdr)], 9);
+    EXPECT_EQ(nextRecHdl, 11u);
+
+    pldm_pdr_remove_remote_pdrs(repo);
+    EXPECT_EQ(pldm_pdr_get_record_count(repo), 11u);
+    rec = pldm_pdr_find_record(repo, 2, &outData, &size, &nextRecHdl);
+    ASSERT_NE(rec, nullptr);
+    EXPECT_EQ(outData[sizeof(pldm_pdr_hdr)], 2);
+
+    pldm_pdr_destroy(repo);
+}
+
+TEST(PDRArena, testInitFromBuffer)
+{
+    std::array<uint8_t, sizeof(pldm_pdr_hdr) + 8> data{};
+    std::vector<uint8_t> buffer(
+        3 * pldm_pdr_get_arena_record_size(data.size()) + sizeof(void*));
+    auto repo = pldm_pdr_init_from_buffer(buffer.data(), buffer.size(), 0);
+
+    uint8_t* outData = nullptr;
+    uint32_t size{};
+    uint32_t nextRecHdl{};
+    for (uint32_t i = 1; i <= 4; i++)
+    {
+        pldm_pdr_add(repo, data.data(), data.size(), 0, false);
+        pldm_pdr_find_record(repo, i, &outData, &size, &nextRecHdl);
+        // the fourth record no longer fits in the buffer
+        bool inBuffer = outData >= buffer.data() &&
+                        outData + size <= buffer.data() + buffer.size();
+        EXPECT_EQ(inBuffer, i < 4);
+    }
+    EXPECT_EQ(pldm_pdr_get_record_count(repo), 4u);
+
+    pldm_pdr_destroy(repo);
+}
+
 TEST(PDRUpdate, testAddFruRecordSet)
 {
     auto repo = pldm_pdr_init();
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstring>
 #include <vector>
 
@@ -12,6 +13,82 @@ TEST(Crc32, CheckSumTest)
     EXPECT_EQ(checksum, 0xcbf43926);
 }
 
+TEST(Crc32, ImplTest)
+{
+    std::vector<uint8_t> data(4099);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<uint8_t>(i * 31 + (i >> 8));
+    }
+
+    ASSERT_EQ(crc32_select_impl(CRC32_IMPL_TABLE), 0);
+    std::vector<uint32_t> expected;
+    for (size_t size = 0; size <= 200; size++)
+    {
+        expected.push_back(crc32(data.data() + 3, size));
+    }
+    auto expectedAll = crc32(data.data(), data.size());
+
+    for (auto impl : {CRC32_IMPL_SLICE_BY_8, CRC32_IMPL_HW})
+    {
+        if (crc32_select_impl(impl) != 0)
+        {
+            continue;
+        }
+        // unaligned data of every length around the folding thresholds
+        for (size_t size = 0; size < expected.size(); size++)
+        {
+            EXPECT_EQ(crc32(data.data() + 3, size), expected[size]);
+        }
+        EXPECT_EQ(crc32(data.data(), data.size()), expectedAll);
+        EXPECT_EQ(crc32("123456789", 9), 0xcbf43926);
+    }
+    EXPECT_NE(crc32_select_impl(static_cast<crc32_impl>(-1)), 0);
+
+    if (crc32_select_impl(CRC32_IMPL_HW) != 0)
+    {
+        crc32_select_impl(CRC32_IMPL_SLICE_BY_8);
+    }
+}
+
+TEST(Crc32, UpdateTest)
+{
+    std::vector<uint8_t> data(1000);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<uint8_t>(i * 13);
+    }
+
+    for (size_t split : {0, 1, 7, 64, 999, 1000})
+    {
+        auto crc = crc32_update(0, data.data(), split);
+        crc = crc32_update(crc, data.data() + split, data.size() - split);
+        EXPECT_EQ(crc, crc32(data.data(), data.size()));
+    }
+}
+
+TEST(Crc32, PatchTest)
+{
+    std::vector<uint8_t> data(1000);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<uint8_t>(i * 7);
+    }
+    auto checksum = crc32(data.data(), data.size());
+
+    const uint8_t value[] = {0x12, 0x34, 0x56};
+    for (size_t offset : {0, 1, 500, 997})
+    {
+        auto patched = data;
+        std::copy(std::begin(value), std::end(value),
+                  patched.begin() + offset);
+        EXPECT_EQ(crc32_patch(checksum, data.data() + offset, value,
+                              sizeof(value),
+                              data.size() - offset - sizeof(value)),
+                  crc32(patched.data(), patched.size()));
+    }
+}
+
 TEST(Crc8, CheckSumTest)
 {
     const char* data = "123456789";
@@ -19,6 +96,58 @@ TEST(Crc8, CheckSumTest)
     EXPECT_EQ(checksum, 0xf4);
 }
 
+TEST(Crc8, UpdateTest)
+{
+    std::vector<uint8_t> data(100);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<uint8_t>(i * 13);
+    }
+
+    // byte at a time reference
+    uint8_t expected = 0;
+    for (auto byte : data)
+    {
+        expected = crc8_update(expected, &byte, 1);
+    }
+    EXPECT_EQ(crc8(data.data(), data.size()), expected);
+
+    for (size_t split : {0, 3, 8, 17, 100})
+    {
+        auto crc = crc8_update(0, data.data(), split);
+        crc = crc8_update(crc, data.data() + split, data.size() - split);
+        EXPECT_EQ(crc, expected);
+    }
+}
+
+TEST(Crc8, ImplTest)
+{
+    std::vector<uint8_t> data(1027);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<uint8_t>(i * 31 + (i >> 8));
+    }
+
+    ASSERT_EQ(crc8_select_impl(CRC8_IMPL_TABLE), 0);
+    std::vector<uint8_t> expected;
+    for (size_t size = 0; size <= 40; size++)
+    {
+        expected.push_back(crc8(data.data() + 3, size));
+    }
+    auto expectedAll = crc8(data.data(), data.size());
+
+    ASSERT_EQ(crc8_select_impl(CRC8_IMPL_SLICE_BY_8), 0);
+    // unaligned data of every length around the 8 byte blocks
+    for (size_t size = 0; size < expected.size(); size++)
+    {
+        EXPECT_EQ(crc8(data.data() + 3, size), expected[size]);
+    }
+    EXPECT_EQ(crc8(data.data(), data.size()), expectedAll);
+    EXPECT_EQ(crc8("123456789", 9), 0xf4);
+
+    EXPECT_NE(crc8_select_impl(static_cast<crc8_impl>(-1)), 0);
+}
+
 TEST(Ver2string, Ver2string)
 {
     ver32_t version{0x61, 0x10, 0xf7, 0xf3};
@@ -1,10 +1,23 @@
 #include "utils.h"
 #include "base.h"
 #include <ctype.h>
+#include <endian.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CRC32_HW_PCLMUL
+#elif defined(__aarch64__)
+#include <arm_acle.h>
+#include <sys/auxv.h>
+#ifndef HWCAP_CRC32
+#define HWCAP_CRC32 (1 << 7)
+#endif
+#define CRC32_HW_ARMV8
+#endif
+
 /** CRC32 code derived from work by Gary S. Brown.
  *  http://web.mit.edu/freebsd/head/sys/libkern/crc32.c
  *
@@ -12,7 +25,7 @@
  *  code or tables extracted from it, as desired without restriction.
  *
  */
-static uint32_t crc32_tab[] = {
+static const uint32_t crc32_tab[] = {
     0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f,
     0xe963a535, 0x9e6495a3, 0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988,
     0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91, 0x1db71064, 0x6ab020f2,
@@ -83,24 +96,348 @@ static const uint8_t crc8_table[] = {
     0xde, 0xd9, 0xd0, 0xd7, 0xc2, 0xc5, 0xcc, 0xcb, 0xe6, 0xe1, 0xe8, 0xef,
     0xfa, 0xfd, 0xf4, 0xf3};
 
-uint32_t crc32(const void *data, size_t size)
+/* crc32_tab8[k][n] is the crc register after feeding byte n followed by k
+ * zero bytes, crc32_tab8[0] is crc32_tab. Filled by crc_init(). */
+static uint32_t crc32_tab8[8][256];
+
+/* crc8_tab8[k][n] is the crc after feeding byte n followed by k zero bytes */
+static uint8_t crc8_tab8[8][256];
+
+static uint32_t crc32_table_update(uint32_t crc, const uint8_t *p, size_t size)
 {
-	const uint8_t *p = data;
-	uint32_t crc = ~0U;
 	while (size--)
 		crc = crc32_tab[(crc ^ *p++) & 0xff] ^ (crc >> 8);
-	return crc ^ ~0U;
+	return crc;
 }
 
-uint8_t crc8(const void *data, size_t size)
+/* Slice-by-8: look up 8 bytes at a time in 8 tables, the tables are
+ * independent so the loads don't wait for each other */
+static uint32_t crc32_slice8_update(uint32_t crc, const uint8_t *p,
+				    size_t size)
+{
+	while (size >= 8) {
+		uint32_t one, two;
+		memcpy(&one, p, sizeof(one));
+		memcpy(&two, p + 4, sizeof(two));
+		one = le32toh(one) ^ crc;
+		two = le32toh(two);
+		crc = crc32_tab8[7][one & 0xff] ^
+		      crc32_tab8[6][(one >> 8) & 0xff] ^
+		      crc32_tab8[5][(one >> 16) & 0xff] ^
+		      crc32_tab8[4][one >> 24] ^ crc32_tab8[3][two & 0xff] ^
+		      crc32_tab8[2][(two >> 8) & 0xff] ^
+		      crc32_tab8[1][(two >> 16) & 0xff] ^
+		      crc32_tab8[0][two >> 24];
+		p += 8;
+		size -= 8;
+	}
+	return crc32_table_update(crc, p, size);
+}
+
+#ifdef CRC32_HW_PCLMUL
+/* Fold 64 bytes at a time with carry-less multiplication and reduce with
+ * Barrett reduction, from Intel's "Fast CRC Computation for Generic
+ * Polynomials Using PCLMULQDQ Instruction", the constants are for the
+ * reflected IEEE 802.3 polynomial. The SSE4.2 crc32 instruction can't be
+ * used, it computes the Castagnoli polynomial. size must be a multiple of
+ * 16 and at least 64. */
+__attribute__((target("pclmul,sse4.1"))) static uint32_t
+crc32_pclmul_fold(uint32_t crc, const uint8_t *p, size_t size)
+{
+	const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+	const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+	const __m128i k5k0 = _mm_set_epi64x(0, 0x0163cd6124);
+	const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+	const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+	__m128i x1, x2, x3, x4, x5, x6, x7, x8;
+
+	x1 = _mm_loadu_si128((const __m128i *)(p + 0x00));
+	x2 = _mm_loadu_si128((const __m128i *)(p + 0x10));
+	x3 = _mm_loadu_si128((const __m128i *)(p + 0x20));
+	x4 = _mm_loadu_si128((const __m128i *)(p + 0x30));
+	x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(crc));
+	p += 64;
+	size -= 64;
+
+	/* fold by 4 */
+	while (size >= 64) {
+		x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+		x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+		x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+		x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+		x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+		x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+		x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x5),
+				   _mm_loadu_si128((const __m128i *)(p + 0x00)));
+		x2 = _mm_xor_si128(_mm_xor_si128(x2, x6),
+				   _mm_loadu_si128((const __m128i *)(p + 0x10)));
+		x3 = _mm_xor_si128(_mm_xor_si128(x3, x7),
+				   _mm_loadu_si128((const __m128i *)(p + 0x20)));
+		x4 = _mm_xor_si128(_mm_xor_si128(x4, x8),
+				   _mm_loadu_si128((const __m128i *)(p + 0x30)));
+		p += 64;
+		size -= 64;
+	}
+
+	/* fold into 128 bits */
+	x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+	x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+	x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+	/* fold by 1 */
+	while (size >= 16) {
+		x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+		x1 = _mm_xor_si128(
+		    _mm_xor_si128(x1, _mm_loadu_si128((const __m128i *)p)),
+		    x5);
+		p += 16;
+		size -= 16;
+	}
+
+	/* fold 128 bits to 64 bits */
+	x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+	x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_and_si128(x1, mask32);
+	x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	/* Barrett reduction to 32 bits */
+	x2 = _mm_and_si128(x1, mask32);
+	x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+	x2 = _mm_and_si128(x2, mask32);
+	x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	return _mm_extract_epi32(x1, 1);
+}
+
+static uint32_t crc32_hw_update(uint32_t crc, const uint8_t *p, size_t size)
+{
+	if (size >= 64) {
+		size_t folded = size & ~(size_t)15;
+		crc = crc32_pclmul_fold(crc, p, folded);
+		p += folded;
+		size -= folded;
+	}
+	return crc32_slice8_update(crc, p, size);
+}
+
+static int crc32_hw_supported(void)
+{
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("pclmul") &&
+	       __builtin_cpu_supports("sse4.1");
+}
+#elif defined(CRC32_HW_ARMV8)
+/* The ARMv8 CRC32 instructions compute the IEEE 802.3 polynomial */
+__attribute__((target("+crc"))) static uint32_t
+crc32_hw_update(uint32_t crc, const uint8_t *p, size_t size)
+{
+	while (size && ((uintptr_t)p & 7)) {
+		crc = __crc32b(crc, *p++);
+		size--;
+	}
+	while (size >= 8) {
+		uint64_t value;
+		memcpy(&value, p, sizeof(value));
+		crc = __crc32d(crc, le64toh(value));
+		p += 8;
+		size -= 8;
+	}
+	while (size--)
+		crc = __crc32b(crc, *p++);
+	return crc;
+}
+
+static int crc32_hw_supported(void)
+{
+	return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+}
+#endif
+
+typedef uint32_t (*crc32_update_fn)(uint32_t crc, const uint8_t *p,
+				    size_t size);
+
+static crc32_update_fn crc32_update_impl = crc32_table_update;
+
+int crc32_select_impl(enum crc32_impl impl)
+{
+	switch (impl) {
+	case CRC32_IMPL_TABLE:
+		crc32_update_impl = crc32_table_update;
+		return 0;
+	case CRC32_IMPL_SLICE_BY_8:
+		crc32_update_impl = crc32_slice8_update;
+		return 0;
+	case CRC32_IMPL_HW:
+#if defined(CRC32_HW_PCLMUL) || defined(CRC32_HW_ARMV8)
+		if (crc32_hw_supported()) {
+			crc32_update_impl = crc32_hw_update;
+			return 0;
+		}
+#endif
+		return -1;
+	}
+	return -1;
+}
+
+/* Build the slice-by-8 tables and select the fastest crc32 implementation
+ * the CPU supports, before any caller can run */
+__attribute__((constructor)) static void crc_init(void)
+{
+	for (int n = 0; n < 256; n++) {
+		crc32_tab8[0][n] = crc32_tab[n];
+		crc8_tab8[0][n] = crc8_table[n];
+	}
+	for (int k = 1; k < 8; k++) {
+		for (int n = 0; n < 256; n++) {
+			uint32_t crc = crc32_tab8[k - 1][n];
+			crc32_tab8[k][n] = crc32_tab[crc & 0xff] ^ (crc >> 8);
+			crc8_tab8[k][n] = crc8_table[crc8_tab8[k - 1][n]];
+		}
+	}
+
+	if (crc32_select_impl(CRC32_IMPL_HW) != 0)
+		crc32_select_impl(CRC32_IMPL_SLICE_BY_8);
+}
+
+uint32_t crc32_update(uint32_t crc, const void *data, size_t size)
+{
+	return crc32_update_impl(crc ^ ~0U, data, size) ^ ~0U;
+}
+
+uint32_t crc32(const void *data, size_t size)
+{
+	return crc32_update(0, data, size);
+}
+
+/* Multiply a 32x32 matrix over GF(2) by a vector, the matrix is given by
+ * columns */
+static uint32_t gf2_matrix_times(const uint32_t *mat, uint32_t vec)
+{
+	uint32_t sum = 0;
+	while (vec) {
+		if (vec & 1)
+			sum ^= *mat;
+		vec >>= 1;
+		mat++;
+	}
+	return sum;
+}
+
+static void gf2_matrix_square(uint32_t *square, const uint32_t *mat)
+{
+	for (int n = 0; n < 32; n++)
+		square[n] = gf2_matrix_times(mat, mat[n]);
+}
+
+/* Feed size zero bytes to the crc register in O(log(size)), this is the
+ * operator used by zlib's crc32_combine() */
+static uint32_t crc32_zeros(uint32_t crc, size_t size)
+{
+	uint32_t even[32]; /* even power of two zero bits operator */
+	uint32_t odd[32];  /* odd power of two zero bits operator */
+	uint32_t row = 1;
+
+	if (size == 0)
+		return crc;
+
+	/* operator for one zero bit */
+	odd[0] = 0xedb88320;
+	for (int n = 1; n < 32; n++) {
+		odd[n] = row;
+		row <<= 1;
+	}
+	gf2_matrix_square(even, odd); /* two zero bits */
+	gf2_matrix_square(odd, even); /* four zero bits */
+
+	do {
+		gf2_matrix_square(even, odd);
+		if (size & 1)
+			crc = gf2_matrix_times(even, crc);
+		size >>= 1;
+		if (size == 0)
+			break;
+		gf2_matrix_square(odd, even);
+		if (size & 1)
+			crc = gf2_matrix_times(odd, crc);
+		size >>= 1;
+	} while (size != 0);
+
+	return crc;
+}
+
+uint32_t crc32_patch(uint32_t crc, const void *old_data, const void *new_data,
+		     size_t size, size_t tail_size)
+{
+	/* CRC is linear: the checksum changes by the register of the xor of the
+	 * old and new data, started from zero and followed by the tail, the
+	 * bytes before the range don't contribute */
+	const uint8_t *o = old_data;
+	const uint8_t *n = new_data;
+	uint32_t delta = 0;
+	while (size--)
+		delta = crc32_tab[(delta ^ *o++ ^ *n++) & 0xff] ^ (delta >> 8);
+	return crc ^ crc32_zeros(delta, tail_size);
+}
+
+static uint8_t crc8_table_update(uint8_t crc, const uint8_t *p, size_t size)
 {
-	const uint8_t *p = data;
-	uint8_t crc = 0x00;
 	while (size--)
 		crc = crc8_table[crc ^ *p++];
 	return crc;
 }
 
+static uint8_t crc8_slice8_update(uint8_t crc, const uint8_t *p, size_t size)
+{
+	while (size >= 8) {
+		crc = crc8_tab8[7][crc ^ p[0]] ^ crc8_tab8[6][p[1]] ^
+		      crc8_tab8[5][p[2]] ^ crc8_tab8[4][p[3]] ^
+		      crc8_tab8[3][p[4]] ^ crc8_tab8[2][p[5]] ^
+		      crc8_tab8[1][p[6]] ^ crc8_tab8[0][p[7]];
+		p += 8;
+		size -= 8;
+	}
+	return crc8_table_update(crc, p, size);
+}
+
+typedef uint8_t (*crc8_update_fn)(uint8_t crc, const uint8_t *p, size_t size);
+
+static crc8_update_fn crc8_update_impl = crc8_slice8_update;
+
+int crc8_select_impl(enum crc8_impl impl)
+{
+	switch (impl) {
+	case CRC8_IMPL_TABLE:
+		crc8_update_impl = crc8_table_update;
+		return 0;
+	case CRC8_IMPL_SLICE_BY_8:
+		crc8_update_impl = crc8_slice8_update;
+		return 0;
+	}
+	return -1;
+}
+
+uint8_t crc8_update(uint8_t crc, const void *data, size_t size)
+{
+	return crc8_update_impl(crc, data, size);
+}
+
+uint8_t crc8(const void *data, size_t size)
+{
+	return crc8_update(0, data, size);
+}
+
 static int print_version_field(uint8_t bcd, char *buffer, size_t buffer_size)
 {
 	int v;
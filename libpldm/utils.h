@@ -35,6 +35,73 @@ uint8_t crc8(const void *data, size_t size);
  */
 uint32_t crc32(const void *data, size_t size);
 
+/** @brief Continue a Crc8 computation with the next fragment of the data
+ *
+ *  crc8_update(crc8(a, m), b, n) is the crc8 of a followed by b.
+ *
+ *  @param[in] crc - The checksum of the preceding fragments, 0 for the first
+ *  @param[in] data - Pointer to the fragment
+ *  @param[in] size - Size of the fragment
+ *  @return The checksum of the data up to the end of the fragment
+ */
+uint8_t crc8_update(uint8_t crc, const void *data, size_t size);
+
+/** @brief Continue a Crc32 computation with the next fragment of the data
+ *
+ *  crc32_update(crc32(a, m), b, n) is the crc32 of a followed by b.
+ *
+ *  @param[in] crc - The checksum of the preceding fragments, 0 for the first
+ *  @param[in] data - Pointer to the fragment
+ *  @param[in] size - Size of the fragment
+ *  @return The checksum of the data up to the end of the fragment
+ */
+uint32_t crc32_update(uint32_t crc, const void *data, size_t size);
+
+/** @brief The implementations of crc32, they produce the same checksum
+ */
+enum crc32_impl {
+	CRC32_IMPL_TABLE,      /* one table lookup per byte */
+	CRC32_IMPL_SLICE_BY_8, /* eight table lookups per 8 bytes */
+	CRC32_IMPL_HW,	       /* PCLMULQDQ on x86, CRC32 on ARMv8 */
+};
+
+/** @brief Select the implementation of crc32, the fastest one supported by
+ *         the CPU is selected by default. Not thread safe, for testing and
+ *         benchmarking.
+ *
+ *  @param[in] impl - The implementation
+ *  @return 0 on success, -1 if the CPU doesn't support it
+ */
+int crc32_select_impl(enum crc32_impl impl);
+
+/** @brief The implementations of crc8, they produce the same checksum
+ */
+enum crc8_impl {
+	CRC8_IMPL_TABLE,      /* one table lookup per byte */
+	CRC8_IMPL_SLICE_BY_8, /* eight table lookups per 8 bytes */
+};
+
+/** @brief Select the implementation of crc8, slice-by-8 is selected by
+ *         default. Not thread safe, for testing and benchmarking.
+ *
+ *  @param[in] impl - The implementation
+ *  @return 0 on success, -1 if the implementation is unknown
+ */
+int crc8_select_impl(enum crc8_impl impl);
+
+/** @brief Update the Crc32 of a buffer after a range of it is overwritten,
+ *         without going through the rest of the buffer
+ *
+ *  @param[in] crc - The checksum of the buffer before the change
+ *  @param[in] old_data - Pointer to the range before the change
+ *  @param[in] new_data - Pointer to the range after the change
+ *  @param[in] size - Size of the range
+ *  @param[in] tail_size - Size of the buffer after the range
+ *  @return The checksum of the buffer after the change
+ */
+uint32_t crc32_patch(uint32_t crc, const void *old_data, const void *new_data,
+		     size_t size, size_t tail_size);
+
 /** @brief Convert ver32_t to string
  *  @param[in] version - Pointer to ver32_t
  *  @param[out] buffer - Pointer to the buffer
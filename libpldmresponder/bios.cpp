@@ -280,14 +280,12 @@ Response Handler::getBIOSAttributeCurrentValueByHandle(const pldm_msg* request,
         return ccOnlyResponse(request, rc);
     }
 
-    auto table = biosConfig.getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE);
-    if (!table)
+    if (!biosConfig.isTableAvailable(PLDM_BIOS_ATTR_VAL_TABLE))
     {
         return ccOnlyResponse(request, PLDM_BIOS_TABLE_UNAVAILABLE);
     }
 
-    auto entry = pldm_bios_table_attr_value_find_by_handle(
-        table->data(), table->size(), attributeHandle);
+    auto entry = biosConfig.findAttrValueEntry(attributeHandle);
     if (entry == nullptr)
     {
         return ccOnlyResponse(request, PLDM_INVALID_BIOS_ATTR_HANDLE);
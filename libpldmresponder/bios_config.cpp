@@ -38,6 +38,32 @@ constexpr auto stringTableFile = "stringTable";
 constexpr auto attrTableFile = "attributeTable";
 constexpr auto attrValueTableFile = "attributeValueTable";
 
+constexpr std::array<const char*, PLDM_BIOS_ATTR_VAL_TABLE + 1> tableFiles = {
+    stringTableFile, attrTableFile, attrValueTableFile};
+
+/** @brief Find an entry of the cached table by the offsets of its entries */
+template <typename T>
+const T* findEntry(const std::optional<Table>& table,
+                   const std::unordered_map<uint16_t, size_t>& offsets,
+                   uint16_t handle)
+{
+    if (!table)
+    {
+        return nullptr;
+    }
+    auto iter = offsets.find(handle);
+    if (iter == offsets.end())
+    {
+        return nullptr;
+    }
+    return reinterpret_cast<const T*>(table->data() + iter->second);
+}
+
+size_t offsetOf(const Table& table, const void* entry)
+{
+    return reinterpret_cast<const uint8_t*>(entry) - table.data();
+}
+
 } // namespace
 
 BIOSConfig::BIOSConfig(
@@ -50,6 +76,7 @@ BIOSConfig::BIOSConfig(
 
 {
     fs::create_directories(tableDir);
+    loadTables();
     constructAttributes();
     listenPendingAttributes();
 }
@@ -65,42 +92,72 @@ void BIOSConfig::buildTables()
 
 std::optional<Table> BIOSConfig::getBIOSTable(pldm_bios_table_types tableType)
 {
-    fs::path tablePath;
-    switch (tableType)
+    if (tableType > PLDM_BIOS_ATTR_VAL_TABLE)
     {
-        case PLDM_BIOS_STRING_TABLE:
-            tablePath = tableDir / stringTableFile;
-            break;
-        case PLDM_BIOS_ATTR_TABLE:
-            tablePath = tableDir / attrTableFile;
-            break;
-        case PLDM_BIOS_ATTR_VAL_TABLE:
-            tablePath = tableDir / attrValueTableFile;
-            break;
+        return std::nullopt;
     }
-    return loadTable(tablePath);
+    return tables[tableType];
+}
+
+bool BIOSConfig::isTableAvailable(pldm_bios_table_types tableType) const
+{
+    return tableType <= PLDM_BIOS_ATTR_VAL_TABLE &&
+           tables[tableType].has_value();
+}
+
+const pldm_bios_attr_val_table_entry*
+    BIOSConfig::findAttrValueEntry(uint16_t attrHandle) const
+{
+    return findEntry<pldm_bios_attr_val_table_entry>(
+        tables[PLDM_BIOS_ATTR_VAL_TABLE], attrValueOffsets, attrHandle);
+}
+
+const pldm_bios_attr_table_entry*
+    BIOSConfig::findAttrEntry(uint16_t attrHandle) const
+{
+    return findEntry<pldm_bios_attr_table_entry>(tables[PLDM_BIOS_ATTR_TABLE],
+                                                 attrOffsets, attrHandle);
+}
+
+const pldm_bios_string_table_entry*
+    BIOSConfig::findStringEntry(uint16_t handle) const
+{
+    return findEntry<pldm_bios_string_table_entry>(
+        tables[PLDM_BIOS_STRING_TABLE], stringOffsets, handle);
+}
+
+std::string BIOSConfig::CachedStringTable::findString(uint16_t handle) const
+{
+    auto stringEntry = config.findStringEntry(handle);
+    if (stringEntry == nullptr)
+    {
+        throw std::invalid_argument("Invalid String Handle");
+    }
+    return table::string::decodeString(stringEntry);
+}
+
+uint16_t
+    BIOSConfig::CachedStringTable::findHandle(const std::string& name) const
+{
+    auto iter = config.stringHandles.find(name);
+    if (iter == config.stringHandles.end())
+    {
+        throw std::invalid_argument("Invalid String Name");
+    }
+    return iter->second;
 }
 
 int BIOSConfig::setBIOSTable(uint8_t tableType, const Table& table,
                              bool updateBaseBIOSTable)
 {
-    fs::path stringTablePath(tableDir / stringTableFile);
-    fs::path attrTablePath(tableDir / attrTableFile);
-    fs::path attrValueTablePath(tableDir / attrValueTableFile);
-
     if (!pldm_bios_table_checksum(table.data(), table.size()))
     {
         return PLDM_INVALID_BIOS_TABLE_DATA_INTEGRITY_CHECK;
     }
 
-    if (tableType == PLDM_BIOS_STRING_TABLE)
-    {
-        storeTable(stringTablePath, table);
-    }
-    else if (tableType == PLDM_BIOS_ATTR_TABLE)
+    if (tableType == PLDM_BIOS_ATTR_TABLE)
     {
-        BIOSTable biosStringTable(stringTablePath.c_str());
-        if (biosStringTable.isEmpty())
+        if (!tables[PLDM_BIOS_STRING_TABLE])
         {
             return PLDM_INVALID_BIOS_TABLE_TYPE;
         }
@@ -110,14 +167,10 @@ int BIOSConfig::setBIOSTable(uint8_t tableType, const Table& table,
         {
             return rc;
         }
-
-        storeTable(attrTablePath, table);
     }
     else if (tableType == PLDM_BIOS_ATTR_VAL_TABLE)
     {
-        BIOSTable biosStringTable(stringTablePath.c_str());
-        BIOSTable biosStringValueTable(attrTablePath.c_str());
-        if (biosStringTable.isEmpty() || biosStringValueTable.isEmpty())
+        if (!tables[PLDM_BIOS_STRING_TABLE] || !tables[PLDM_BIOS_ATTR_TABLE])
         {
             return PLDM_INVALID_BIOS_TABLE_TYPE;
         }
@@ -127,14 +180,14 @@ int BIOSConfig::setBIOSTable(uint8_t tableType, const Table& table,
         {
             return rc;
         }
-
-        storeTable(attrValueTablePath, table);
     }
-    else
+    else if (tableType != PLDM_BIOS_STRING_TABLE)
     {
         return PLDM_INVALID_BIOS_TABLE_TYPE;
     }
 
+    cacheTable(static_cast<pldm_bios_table_types>(tableType), Table(table));
+
     if ((tableType == PLDM_BIOS_ATTR_VAL_TABLE) && updateBaseBIOSTable)
     {
         std::cout << "setBIOSTable:: updateBaseBIOSTableProperty() "
@@ -148,16 +201,13 @@ int BIOSConfig::setBIOSTable(uint8_t tableType, const Table& table,
 int BIOSConfig::checkAttributeTable(const Table& table)
 {
     using namespace pldm::bios::utils;
-    auto stringTable = getBIOSTable(PLDM_BIOS_STRING_TABLE);
     for (auto entry :
          BIOSTableIter<PLDM_BIOS_ATTR_TABLE>(table.data(), table.size()))
     {
         auto attrNameHandle =
             pldm_bios_table_attr_entry_decode_string_handle(entry);
 
-        auto stringEnty = pldm_bios_table_string_find_by_handle(
-            stringTable->data(), stringTable->size(), attrNameHandle);
-        if (stringEnty == nullptr)
+        if (findStringEntry(attrNameHandle) == nullptr)
         {
             return PLDM_INVALID_BIOS_ATTR_HANDLE;
         }
@@ -183,9 +233,7 @@ int BIOSConfig::checkAttributeTable(const Table& table)
 
                 for (size_t i = 0; i < pvHandls.size(); i++)
                 {
-                    auto stringEntry = pldm_bios_table_string_find_by_handle(
-                        stringTable->data(), stringTable->size(), pvHandls[i]);
-                    if (stringEntry == nullptr)
+                    if (findStringEntry(pvHandls[i]) == nullptr)
                     {
                         return PLDM_INVALID_BIOS_ATTR_HANDLE;
                     }
@@ -193,10 +241,7 @@ int BIOSConfig::checkAttributeTable(const Table& table)
 
                 for (size_t i = 0; i < defIndices.size(); i++)
                 {
-                    auto stringEntry = pldm_bios_table_string_find_by_handle(
-                        stringTable->data(), stringTable->size(),
-                        pvHandls[defIndices[i]]);
-                    if (stringEntry == nullptr)
+                    if (findStringEntry(pvHandls[defIndices[i]]) == nullptr)
                     {
                         return PLDM_INVALID_BIOS_ATTR_HANDLE;
                     }
@@ -221,8 +266,6 @@ int BIOSConfig::checkAttributeTable(const Table& table)
 int BIOSConfig::checkAttributeValueTable(const Table& table)
 {
     using namespace pldm::bios::utils;
-    auto stringTable = getBIOSTable(PLDM_BIOS_STRING_TABLE);
-    auto attrTable = getBIOSTable(PLDM_BIOS_ATTR_TABLE);
 
     baseBIOSTableMaps.clear();
 
@@ -230,207 +273,202 @@ int BIOSConfig::checkAttributeValueTable(const Table& table)
          BIOSTableIter<PLDM_BIOS_ATTR_VAL_TABLE>(table.data(), table.size()))
     {
         AttributeName attributeName{};
-        AttributeType attributeType{};
-        ReadonlyStatus readonlyStatus{};
-        DisplayName displayName{};
-        Description description{};
-        MenuPath menuPath{};
-        CurrentValue currentValue{};
-        DefaultValue defaultValue{};
-        Option options{};
-
-        auto attrValueHandle =
-            pldm_bios_table_attr_value_entry_decode_attribute_handle(
-                tableEntry);
-        auto attrType = static_cast<pldm_bios_attribute_type>(
-            pldm_bios_table_attr_value_entry_decode_attribute_type(tableEntry));
-
-        auto attrEntry = pldm_bios_table_attr_find_by_handle(
-            attrTable->data(), attrTable->size(), attrValueHandle);
-        if (attrEntry == nullptr)
-        {
-            return PLDM_INVALID_BIOS_ATTR_HANDLE;
-        }
-        auto attrHandle =
-            pldm_bios_table_attr_entry_decode_attribute_handle(attrEntry);
-        auto attrNameHandle =
-            pldm_bios_table_attr_entry_decode_string_handle(attrEntry);
-
-        auto stringEntry = pldm_bios_table_string_find_by_handle(
-            stringTable->data(), stringTable->size(), attrNameHandle);
-        if (stringEntry == nullptr)
-        {
-            return PLDM_INVALID_BIOS_ATTR_HANDLE;
-        }
-        auto strLength =
-            pldm_bios_table_string_entry_decode_string_length(stringEntry);
-        std::vector<char> buffer(strLength + 1 /* sizeof '\0' */);
-        pldm_bios_table_string_entry_decode_string(stringEntry, buffer.data(),
-                                                   buffer.size());
-        attributeName = std::string(buffer.data(), buffer.data() + strLength);
-
-        if (!biosAttributes.empty())
+        BIOSTableObj biosTableObj{};
+        auto rc = decodeAttrValueEntry(tableEntry, attributeName, biosTableObj);
+        if (rc != PLDM_SUCCESS)
         {
-            readonlyStatus =
-                biosAttributes[attrHandle % biosAttributes.size()]->readOnly;
-            description =
-                biosAttributes[attrHandle % biosAttributes.size()]->helpText;
-            displayName =
-                biosAttributes[attrHandle % biosAttributes.size()]->displayName;
+            return rc;
         }
+        baseBIOSTableMaps.emplace(std::move(attributeName),
+                                  std::move(biosTableObj));
+    }
 
-        switch (attrType)
-        {
-            case PLDM_BIOS_ENUMERATION:
-            case PLDM_BIOS_ENUMERATION_READ_ONLY:
-            {
-                auto getValue = [](uint16_t handle,
-                                   const Table& table) -> std::string {
-                    auto stringEntry = pldm_bios_table_string_find_by_handle(
-                        table.data(), table.size(), handle);
-                    if (stringEntry == nullptr)
-                    {
-                        return {};
-                    }
-
-                    auto strLength =
-                        pldm_bios_table_string_entry_decode_string_length(
-                            stringEntry);
-                    std::vector<char> buffer(strLength + 1 /* sizeof '\0' */);
-                    pldm_bios_table_string_entry_decode_string(
-                        stringEntry, buffer.data(), buffer.size());
+    return PLDM_SUCCESS;
+}
 
-                    return std::string(buffer.data(),
-                                       buffer.data() + strLength);
-                };
+int BIOSConfig::decodeAttrValueEntry(
+    const pldm_bios_attr_val_table_entry* attrValueEntry,
+    AttributeName& attributeName, BIOSTableObj& biosTableObj) const
+{
+    AttributeType attributeType{};
+    ReadonlyStatus readonlyStatus{};
+    DisplayName displayName{};
+    Description description{};
+    MenuPath menuPath{};
+    CurrentValue currentValue{};
+    DefaultValue defaultValue{};
+    Option options{};
+
+    auto attrValueHandle =
+        pldm_bios_table_attr_value_entry_decode_attribute_handle(
+            attrValueEntry);
+    auto attrType = static_cast<pldm_bios_attribute_type>(
+        pldm_bios_table_attr_value_entry_decode_attribute_type(attrValueEntry));
+
+    auto attrEntry = findAttrEntry(attrValueHandle);
+    if (attrEntry == nullptr)
+    {
+        return PLDM_INVALID_BIOS_ATTR_HANDLE;
+    }
+    auto attrHandle =
+        pldm_bios_table_attr_entry_decode_attribute_handle(attrEntry);
+    auto attrNameHandle =
+        pldm_bios_table_attr_entry_decode_string_handle(attrEntry);
 
-                attributeType = "xyz.openbmc_project.BIOSConfig.Manager."
-                                "AttributeType.Enumeration";
+    auto stringEntry = findStringEntry(attrNameHandle);
+    if (stringEntry == nullptr)
+    {
+        return PLDM_INVALID_BIOS_ATTR_HANDLE;
+    }
+    attributeName = table::string::decodeString(stringEntry);
 
-                auto pvNum =
-                    pldm_bios_table_attr_entry_enum_decode_pv_num(attrEntry);
-                std::vector<uint16_t> pvHandls(pvNum);
-                pldm_bios_table_attr_entry_enum_decode_pv_hdls(
-                    attrEntry, pvHandls.data(), pvHandls.size());
+    if (!biosAttributes.empty())
+    {
+        readonlyStatus =
+            biosAttributes[attrHandle % biosAttributes.size()]->readOnly;
+        description =
+            biosAttributes[attrHandle % biosAttributes.size()]->helpText;
+        displayName =
+            biosAttributes[attrHandle % biosAttributes.size()]->displayName;
+    }
 
-                // get possible_value
-                for (size_t i = 0; i < pvHandls.size(); i++)
+    switch (attrType)
+    {
+        case PLDM_BIOS_ENUMERATION:
+        case PLDM_BIOS_ENUMERATION_READ_ONLY:
+        {
+            auto getValue = [this](uint16_t handle) -> std::string {
+                auto stringEntry = findStringEntry(handle);
+                if (stringEntry == nullptr)
                 {
-                    auto currentValue = getValue(pvHandls[i], *stringTable);
-                    if (currentValue.empty())
-                    {
-                        return PLDM_INVALID_BIOS_ATTR_HANDLE;
-                    }
-                    options.push_back(
-                        std::make_tuple("xyz.openbmc_project.BIOSConfig."
-                                        "Manager.BoundType.OneOf",
-                                        currentValue));
+                    return {};
                 }
+                return table::string::decodeString(stringEntry);
+            };
 
-                auto count =
-                    pldm_bios_table_attr_value_entry_enum_decode_number(
-                        tableEntry);
-                std::vector<uint8_t> handles(count);
-                pldm_bios_table_attr_value_entry_enum_decode_handles(
-                    tableEntry, handles.data(), handles.size());
-
-                // get current_value
-                for (size_t i = 0; i < handles.size(); i++)
-                {
-                    currentValue = getValue(pvHandls[handles[i]], *stringTable);
-                }
+            attributeType = "xyz.openbmc_project.BIOSConfig.Manager."
+                            "AttributeType.Enumeration";
 
-                auto defNum =
-                    pldm_bios_table_attr_entry_enum_decode_def_num(attrEntry);
-                std::vector<uint8_t> defIndices(defNum);
-                pldm_bios_table_attr_entry_enum_decode_def_indices(
-                    attrEntry, defIndices.data(), defIndices.size());
+            auto pvNum =
+                pldm_bios_table_attr_entry_enum_decode_pv_num(attrEntry);
+            std::vector<uint16_t> pvHandls(pvNum);
+            pldm_bios_table_attr_entry_enum_decode_pv_hdls(
+                attrEntry, pvHandls.data(), pvHandls.size());
 
-                // get default_value
-                for (size_t i = 0; i < defIndices.size(); i++)
+            // get possible_value
+            for (size_t i = 0; i < pvHandls.size(); i++)
+            {
+                auto currentValue = getValue(pvHandls[i]);
+                if (currentValue.empty())
                 {
-                    defaultValue =
-                        getValue(pvHandls[defIndices[i]], *stringTable);
+                    return PLDM_INVALID_BIOS_ATTR_HANDLE;
                 }
-
-                break;
-            }
-            case PLDM_BIOS_INTEGER:
-            case PLDM_BIOS_INTEGER_READ_ONLY:
-            {
-                attributeType = "xyz.openbmc_project.BIOSConfig.Manager."
-                                "AttributeType.Integer";
-                currentValue = static_cast<int64_t>(
-                    pldm_bios_table_attr_value_entry_integer_decode_cv(
-                        tableEntry));
-
-                uint64_t lower, upper, def;
-                uint32_t scalar;
-                pldm_bios_table_attr_entry_integer_decode(
-                    attrEntry, &lower, &upper, &scalar, &def);
                 options.push_back(
-                    std::make_tuple("xyz.openbmc_project.BIOSConfig.Manager."
-                                    "BoundType.LowerBound",
-                                    static_cast<int64_t>(lower)));
-                options.push_back(
-                    std::make_tuple("xyz.openbmc_project.BIOSConfig.Manager."
-                                    "BoundType.UpperBound",
-                                    static_cast<int64_t>(upper)));
-                options.push_back(
-                    std::make_tuple("xyz.openbmc_project.BIOSConfig.Manager."
-                                    "BoundType.ScalarIncrement",
-                                    static_cast<int64_t>(scalar)));
-                defaultValue = static_cast<int64_t>(def);
-                break;
+                    std::make_tuple("xyz.openbmc_project.BIOSConfig."
+                                    "Manager.BoundType.OneOf",
+                                    currentValue));
             }
-            case PLDM_BIOS_STRING:
-            case PLDM_BIOS_STRING_READ_ONLY:
+
+            auto count =
+                pldm_bios_table_attr_value_entry_enum_decode_number(
+                    attrValueEntry);
+            std::vector<uint8_t> handles(count);
+            pldm_bios_table_attr_value_entry_enum_decode_handles(
+                attrValueEntry, handles.data(), handles.size());
+
+            // get current_value
+            for (size_t i = 0; i < handles.size(); i++)
             {
-                attributeType = "xyz.openbmc_project.BIOSConfig.Manager."
-                                "AttributeType.String";
-                variable_field currentString;
-                pldm_bios_table_attr_value_entry_string_decode_string(
-                    tableEntry, &currentString);
-                currentValue = std::string(
-                    reinterpret_cast<const char*>(currentString.ptr),
-                    currentString.length);
-                auto min = pldm_bios_table_attr_entry_string_decode_min_length(
-                    attrEntry);
-                auto max = pldm_bios_table_attr_entry_string_decode_max_length(
-                    attrEntry);
-                auto def =
-                    pldm_bios_table_attr_entry_string_decode_def_string_length(
-                        attrEntry);
-                std::vector<char> defString(def + 1);
-                pldm_bios_table_attr_entry_string_decode_def_string(
-                    attrEntry, defString.data(), defString.size());
-                options.push_back(
-                    std::make_tuple("xyz.openbmc_project.BIOSConfig.Manager."
-                                    "BoundType.MinStringLength",
-                                    static_cast<int64_t>(min)));
-                options.push_back(
-                    std::make_tuple("xyz.openbmc_project.BIOSConfig.Manager."
-                                    "BoundType.MaxStringLength",
-                                    static_cast<int64_t>(max)));
-                defaultValue = defString.data();
-                break;
+                currentValue = getValue(pvHandls[handles[i]]);
             }
-            case PLDM_BIOS_PASSWORD:
-            case PLDM_BIOS_PASSWORD_READ_ONLY:
+
+            auto defNum =
+                pldm_bios_table_attr_entry_enum_decode_def_num(attrEntry);
+            std::vector<uint8_t> defIndices(defNum);
+            pldm_bios_table_attr_entry_enum_decode_def_indices(
+                attrEntry, defIndices.data(), defIndices.size());
+
+            // get default_value
+            for (size_t i = 0; i < defIndices.size(); i++)
             {
-                attributeType = "xyz.openbmc_project.BIOSConfig.Manager."
-                                "AttributeType.Password";
-                break;
+                defaultValue = getValue(pvHandls[defIndices[i]]);
             }
-            default:
-                return PLDM_INVALID_BIOS_ATTR_HANDLE;
+
+            break;
         }
-        baseBIOSTableMaps.emplace(
-            std::move(attributeName),
-            std::make_tuple(attributeType, readonlyStatus, displayName,
-                            description, menuPath, currentValue, defaultValue,
-                            std::move(options)));
+        case PLDM_BIOS_INTEGER:
+        case PLDM_BIOS_INTEGER_READ_ONLY:
+        {
+            attributeType = "xyz.openbmc_project.BIOSConfig.Manager."
+                            "AttributeType.Integer";
+            currentValue = static_cast<int64_t>(
+                pldm_bios_table_attr_value_entry_integer_decode_cv(
+                    attrValueEntry));
+
+            uint64_t lower, upper, def;
+            uint32_t scalar;
+            pldm_bios_table_attr_entry_integer_decode(
+                attrEntry, &lower, &upper, &scalar, &def);
+            options.push_back(
+                std::make_tuple("xyz.openbmc_project.BIOSConfig.Manager."
+                                "BoundType.LowerBound",
+                                static_cast<int64_t>(lower)));
+            options.push_back(
+                std::make_tuple("xyz.openbmc_project.BIOSConfig.Manager."
+                                "BoundType.UpperBound",
+                                static_cast<int64_t>(upper)));
+            options.push_back(
+                std::make_tuple("xyz.openbmc_project.BIOSConfig.Manager."
+                                "BoundType.ScalarIncrement",
+                                static_cast<int64_t>(scalar)));
+            defaultValue = static_cast<int64_t>(def);
+            break;
+        }
+        case PLDM_BIOS_STRING:
+        case PLDM_BIOS_STRING_READ_ONLY:
+        {
+            attributeType = "xyz.openbmc_project.BIOSConfig.Manager."
+                            "AttributeType.String";
+            variable_field currentString;
+            pldm_bios_table_attr_value_entry_string_decode_string(
+                attrValueEntry, &currentString);
+            currentValue = std::string(
+                reinterpret_cast<const char*>(currentString.ptr),
+                currentString.length);
+            auto min = pldm_bios_table_attr_entry_string_decode_min_length(
+                attrEntry);
+            auto max = pldm_bios_table_attr_entry_string_decode_max_length(
+                attrEntry);
+            auto def =
+                pldm_bios_table_attr_entry_string_decode_def_string_length(
+                    attrEntry);
+            std::vector<char> defString(def + 1);
+            pldm_bios_table_attr_entry_string_decode_def_string(
+                attrEntry, defString.data(), defString.size());
+            options.push_back(
+                std::make_tuple("xyz.openbmc_project.BIOSConfig.Manager."
+                                "BoundType.MinStringLength",
+                                static_cast<int64_t>(min)));
+            options.push_back(
+                std::make_tuple("xyz.openbmc_project.BIOSConfig.Manager."
+                                "BoundType.MaxStringLength",
+                                static_cast<int64_t>(max)));
+            defaultValue = defString.data();
+            break;
+        }
+        case PLDM_BIOS_PASSWORD:
+        case PLDM_BIOS_PASSWORD_READ_ONLY:
+        {
+            attributeType = "xyz.openbmc_project.BIOSConfig.Manager."
+                            "AttributeType.Password";
+            break;
+        }
+        default:
+            return PLDM_INVALID_BIOS_ATTR_HANDLE;
     }
+    biosTableObj = std::make_tuple(attributeType, readonlyStatus, displayName,
+                                   description, menuPath, currentValue,
+                                   defaultValue, std::move(options));
 
     return PLDM_SUCCESS;
 }
@@ -588,6 +626,85 @@ void BIOSConfig::storeTable(const fs::path& path, const Table& table)
     biosTable.store(table);
 }
 
+void BIOSConfig::loadTables()
+{
+    for (auto tableType : {PLDM_BIOS_STRING_TABLE, PLDM_BIOS_ATTR_TABLE,
+                           PLDM_BIOS_ATTR_VAL_TABLE})
+    {
+        tables[tableType] = loadTable(tableDir / tableFiles[tableType]);
+    }
+    indexTable(PLDM_BIOS_STRING_TABLE);
+    indexTable(PLDM_BIOS_ATTR_VAL_TABLE);
+}
+
+void BIOSConfig::cacheTable(pldm_bios_table_types tableType, Table&& table)
+{
+    storeTable(tableDir / tableFiles[tableType], table);
+    tables[tableType] = std::move(table);
+    indexTable(tableType);
+}
+
+void BIOSConfig::indexTable(pldm_bios_table_types tableType)
+{
+    using namespace pldm::bios::utils;
+    const auto& table = tables[tableType];
+
+    switch (tableType)
+    {
+        case PLDM_BIOS_STRING_TABLE:
+            stringOffsets.clear();
+            stringHandles.clear();
+            if (table)
+            {
+                for (auto entry : BIOSTableIter<PLDM_BIOS_STRING_TABLE>(
+                         table->data(), table->size()))
+                {
+                    auto handle = table::string::decodeHandle(entry);
+                    stringOffsets.emplace(handle, offsetOf(*table, entry));
+                    stringHandles.emplace(table::string::decodeString(entry),
+                                          handle);
+                }
+            }
+            // the attribute names are indexed from the string table
+            indexTable(PLDM_BIOS_ATTR_TABLE);
+            break;
+        case PLDM_BIOS_ATTR_TABLE:
+            attrOffsets.clear();
+            attrHandles.clear();
+            if (table)
+            {
+                for (auto entry : BIOSTableIter<PLDM_BIOS_ATTR_TABLE>(
+                         table->data(), table->size()))
+                {
+                    auto header = table::attribute::decodeHeader(entry);
+                    attrOffsets.emplace(header.attrHandle,
+                                        offsetOf(*table, entry));
+                    auto stringEntry = findStringEntry(header.stringHandle);
+                    if (stringEntry != nullptr)
+                    {
+                        attrHandles.emplace(
+                            table::string::decodeString(stringEntry),
+                            header.attrHandle);
+                    }
+                }
+            }
+            break;
+        case PLDM_BIOS_ATTR_VAL_TABLE:
+            attrValueOffsets.clear();
+            if (table)
+            {
+                for (auto entry : BIOSTableIter<PLDM_BIOS_ATTR_VAL_TABLE>(
+                         table->data(), table->size()))
+                {
+                    attrValueOffsets.emplace(
+                        table::attribute_value::decodeHeader(entry).attrHandle,
+                        offsetOf(*table, entry));
+                }
+            }
+            break;
+    }
+}
+
 std::optional<Table> BIOSConfig::loadTable(const fs::path& path)
 {
     BIOSTable biosTable(path.c_str());
@@ -636,7 +753,7 @@ void BIOSConfig::load(const fs::path& filePath, ParseHandler handler)
 
 int BIOSConfig::checkAttrValueToUpdate(
     const pldm_bios_attr_val_table_entry* attrValueEntry,
-    const pldm_bios_attr_table_entry* attrEntry, Table&)
+    const pldm_bios_attr_table_entry* attrEntry)
 
 {
     auto [attrHandle, attrType] =
@@ -705,10 +822,9 @@ int BIOSConfig::checkAttrValueToUpdate(
 int BIOSConfig::setAttrValue(const void* entry, size_t size, bool updateDBus,
                              bool updateBaseBIOSTable)
 {
-    auto attrValueTable = getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE);
-    auto attrTable = getBIOSTable(PLDM_BIOS_ATTR_TABLE);
-    auto stringTable = getBIOSTable(PLDM_BIOS_STRING_TABLE);
-    if (!attrValueTable || !attrTable || !stringTable)
+    auto& attrValueTable = tables[PLDM_BIOS_ATTR_VAL_TABLE];
+    if (!attrValueTable || !tables[PLDM_BIOS_ATTR_TABLE] ||
+        !tables[PLDM_BIOS_STRING_TABLE])
     {
         return PLDM_BIOS_TABLE_UNAVAILABLE;
     }
@@ -718,46 +834,44 @@ int BIOSConfig::setAttrValue(const void* entry, size_t size, bool updateDBus,
 
     auto attrValHeader = table::attribute_value::decodeHeader(attrValueEntry);
 
-    auto attrEntry =
-        table::attribute::findByHandle(*attrTable, attrValHeader.attrHandle);
+    auto attrEntry = findAttrEntry(attrValHeader.attrHandle);
     if (!attrEntry)
     {
         return PLDM_ERROR;
     }
 
-    auto rc = checkAttrValueToUpdate(attrValueEntry, attrEntry, *stringTable);
+    auto rc = checkAttrValueToUpdate(attrValueEntry, attrEntry);
     if (rc != PLDM_SUCCESS)
     {
         return rc;
     }
 
-    auto destTable =
-        table::attribute_value::updateTable(*attrValueTable, entry, size);
-
-    if (!destTable)
+    auto oldEntry = findAttrValueEntry(attrValHeader.attrHandle);
+    if (!oldEntry ||
+        table::attribute_value::decodeHeader(oldEntry).attrType !=
+            attrValHeader.attrType)
     {
         return PLDM_ERROR;
     }
+    auto offset = attrValueOffsets.at(attrValHeader.attrHandle);
+    auto oldLength = pldm_bios_table_attr_value_entry_length(oldEntry);
 
     try
     {
         auto attrHeader = table::attribute::decodeHeader(attrEntry);
 
-        BIOSStringTable biosStringTable(*stringTable);
+        CachedStringTable biosStringTable(*this);
         auto attrName = biosStringTable.findString(attrHeader.stringHandle);
 
-        auto iter = std::find_if(
-            biosAttributes.begin(), biosAttributes.end(),
-            [&attrName](const auto& attr) { return attr->name == attrName; });
-
-        if (iter == biosAttributes.end())
+        auto iter = biosAttrIndices.find(attrName);
+        if (iter == biosAttrIndices.end())
         {
             return PLDM_ERROR;
         }
         if (updateDBus)
         {
-            (*iter)->setAttrValueOnDbus(attrValueEntry, attrEntry,
-                                        biosStringTable);
+            biosAttributes[iter->second]->setAttrValueOnDbus(
+                attrValueEntry, attrEntry, biosStringTable);
         }
     }
     catch (const std::exception& e)
@@ -766,7 +880,32 @@ int BIOSConfig::setAttrValue(const void* entry, size_t size, bool updateDBus,
         return PLDM_ERROR;
     }
 
-    setBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE, *destTable, updateBaseBIOSTable);
+    // Only the updated attribute changes in the BaseBIOSTable
+    AttributeName attributeName{};
+    BIOSTableObj biosTableObj{};
+    rc = decodeAttrValueEntry(attrValueEntry, attributeName, biosTableObj);
+
+    if (!table::attribute_value::updateTableInPlace(*attrValueTable, offset,
+                                                    entry, size))
+    {
+        return PLDM_ERROR;
+    }
+    // The offsets of the other entries only move if the entry length changes
+    if (pldm_bios_table_attr_value_entry_length(attrValueEntry) != oldLength)
+    {
+        indexTable(PLDM_BIOS_ATTR_VAL_TABLE);
+    }
+    storeTable(tableDir / attrValueTableFile, *attrValueTable);
+
+    if (rc == PLDM_SUCCESS)
+    {
+        baseBIOSTableMaps.insert_or_assign(std::move(attributeName),
+                                           std::move(biosTableObj));
+        if (updateBaseBIOSTable)
+        {
+            updateBaseBIOSTableProperty();
+        }
+    }
 
     return PLDM_SUCCESS;
 }
@@ -783,6 +922,13 @@ void BIOSConfig::removeTables()
     {
         std::cerr << "Remove the tables error: " << e.what() << std::endl;
     }
+
+    for (auto& table : tables)
+    {
+        table.reset();
+    }
+    indexTable(PLDM_BIOS_STRING_TABLE);
+    indexTable(PLDM_BIOS_ATTR_VAL_TABLE);
 }
 
 void BIOSConfig::processBiosAttrChangeNotification(
@@ -799,46 +945,24 @@ void BIOSConfig::processBiosAttrChangeNotification(
     }
 
     PropertyValue newPropVal = it->second;
-    auto stringTable = getBIOSTable(PLDM_BIOS_STRING_TABLE);
-    if (!stringTable.has_value())
+    if (!tables[PLDM_BIOS_STRING_TABLE] || !tables[PLDM_BIOS_ATTR_TABLE])
     {
-        std::cerr << "BIOS string table unavailable\n";
-        return;
-    }
-    BIOSStringTable biosStringTable(*stringTable);
-    uint16_t attrNameHdl{};
-    try
-    {
-        attrNameHdl = biosStringTable.findHandle(attrName);
-    }
-    catch (const std::invalid_argument& e)
-    {
-        std::cerr << "Could not find handle for BIOS string, ATTRIBUTE="
-                  << attrName.c_str() << "\n";
+        std::cerr << "BIOS string or attribute table unavailable\n";
         return;
     }
 
-    auto attrTable = getBIOSTable(PLDM_BIOS_ATTR_TABLE);
-    if (!attrTable.has_value())
-    {
-        std::cerr << "Attribute table not present\n";
-        return;
-    }
-    const struct pldm_bios_attr_table_entry* tableEntry =
-        table::attribute::findByStringHandle(*attrTable, attrNameHdl);
-    if (tableEntry == nullptr)
+    auto attrIter = attrHandles.find(attrName);
+    if (attrIter == attrHandles.end())
     {
         std::cerr << "Attribute not found in attribute table, name= "
-                  << attrName.c_str() << "name handle=" << attrNameHdl << "\n";
+                  << attrName.c_str() << "\n";
         return;
     }
 
     auto [attrHdl, attrType, stringHdl] =
-        table::attribute::decodeHeader(tableEntry);
+        table::attribute::decodeHeader(findAttrEntry(attrIter->second));
 
-    auto attrValueSrcTable = getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE);
-
-    if (!attrValueSrcTable.has_value())
+    if (!tables[PLDM_BIOS_ATTR_VAL_TABLE])
     {
         std::cerr << "Attribute value table not present\n";
         return;
@@ -854,12 +978,6 @@ void BIOSConfig::processBiosAttrChangeNotification(
                   << attrHdl << " and type=" << (uint32_t)attrType << "\n";
         return;
     }
-    auto destTable = table::attribute_value::updateTable(
-        *attrValueSrcTable, newValue.data(), newValue.size());
-    if (destTable.has_value())
-    {
-        storeTable(tableDir / attrValueTableFile, *destTable);
-    }
 
     rc = setAttrValue(newValue.data(), newValue.size(), false);
     if (rc != PLDM_SUCCESS)
@@ -871,25 +989,12 @@ void BIOSConfig::processBiosAttrChangeNotification(
 
 uint16_t BIOSConfig::findAttrHandle(const std::string& attrName)
 {
-    auto stringTable = getBIOSTable(PLDM_BIOS_STRING_TABLE);
-    auto attrTable = getBIOSTable(PLDM_BIOS_ATTR_TABLE);
-
-    BIOSStringTable biosStringTable(*stringTable);
-    pldm::bios::utils::BIOSTableIter<PLDM_BIOS_ATTR_TABLE> attrTableIter(
-        attrTable->data(), attrTable->size());
-    auto stringHandle = biosStringTable.findHandle(attrName);
-
-    for (auto entry : pldm::bios::utils::BIOSTableIter<PLDM_BIOS_ATTR_TABLE>(
-             attrTable->data(), attrTable->size()))
+    auto iter = attrHandles.find(attrName);
+    if (iter == attrHandles.end())
     {
-        auto header = table::attribute::decodeHeader(entry);
-        if (header.stringHandle == stringHandle)
-        {
-            return header.attrHandle;
-        }
+        throw std::invalid_argument("Unknow attribute Name");
     }
-
-    throw std::invalid_argument("Unknow attribute Name");
+    return iter->second;
 }
 
 void BIOSConfig::constructPendingAttribute(
@@ -902,12 +1007,8 @@ void BIOSConfig::constructPendingAttribute(
         std::string attributeName = attribute.first;
         auto& [attributeType, attributevalue] = attribute.second;
 
-        auto iter = std::find_if(biosAttributes.begin(), biosAttributes.end(),
-                                 [&attributeName](const auto& attr) {
-                                     return attr->name == attributeName;
-                                 });
-
-        if (iter == biosAttributes.end())
+        auto iter = biosAttrIndices.find(attributeName);
+        if (iter == biosAttrIndices.end())
         {
             std::cerr << "Wrong attribute name, attributeName = "
                       << attributeName << std::endl;
@@ -934,7 +1035,8 @@ void BIOSConfig::constructPendingAttribute(
         entry->attr_handle = htole16(handler);
         listOfHandles.emplace_back(htole16(handler));
 
-        (*iter)->generateAttributeEntry(attributevalue, attrValueEntry);
+        biosAttributes[iter->second]->generateAttributeEntry(attributevalue,
+                                                             attrValueEntry);
 
         setAttrValue(attrValueEntry.data(), attrValueEntry.size());
     }
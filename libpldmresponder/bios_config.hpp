@@ -9,12 +9,14 @@
 
 #include <nlohmann/json.hpp>
 
+#include <array>
 #include <functional>
 #include <iostream>
 #include <memory>
 #include <optional>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace pldm
@@ -105,6 +107,20 @@ class BIOSConfig
      */
     std::optional<Table> getBIOSTable(pldm_bios_table_types tableType);
 
+    /** @brief Check if the BIOS table of specified type is available
+     *  @param[in] tableType - The table type
+     *  @return true if the table is available
+     */
+    bool isTableAvailable(pldm_bios_table_types tableType) const;
+
+    /** @brief Find an entry of the attribute value table by attribute handle
+     *  @param[in] attrHandle - The attribute handle
+     *  @return Pointer to the entry in the cached table, nullptr if not found.
+     *          It's valid until the attribute value table is updated.
+     */
+    const pldm_bios_attr_val_table_entry*
+        findAttrValueEntry(uint16_t attrHandle) const;
+
     /** @brief set BIOS table
      *  @param[in] tableType - Indicates what table is being transferred
      *             {BIOSStringTable=0x0, BIOSAttributeTable=0x1,
@@ -132,11 +148,53 @@ class BIOSConfig
         options,
     };
 
+    /** @class CachedStringTable
+     *  @brief BIOS string table operations on the cached string table, a
+     *         lookup uses the indexes instead of scanning the table
+     */
+    class CachedStringTable : public BIOSStringTableInterface
+    {
+      public:
+        explicit CachedStringTable(const BIOSConfig& config) : config(config)
+        {}
+
+        std::string findString(uint16_t handle) const override;
+        uint16_t findHandle(const std::string& name) const override;
+
+      private:
+        const BIOSConfig& config;
+    };
+
+    using TableIndex = std::unordered_map<uint16_t, size_t>;
+
     const fs::path jsonDir;
     const fs::path tableDir;
     pldm::utils::DBusHandler* const dbusHandler;
     BaseBIOSTable baseBIOSTableMaps;
 
+    /** @brief The string, attribute and attribute value tables in ram, indexed
+     *         by pldm_bios_table_types. The tables are loaded from tableDir
+     *         once and every update is written through to tableDir.
+     */
+    std::array<std::optional<Table>, PLDM_BIOS_ATTR_VAL_TABLE + 1> tables;
+
+    /** @brief Offsets of the string table entries by string handle */
+    TableIndex stringOffsets;
+
+    /** @brief String handles by string */
+    std::unordered_map<std::string, uint16_t> stringHandles;
+
+    /** @brief Offsets of the attribute table entries by attribute handle */
+    TableIndex attrOffsets;
+
+    /** @brief Attribute handles by attribute name */
+    std::unordered_map<AttributeName, uint16_t> attrHandles;
+
+    /** @brief Offsets of the attribute value table entries by attribute
+     *         handle
+     */
+    TableIndex attrValueOffsets;
+
     /** @brief socket descriptor to communicate to host */
     int fd;
 
@@ -155,6 +213,9 @@ class BIOSConfig
     using BIOSAttributes = std::vector<std::unique_ptr<BIOSAttribute>>;
     BIOSAttributes biosAttributes;
 
+    /** @brief Indices into biosAttributes by attribute name */
+    std::unordered_map<AttributeName, size_t> biosAttrIndices;
+
     using propName = std::string;
     using DbusChObjProperties = std::map<propName, pldm::utils::PropertyValue>;
 
@@ -182,6 +243,8 @@ class BIOSConfig
         {
             biosAttributes.push_back(std::make_unique<T>(entry, dbusHandler));
             auto biosAttrIndex = biosAttributes.size() - 1;
+            biosAttrIndices.emplace(biosAttributes[biosAttrIndex]->name,
+                                    biosAttrIndex);
             auto dBusMap = biosAttributes[biosAttrIndex]->getDBusMap();
 
             if (dBusMap.has_value())
@@ -239,6 +302,42 @@ class BIOSConfig
      */
     void storeTable(const fs::path& path, const Table& table);
 
+    /** @brief Load the persistent tables to ram and index them */
+    void loadTables();
+
+    /** @brief Replace the cached table, index it and persist it
+     *  @param[in] tableType - The table type
+     *  @param[in] table - The table
+     */
+    void cacheTable(pldm_bios_table_types tableType, Table&& table);
+
+    /** @brief Rebuild the indexes of the cached table
+     *  @param[in] tableType - The table type
+     */
+    void indexTable(pldm_bios_table_types tableType);
+
+    /** @brief Find an entry of the string table by string handle
+     *  @param[in] handle - The string handle
+     *  @return Pointer to the entry in the cached table, nullptr if not found
+     */
+    const pldm_bios_string_table_entry* findStringEntry(uint16_t handle) const;
+
+    /** @brief Find an entry of the attribute table by attribute handle
+     *  @param[in] attrHandle - The attribute handle
+     *  @return Pointer to the entry in the cached table, nullptr if not found
+     */
+    const pldm_bios_attr_table_entry* findAttrEntry(uint16_t attrHandle) const;
+
+    /** @brief Decode an attribute value entry to a BaseBIOSTable item
+     *  @param[in] attrValueEntry - The attribute value entry
+     *  @param[out] attributeName - The attribute name
+     *  @param[out] biosTableObj - The BaseBIOSTable item of the attribute
+     *  @return pldm_completion_codes
+     */
+    int decodeAttrValueEntry(
+        const pldm_bios_attr_val_table_entry* attrValueEntry,
+        AttributeName& attributeName, BIOSTableObj& biosTableObj) const;
+
     /** @brief Load bios table to ram
      *  @param[in] path - Path of the table
      *  @return The table, std::nullopt if loading fails
@@ -248,12 +347,11 @@ class BIOSConfig
     /** @brief Check the attribute value to update
      *  @param[in] attrValueEntry - The attribute value entry to update
      *  @param[in] attrEntry - The attribute table entry
-     *  @param[in] stringTable - The string  table
      *  @return pldm_completion_codes
      */
     int checkAttrValueToUpdate(
         const pldm_bios_attr_val_table_entry* attrValueEntry,
-        const pldm_bios_attr_table_entry* attrEntry, Table& stringTable);
+        const pldm_bios_attr_table_entry* attrEntry);
 
     /** @brief Check the attribute table
      *  @param[in] table - The table
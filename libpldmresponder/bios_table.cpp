@@ -333,6 +333,21 @@ std::optional<Table> updateTable(const Table& table, const void* entry,
     return destTable;
 }
 
+bool updateTableInPlace(Table& table, size_t offset, const void* entry,
+                        size_t size)
+{
+    // leave room for the entry to grow and the pad (4-byte alignment, max = 3)
+    auto length = table.size();
+    table.resize(length + size + 3);
+
+    auto rc = pldm_bios_table_attr_value_entry_update_in_place(
+        table.data(), &length, table.size(), table.data() + offset, entry,
+        size);
+    table.resize(length);
+
+    return rc == PLDM_SUCCESS;
+}
+
 } // namespace attribute_value
 
 } // namespace table
@@ -370,6 +370,17 @@ const pldm_bios_attr_val_table_entry*
 std::optional<Table> updateTable(const Table& table, const void* entry,
                                  size_t size);
 
+/** @brief update an entry of the table in place, only the following entries
+ *         are moved if the entry length changes
+ *  @param[in,out] table - the table need to be updated
+ *  @param[in] offset - offset of the entry to update in the table
+ *  @param[in] entry - the new attribute value entry
+ *  @param[in] size - size of the new entry
+ *  @return true if updated, false if failed and the table is not changed
+ */
+bool updateTableInPlace(Table& table, size_t offset, const void* entry,
+                        size_t size);
+
 } // namespace attribute_value
 
 } // namespace table
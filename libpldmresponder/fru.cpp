@@ -10,6 +10,8 @@
 
 #include <sdbusplus/bus.hpp>
 
+#include <algorithm>
+#include <array>
 #include <iostream>
 #include <set>
 
@@ -29,11 +31,11 @@ void FruImpl::buildFRUTable()
 
     fru_parser::DBusLookupInfo dbusInfo;
     // Read the all the inventory D-Bus objects
-    auto& bus = pldm::utils::DBusHandler::getBus();
     dbus::ObjectValueTree objects;
 
     try
     {
+        auto& bus = pldm::utils::DBusHandler::getBus();
         dbusInfo = parser.inventoryLookup();
         auto method = bus.new_method_call(
             std::get<0>(dbusInfo).c_str(), std::get<1>(dbusInfo).c_str(),
@@ -48,90 +50,258 @@ void FruImpl::buildFRUTable()
         return;
     }
 
-    auto itemIntfsLookup = std::get<2>(dbusInfo);
+    // Parents are always added first before children in the entity
+    // association tree. We're relying on the fact that the std::map
+    // containing object paths from the GetManagedObjects call will have a
+    // sorted pathname list.
+    for (const auto& [path, interfaces] : objects)
+    {
+        updateObject(path.str, interfaces);
+    }
+
+    pldm_entity_association_pdr_add(entityTree, pdrRepo, false);
+    // save a copy of bmc's entity association tree
+    pldm_entity_association_tree_copy_root(entityTree, bmcEntityTree);
+
+    isBuilt = true;
+    watchInventory();
+}
+
+void FruImpl::watchInventory()
+{
+    namespace rules = sdbusplus::bus::match::rules;
+    const auto& dbusInfo = parser.inventoryLookup();
+    const auto& service = std::get<0>(dbusInfo);
+    const auto& rootPath = std::get<1>(dbusInfo);
 
-    for (const auto& object : objects)
+    try
     {
-        const auto& interfaces = object.second;
+        auto& bus = pldm::utils::DBusHandler::getBus();
+        inventoryMatches.emplace_back(
+            bus, rules::interfacesAdded(rootPath) + rules::sender(service),
+            [this](sdbusplus::message::message& msg) {
+            sdbusplus::message::object_path path;
+            dbus::InterfaceMap interfaces;
+            try
+            {
+                msg.read(path, interfaces);
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << "Failed to read InterfacesAdded of inventory, "
+                             "ERROR="
+                          << e.what() << "\n";
+                return;
+            }
+            updateObject(path.str, interfaces);
+        });
+
+        inventoryMatches.emplace_back(
+            bus, rules::interfacesRemoved(rootPath) + rules::sender(service),
+            [this](sdbusplus::message::message& msg) {
+            sdbusplus::message::object_path path;
+            std::vector<dbus::Interface> interfaces;
+            try
+            {
+                msg.read(path, interfaces);
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << "Failed to read InterfacesRemoved of inventory, "
+                             "ERROR="
+                          << e.what() << "\n";
+                return;
+            }
+            removeInterfaces(path.str, interfaces);
+        });
+
+        inventoryMatches.emplace_back(
+            bus,
+            rules::type::signal() + rules::member("PropertiesChanged") +
+                rules::interface(pldm::utils::dbusProperties) +
+                rules::path_namespace(rootPath) + rules::sender(service),
+            [this](sdbusplus::message::message& msg) {
+            dbus::Interface interface;
+            dbus::PropertyMap properties;
+            try
+            {
+                msg.read(interface, properties);
+            }
+            catch (const std::exception&)
+            {
+                // not a property of the FRU records
+                return;
+            }
+            updateProperties(msg.get_path(), interface, properties);
+        });
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Failed to watch the inventory, the PLDM FRU table "
+                     "won't be updated, ERROR="
+                  << e.what() << "\n";
+    }
+}
 
-        for (const auto& interface : interfaces)
+void FruImpl::updateObject(const dbus::ObjectPath& path,
+                           const dbus::InterfaceMap& interfaces)
+{
+    RecordSet* recordSet = nullptr;
+    auto iter = recordSets.find(path);
+    if (iter == recordSets.end())
+    {
+        recordSet = addRecordSet(path, interfaces);
+        if (!recordSet)
+        {
+            return;
+        }
+    }
+    else
+    {
+        recordSet = &iter->second;
+        for (const auto& [intf, properties] : interfaces)
         {
-            if (itemIntfsLookup.find(interface.first) != itemIntfsLookup.end())
+            auto& cached = recordSet->interfaces[intf];
+            for (const auto& [property, value] : properties)
             {
-                // An exception will be thrown by getRecordInfo, if the item
-                // D-Bus interface name specified in FRU_Master.json does
-                // not have corresponding config jsons
-                try
-                {
-                    pldm_entity entity{};
-                    entity.entity_type = parser.getEntityType(interface.first);
-                    pldm_entity_node* parent = nullptr;
-                    auto parentObj = pldm::utils::findParent(object.first.str);
-                    // To add a FRU to the entity association tree, we need to
-                    // determine if the FRU has a parent (D-Bus object). For eg
-                    // /system/backplane's parent is /system. /system has no
-                    // parent. Some D-Bus pathnames might just be namespaces
-                    // (not D-Bus objects), so we need to iterate upwards until
-                    // a parent is found, or we reach the root ("/").
-                    // Parents are always added first before children in the
-                    // entity association tree. We're relying on the fact that
-                    // the std::map containing object paths from the
-                    // GetManagedObjects call will have a sorted pathname list.
-                    do
-                    {
-                        auto iter = objToEntityNode.find(parentObj);
-                        if (iter != objToEntityNode.end())
-                        {
-                            parent = iter->second;
-                            break;
-                        }
-                        parentObj = pldm::utils::findParent(parentObj);
-                    } while (parentObj != "/");
-
-                    auto node = pldm_entity_association_tree_add(
-                        entityTree, &entity, 0xFFFF, parent,
-                        PLDM_ENTITY_ASSOCIAION_PHYSICAL);
-                    objToEntityNode[object.first.str] = node;
-
-                    auto recordInfos = parser.getRecordInfo(interface.first);
-                    populateRecords(interfaces, recordInfos, entity);
-
-                    associatedEntityMap.emplace(object.first, entity);
-                    break;
-                }
-                catch (const std::exception& e)
-                {
-                    std::cout << "Config JSONs missing for the item "
-                                 "interface type, interface = "
-                              << interface.first << "\n";
-                    break;
-                }
+                cached.insert_or_assign(property, value);
             }
         }
     }
 
-    pldm_entity_association_pdr_add(entityTree, pdrRepo, false);
-    // save a copy of bmc's entity association tree
-    pldm_entity_association_tree_copy_root(entityTree, bmcEntityTree);
+    uint16_t numRecords = 0;
+    auto records = populateRecords(*recordSet, numRecords);
+    patchTable(*recordSet, records, numRecords);
+}
 
-    if (table.size())
+void FruImpl::updateProperties(const dbus::ObjectPath& path,
+                               const dbus::Interface& interface,
+                               const dbus::PropertyMap& properties)
+{
+    if (recordSets.find(path) == recordSets.end())
     {
-        padBytes = utils::getNumPadBytes(table.size());
-        table.resize(table.size() + padBytes, 0);
+        return;
+    }
+    updateObject(path, {{interface, properties}});
+}
 
-        // Calculate the checksum
-        checksum = crc32(table.data(), table.size());
+void FruImpl::removeInterfaces(const dbus::ObjectPath& path,
+                               const std::vector<dbus::Interface>& interfaces)
+{
+    auto iter = recordSets.find(path);
+    if (iter == recordSets.end())
+    {
+        return;
     }
-    isBuilt = true;
+
+    auto& recordSet = iter->second;
+    if (std::find(interfaces.begin(), interfaces.end(),
+                  recordSet.itemInterface) != interfaces.end())
+    {
+        // The entity stays in the entity association tree, it is used again
+        // if the FRU comes back
+        patchTable(recordSet, {}, 0);
+        if (recordSet.recordSetIdentifier)
+        {
+            pldm_pdr_remove_record(pdrRepo, recordSet.pdrRecordHandle);
+            rsiIndex.erase(recordSet.recordSetIdentifier);
+        }
+        associatedEntityMap.erase(path);
+        recordSets.erase(iter);
+        return;
+    }
+
+    for (const auto& intf : interfaces)
+    {
+        recordSet.interfaces.erase(intf);
+    }
+    uint16_t numRecords = 0;
+    auto records = populateRecords(recordSet, numRecords);
+    patchTable(recordSet, records, numRecords);
 }
+
+FruImpl::RecordSet* FruImpl::addRecordSet(const dbus::ObjectPath& path,
+                                          const dbus::InterfaceMap& interfaces)
+{
+    const auto& itemIntfsLookup = std::get<2>(parser.inventoryLookup());
+
+    for (const auto& interface : interfaces)
+    {
+        if (itemIntfsLookup.find(interface.first) == itemIntfsLookup.end())
+        {
+            continue;
+        }
+
+        // An exception will be thrown by getRecordInfo, if the item D-Bus
+        // interface name specified in FRU_Master.json does not have
+        // corresponding config jsons
+        try
+        {
+            pldm_entity entity{};
+            auto nodeIter = objToEntityNode.find(path);
+            if (nodeIter != objToEntityNode.end())
+            {
+                // the FRU was removed and has come back
+                entity = pldm_entity_extract(nodeIter->second);
+            }
+            else
+            {
+                entity.entity_type = parser.getEntityType(interface.first);
+                pldm_entity_node* parent = nullptr;
+                auto parentObj = pldm::utils::findParent(path);
+                // To add a FRU to the entity association tree, we need to
+                // determine if the FRU has a parent (D-Bus object). For eg
+                // /system/backplane's parent is /system. /system has no
+                // parent. Some D-Bus pathnames might just be namespaces
+                // (not D-Bus objects), so we need to iterate upwards until
+                // a parent is found, or we reach the root ("/").
+                do
+                {
+                    auto iter = objToEntityNode.find(parentObj);
+                    if (iter != objToEntityNode.end())
+                    {
+                        parent = iter->second;
+                        break;
+                    }
+                    parentObj = pldm::utils::findParent(parentObj);
+                } while (parentObj != "/");
+
+                auto node = pldm_entity_association_tree_add(
+                    entityTree, &entity, 0xFFFF, parent,
+                    PLDM_ENTITY_ASSOCIAION_PHYSICAL);
+                objToEntityNode[path] = node;
+            }
+
+            const auto& recordInfos = parser.getRecordInfo(interface.first);
+            associatedEntityMap.emplace(path, entity);
+
+            auto& recordSet = recordSets[path];
+            recordSet.itemInterface = interface.first;
+            recordSet.recordInfos = &recordInfos;
+            recordSet.entity = entity;
+            recordSet.interfaces = interfaces;
+            return &recordSet;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "Config JSONs missing for the item "
+                         "interface type, interface = "
+                      << interface.first << "\n";
+            return nullptr;
+        }
+    }
+
+    return nullptr;
+}
+
 std::string FruImpl::populatefwVersion()
 {
     static constexpr auto fwFunctionalObjPath =
         "/xyz/openbmc_project/software/functional";
-    auto& bus = pldm::utils::DBusHandler::getBus();
     std::string currentBmcVersion;
     try
     {
+        auto& bus = pldm::utils::DBusHandler::getBus();
         auto method =
             bus.new_method_call(pldm::utils::mapperService, fwFunctionalObjPath,
                                 pldm::utils::dbusProperties, "Get");
@@ -154,17 +324,15 @@ std::string FruImpl::populatefwVersion()
     }
     return currentBmcVersion;
 }
-void FruImpl::populateRecords(
-    const pldm::responder::dbus::InterfaceMap& interfaces,
-    const fru_parser::FruRecordInfos& recordInfos, const pldm_entity& entity)
+std::vector<uint8_t> FruImpl::populateRecords(RecordSet& recordSet,
+                                              uint16_t& numRecords)
 {
-    // recordSetIdentifier for the FRU will be set when the first record gets
-    // added for the FRU
-    uint16_t recordSetIdentifier = 0;
-    auto numRecsCount = numRecs;
-    static uint32_t bmc_record_handle = 0;
+    const auto& entity = recordSet.entity;
+    const auto& interfaces = recordSet.interfaces;
+    std::vector<uint8_t> records;
+    numRecords = 0;
 
-    for (auto const& [recType, encType, fieldInfos] : recordInfos)
+    for (auto const& [recType, encType, fieldInfos] : *recordSet.recordInfos)
     {
         std::vector<uint8_t> tlvs;
         uint8_t numFRUFields = 0;
@@ -222,34 +390,98 @@ void FruImpl::populateRecords(
 
         if (tlvs.size())
         {
-            if (numRecs == numRecsCount)
+            // recordSetIdentifier for the FRU is set when the first record
+            // gets added for the FRU
+            if (!recordSet.recordSetIdentifier)
             {
-                recordSetIdentifier = nextRSI();
-                bmc_record_handle = nextRecordHandle();
-                pldm_pdr_add_fru_record_set(
-                    pdrRepo, TERMINUS_HANDLE, recordSetIdentifier,
+                recordSet.recordSetIdentifier = nextRSI();
+                recordSet.pdrRecordHandle = pldm_pdr_add_fru_record_set(
+                    pdrRepo, TERMINUS_HANDLE, recordSet.recordSetIdentifier,
                     entity.entity_type, entity.entity_instance_num,
-                    entity.entity_container_id, bmc_record_handle);
+                    entity.entity_container_id, nextRecordHandle());
+                rsiIndex.emplace(recordSet.recordSetIdentifier, &recordSet);
             }
-            auto curSize = table.size();
-            table.resize(curSize + recHeaderSize + tlvs.size());
-            encode_fru_record(table.data(), table.size(), &curSize,
-                              recordSetIdentifier, recType, numFRUFields,
-                              encType, tlvs.data(), tlvs.size());
-            numRecs++;
+            auto curSize = records.size();
+            records.resize(curSize + recHeaderSize + tlvs.size());
+            encode_fru_record(records.data(), records.size(), &curSize,
+                              recordSet.recordSetIdentifier, recType,
+                              numFRUFields, encType, tlvs.data(), tlvs.size());
+            numRecords++;
         }
     }
+
+    return records;
+}
+
+void FruImpl::patchTable(RecordSet& recordSet,
+                         const std::vector<uint8_t>& records,
+                         uint16_t numRecords)
+{
+    numRecs = numRecs - recordSet.numRecords + numRecords;
+    recordSet.numRecords = numRecords;
+
+    auto offset = recordSet.offset;
+    if (records.size() == recordSet.length)
+    {
+        if (records.empty() ||
+            std::equal(records.begin(), records.end(), table.begin() + offset))
+        {
+            return;
+        }
+
+        // Same size, only the checksum of the changed bytes is updated
+        checksum = crc32_patch(checksum, table.data() + offset, records.data(),
+                               records.size(),
+                               table.size() - offset - records.size() +
+                                   padBytes);
+        std::copy(records.begin(), records.end(), table.begin() + offset);
+        return;
+    }
+
+    if (!recordSet.length)
+    {
+        // the record set takes room in the table from now on, at the end
+        numRecordSets++;
+        offset = table.size();
+        recordSet.offset = offset;
+    }
+    else if (records.empty())
+    {
+        numRecordSets--;
+    }
+
+    table.erase(table.begin() + offset,
+                table.begin() + offset + recordSet.length);
+    table.insert(table.begin() + offset, records.begin(), records.end());
+    for (auto& [path, other] : recordSets)
+    {
+        if (other.length && other.offset > offset)
+        {
+            other.offset = other.offset + records.size() - recordSet.length;
+        }
+    }
+    recordSet.length = records.size();
+
+    padBytes = 0;
+    checksum = 0;
+    if (table.size())
+    {
+        static constexpr std::array<uint8_t, 3> pad{};
+        padBytes = utils::getNumPadBytes(table.size());
+        checksum = crc32_update(crc32(table.data(), table.size()), pad.data(),
+                                padBytes);
+    }
 }
 
 void FruImpl::getFRUTable(Response& response)
 {
     auto hdrSize = response.size();
 
-    response.resize(hdrSize + table.size() + sizeof(checksum), 0);
+    response.resize(hdrSize + table.size() + padBytes + sizeof(checksum), 0);
     std::copy(table.begin(), table.end(), response.begin() + hdrSize);
 
     // Copy the checksum to response data
-    auto iter = response.begin() + hdrSize + table.size();
+    auto iter = response.begin() + hdrSize + table.size() + padBytes;
     std::copy_n(reinterpret_cast<const uint8_t*>(&checksum), sizeof(checksum),
                 iter);
 }
@@ -262,17 +494,31 @@ int FruImpl::getFRURecordByOption(std::vector<uint8_t>& fruData,
     // FRU table is built lazily, build if not done.
     buildFRUTable();
 
+    const uint8_t* records = table.data();
+    size_t recordsSize = table.size();
+    if (recordSetIdentifer)
+    {
+        // only the records of the record set are looked into
+        auto iter = rsiIndex.find(recordSetIdentifer);
+        if (iter == rsiIndex.end() || !iter->second->length)
+        {
+            return PLDM_FRU_DATA_STRUCTURE_TABLE_UNAVAILABLE;
+        }
+        records += iter->second->offset;
+        recordsSize = iter->second->length;
+    }
+
     /* 7 is sizeof(checksum,4) + padBytesMax(3)
      * We can not know size of the record table got by options in advance, but
-     * it must be less than the source table. So it's safe to use sizeof the
-     * source table + 7 as the buffer length
+     * it must be less than the source records. So it's safe to use sizeof the
+     * source records + 7 as the buffer length
      */
-    size_t recordTableSize = table.size() - padBytes + 7;
+    size_t recordTableSize = recordsSize + 7;
     fruData.resize(recordTableSize, 0);
 
-    get_fru_record_by_option(table.data(), table.size() - padBytes,
-                             fruData.data(), &recordTableSize,
-                             recordSetIdentifer, recordType, fieldType);
+    get_fru_record_by_option(records, recordsSize, fruData.data(),
+                             &recordTableSize, recordSetIdentifer, recordType,
+                             fieldType);
 
     if (recordTableSize == 0)
     {
@@ -8,6 +8,7 @@
 #include "fru_parser.hpp"
 #include "pldmd/handler.hpp"
 
+#include <sdbusplus/bus/match.hpp>
 #include <sdbusplus/message.hpp>
 
 #include <map>
@@ -38,6 +39,11 @@ using AssociatedEntityMap = std::map<ObjectPath, pldm_entity>;
 /** @class FruImpl
  *
  *  @brief Builds the PLDM FRU table containing the FRU records
+ *
+ *  The table is built from the D-Bus inventory on the first request and then
+ *  kept up to date by the inventory InterfacesAdded/InterfacesRemoved and
+ *  PropertiesChanged signals, only the record set of the changed FRU is
+ *  encoded again and patched into the table.
  */
 class FruImpl
 {
@@ -77,7 +83,7 @@ class FruImpl
      */
     uint32_t size() const
     {
-        return table.size() - padBytes;
+        return table.size();
     }
 
     /** @brief The checksum of the contents of the FRU table
@@ -95,7 +101,7 @@ class FruImpl
      */
     uint16_t numRSI() const
     {
-        return rsi;
+        return numRecordSets;
     }
 
     /** @brief The number of FRU records in the table
@@ -127,10 +133,41 @@ class FruImpl
 
     /** @brief FRU table is built by processing the D-Bus inventory namespace
      *         based on the config files for FRU. The table is populated based
-     *         on the isBuilt flag.
+     *         on the isBuilt flag, afterwards it is updated by the inventory
+     *         signals.
      */
     void buildFRUTable();
 
+    /** @brief Add or update the interfaces of an inventory object, a FRU is
+     *         added when an item interface of the FRU config is added.
+     *
+     *  @param[in] path - inventory object path
+     *  @param[in] interfaces - the added interfaces or the changed properties
+     */
+    void updateObject(const dbus::ObjectPath& path,
+                      const dbus::InterfaceMap& interfaces);
+
+    /** @brief Update the changed properties of an inventory object. Only
+     *         the objects with a record set are updated, a new object is
+     *         added by InterfacesAdded with all its properties.
+     *
+     *  @param[in] path - inventory object path
+     *  @param[in] interface - interface of the changed properties
+     *  @param[in] properties - the changed properties
+     */
+    void updateProperties(const dbus::ObjectPath& path,
+                          const dbus::Interface& interface,
+                          const dbus::PropertyMap& properties);
+
+    /** @brief Remove interfaces of an inventory object, the FRU records are
+     *         removed along with the item interface.
+     *
+     *  @param[in] path - inventory object path
+     *  @param[in] interfaces - the removed interfaces
+     */
+    void removeInterfaces(const dbus::ObjectPath& path,
+                          const std::vector<dbus::Interface>& interfaces);
+
     /** @brief Get std::map associated with the entity
      *         key: object path
      *         value: pldm_entity
@@ -150,6 +187,24 @@ class FruImpl
     std::string populatefwVersion();
 
   private:
+    /** @struct RecordSet
+     *
+     *  The FRU records of an inventory object, stored in the FRU table at
+     *  offset. Only the record sets with records take room in the table.
+     */
+    struct RecordSet
+    {
+        dbus::Interface itemInterface;
+        const fru_parser::FruRecordInfos* recordInfos;
+        pldm_entity entity;
+        dbus::InterfaceMap interfaces;
+        uint16_t recordSetIdentifier = 0;
+        uint32_t pdrRecordHandle = 0;
+        uint16_t numRecords = 0;
+        size_t offset = 0;
+        size_t length = 0;
+    };
+
     uint16_t nextRSI()
     {
         return ++rsi;
@@ -163,6 +218,7 @@ class FruImpl
     uint32_t rh = 0;
     uint16_t rsi = 0;
     uint16_t numRecs = 0;
+    uint16_t numRecordSets = 0;
     uint8_t padBytes = 0;
     std::vector<uint8_t> table;
     uint32_t checksum = 0;
@@ -175,17 +231,47 @@ class FruImpl
 
     std::map<dbus::ObjectPath, pldm_entity_node*> objToEntityNode{};
 
-    /** @brief populateRecord builds the FRU records for an instance of FRU and
-     *         updates the FRU table with the FRU records.
+    /** @brief The FRUs in the table, by inventory object path */
+    std::map<dbus::ObjectPath, RecordSet> recordSets;
+
+    /** @brief Index of the FRUs by record set identifier */
+    std::map<uint16_t, const RecordSet*> rsiIndex;
+
+    /** @brief Matches of the inventory signals */
+    std::vector<sdbusplus::bus::match_t> inventoryMatches;
+
+    /** @brief Add a FRU for the inventory object implementing an item
+     *         interface of the FRU config
+     *
+     *  @return the record set, nullptr if the object is not a FRU
+     */
+    RecordSet* addRecordSet(const dbus::ObjectPath& path,
+                            const dbus::InterfaceMap& interfaces);
+
+    /** @brief populateRecords builds the FRU records for an instance of FRU,
+     *         the record set identifier is assigned when the FRU gets its
+     *         first record.
+     *
+     *  @param[in/out] recordSet - the FRU to build the records of
+     *  @param[out] numRecords - the number of the FRU records
+     *
+     *  @return the encoded FRU records
+     */
+    std::vector<uint8_t> populateRecords(RecordSet& recordSet,
+                                         uint16_t& numRecords);
+
+    /** @brief Replace the records of a FRU in the table and update the
+     *         checksum, the other record sets are moved if the size changes.
      *
-     *  @param[in] interfaces - D-Bus interfaces and the associated property
-     *                          values for the FRU
-     *  @param[in] recordInfos - FRU record info to build the FRU records
-     *  @param[in/out] entity - PLDM entity corresponding to FRU instance
+     *  @param[in/out] recordSet - the FRU the records belong to
+     *  @param[in] records - the new records of the FRU
+     *  @param[in] numRecords - the number of the new records
      */
-    void populateRecords(const dbus::InterfaceMap& interfaces,
-                         const fru_parser::FruRecordInfos& recordInfos,
-                         const pldm_entity& entity);
+    void patchTable(RecordSet& recordSet, const std::vector<uint8_t>& records,
+                    uint16_t numRecords);
+
+    /** @brief Subscribe to the inventory signals to keep the table updated */
+    void watchInventory();
 
     /** @brief Associate sensor/effecter to FRU entity
      */
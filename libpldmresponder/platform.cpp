@@ -2,6 +2,7 @@
 
 #include "libpldm/entity.h"
 #include "libpldm/state_set.h"
+#include "libpldm/utils.h"
 
 #include "common/types.hpp"
 #include "common/utils.hpp"
@@ -40,6 +41,13 @@ void Handler::addDbusObjMaps(
 {
     if (typeId == TypeId::PLDM_SENSOR_ID)
     {
+        // the host reads the sensors much more often than they change
+        for (const auto& dbusMapping : std::get<0>(dbusObj))
+        {
+            pldm::utils::DBusHandler::cacheProperty(dbusMapping.objectPath,
+                                                    dbusMapping.interface,
+                                                    dbusMapping.propertyName);
+        }
         sensorDbusObjMaps.emplace(id, dbusObj);
     }
     else
@@ -205,8 +213,21 @@ Response Handler::getPDR(const pldm_msg* request, size_t payloadLength)
         return CmdHandler::ccOnlyResponse(request, rc);
     }
 
-    uint16_t respSizeBytes{};
-    uint8_t* recordData = nullptr;
+    if (transferOpFlag != PLDM_GET_FIRSTPART &&
+        transferOpFlag != PLDM_GET_NEXTPART)
+    {
+        return CmdHandler::ccOnlyResponse(
+            request, PLDM_PLATFORM_INVALID_TRANSFER_OPERATION_FLAG);
+    }
+
+    // The data transfer handle is the offset of the part in the record, a
+    // part at offset 0 starts the record whatever the operation flag.
+    if (transferOpFlag == PLDM_GET_FIRSTPART && dataTransferHandle != 0)
+    {
+        return CmdHandler::ccOnlyResponse(
+            request, PLDM_PLATFORM_INVALID_DATA_TRANSFER_HANDLE);
+    }
+
     try
     {
         pdr_utils::PdrEntry e;
@@ -217,22 +238,59 @@ Response Handler::getPDR(const pldm_msg* request, size_t payloadLength)
                 request, PLDM_PLATFORM_INVALID_RECORD_HANDLE);
         }
 
-        if (reqSizeBytes)
+        uint32_t offset = dataTransferHandle;
+        if (offset != 0)
         {
-            respSizeBytes = e.size;
-            if (respSizeBytes > reqSizeBytes)
+            if (offset >= e.size)
+            {
+                return CmdHandler::ccOnlyResponse(
+                    request, PLDM_PLATFORM_INVALID_DATA_TRANSFER_HANDLE);
+            }
+
+            // The record must not have changed since the first part
+            auto hdr = reinterpret_cast<const pldm_pdr_hdr*>(e.data);
+            if (recordChangeNum != le16toh(hdr->record_change_num))
             {
-                respSizeBytes = reqSizeBytes;
+                return CmdHandler::ccOnlyResponse(
+                    request, PLDM_PLATFORM_INVALID_RECORD_CHANGE_NUMBER);
             }
-            recordData = e.data;
+
+            // A zero sized part would end the record without its data
+            if (reqSizeBytes == 0)
+            {
+                return CmdHandler::ccOnlyResponse(request,
+                                                  PLDM_ERROR_INVALID_DATA);
+            }
+        }
+
+        uint16_t respSizeBytes = static_cast<uint16_t>(
+            std::min<uint32_t>(e.size - offset, reqSizeBytes));
+        uint8_t* recordData = respSizeBytes ? e.data + offset : nullptr;
+        uint32_t nextDataTransferHandle = 0;
+        uint8_t transferFlag = PLDM_START_AND_END;
+        uint8_t transferCRC = 0;
+        if (respSizeBytes && offset + respSizeBytes < e.size)
+        {
+            nextDataTransferHandle = offset + respSizeBytes;
+            transferFlag = offset == 0 ? PLDM_START : PLDM_MIDDLE;
         }
+        else if (offset != 0)
+        {
+            transferFlag = PLDM_END;
+            transferCRC = crc8(e.data, e.size);
+        }
+
         response.resize(sizeof(pldm_msg_hdr) + PLDM_GET_PDR_MIN_RESP_BYTES +
-                            respSizeBytes,
+                            respSizeBytes +
+                            (transferFlag == PLDM_END ? sizeof(transferCRC)
+                                                      : 0),
                         0);
         auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
-        rc = encode_get_pdr_resp(
-            request->hdr.instance_id, PLDM_SUCCESS, e.handle.nextRecordHandle,
-            0, PLDM_START_AND_END, respSizeBytes, recordData, 0, responsePtr);
+        rc = encode_get_pdr_resp(request->hdr.instance_id, PLDM_SUCCESS,
+                                 e.handle.nextRecordHandle,
+                                 nextDataTransferHandle, transferFlag,
+                                 respSizeBytes, recordData, transferCRC,
+                                 responsePtr);
         if (rc != PLDM_SUCCESS)
         {
             return ccOnlyResponse(request, rc);
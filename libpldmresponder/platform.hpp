@@ -194,6 +194,10 @@ class Handler : public CmdHandler
     EventMap eventHandlers;
 
     /** @brief Handler for GetPDR
+     *
+     *  Records larger than the request count are sent in parts, the data
+     *  transfer handle being the offset of the next part in the record. The
+     *  last part carries the CRC-8 of the whole record.
      *
      *  @param[in] request - Request message payload
      *  @param[in] payloadLength - Request payload length
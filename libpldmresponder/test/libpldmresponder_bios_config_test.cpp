@@ -318,3 +318,70 @@ TEST_F(TestBIOSConfig, setAttrValue)
     EXPECT_THAT(std::vector<uint8_t>(p, p + attrValueEntry.size()),
                 ElementsAreArray(attrValueEntry));
 }
+
+TEST_F(TestBIOSConfig, cachedTables)
+{
+    MockdBusHandler dbusHandler;
+
+    BIOSConfig biosConfig("./bios_jsons", tableDir.c_str(), &dbusHandler, 0, 0,
+                          nullptr, nullptr);
+    biosConfig.removeTables();
+    EXPECT_FALSE(biosConfig.isTableAvailable(PLDM_BIOS_ATTR_VAL_TABLE));
+    EXPECT_EQ(biosConfig.findAttrValueEntry(0), nullptr);
+
+    biosConfig.buildTables();
+    ASSERT_TRUE(biosConfig.isTableAvailable(PLDM_BIOS_ATTR_VAL_TABLE));
+
+    // every entry of the attribute value table is found by its handle
+    auto expectEntriesIndexed = [&biosConfig]() {
+        auto attrValueTable = biosConfig.getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE);
+        ASSERT_TRUE(attrValueTable);
+        for (auto entry : BIOSTableIter<PLDM_BIOS_ATTR_VAL_TABLE>(
+                 attrValueTable->data(), attrValueTable->size()))
+        {
+            auto header = table::attribute_value::decodeHeader(entry);
+            auto cached = biosConfig.findAttrValueEntry(header.attrHandle);
+            ASSERT_NE(cached, nullptr);
+
+            auto length = pldm_bios_table_attr_value_entry_length(entry);
+            auto p = reinterpret_cast<const uint8_t*>(entry);
+            auto q = reinterpret_cast<const uint8_t*>(cached);
+            EXPECT_THAT(std::vector<uint8_t>(q, q + length),
+                        ElementsAreArray(p, length));
+        }
+    };
+    expectEntriesIndexed();
+
+    auto stringTable = biosConfig.getBIOSTable(PLDM_BIOS_STRING_TABLE);
+    auto attrTable = biosConfig.getBIOSTable(PLDM_BIOS_ATTR_TABLE);
+    BIOSStringTable biosStringTable(*stringTable);
+    auto attrEntry = table::attribute::findByStringHandle(
+        *attrTable, biosStringTable.findHandle("str_example1"));
+    ASSERT_NE(attrEntry, nullptr);
+    auto attrHandle = table::attribute::decodeHeader(attrEntry).attrHandle;
+
+    // a longer string moves the entries after it
+    std::vector<uint8_t> attrValueEntry{
+        0,   0,                                  /* attr handle */
+        1,                                       /* attr type string */
+        8,   0,                                  /* current string length */
+        'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', /* current string */
+    };
+    attrValueEntry[0] = attrHandle & 0xff;
+    attrValueEntry[1] = (attrHandle >> 8) & 0xff;
+
+    auto rc = biosConfig.setAttrValue(attrValueEntry.data(),
+                                      attrValueEntry.size(), false, false);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    expectEntriesIndexed();
+
+    auto entry = biosConfig.findAttrValueEntry(attrHandle);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(table::attribute_value::decodeStringEntry(entry), "abcdefgh");
+
+    // the update is written through to the persistent table
+    BIOSConfig reloaded("./bios_jsons", tableDir.c_str(), &dbusHandler, 0, 0,
+                        nullptr, nullptr);
+    EXPECT_EQ(reloaded.getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE),
+              biosConfig.getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE));
+}
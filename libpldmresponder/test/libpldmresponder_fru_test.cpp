@@ -1,6 +1,14 @@
+#include "libpldm/pdr.h"
+#include "libpldm/utils.h"
+
+#include "libpldmresponder/fru.hpp"
 #include "libpldmresponder/fru_parser.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 #include <gtest/gtest.h>
+
 TEST(FruParser, allScenarios)
 {
     using namespace pldm::responder::fru_parser;
@@ -69,3 +77,152 @@ TEST(FruParser, allScenarios)
         parser.getRecordInfo("xyz.openbmc_project.Inventory.Item.DIMM"),
         std::exception);
 }
+
+class FruImplTest : public testing::Test
+{
+  protected:
+    FruImplTest() :
+        pdrRepo(pldm_pdr_init()),
+        entityTree(pldm_entity_association_tree_init()),
+        bmcEntityTree(pldm_entity_association_tree_init()),
+        impl("./fru_jsons/good", "./fru_jsons/fru_master/fru_master.json",
+             pdrRepo, entityTree, bmcEntityTree)
+    {}
+
+    ~FruImplTest()
+    {
+        pldm_entity_association_tree_destroy(bmcEntityTree);
+        pldm_entity_association_tree_destroy(entityTree);
+        pldm_pdr_destroy(pdrRepo);
+    }
+
+    /** @brief Check the cached checksum against the whole table */
+    void checkTable()
+    {
+        pldm::responder::Response table;
+        impl.getFRUTable(table);
+        ASSERT_EQ(table.size() % 4, 0);
+        ASSERT_GE(table.size(), sizeof(uint32_t));
+        auto checksumOffset = table.size() - sizeof(uint32_t);
+        EXPECT_GE(checksumOffset, impl.size());
+        EXPECT_LT(checksumOffset - impl.size(), 4);
+        if (impl.size())
+        {
+            EXPECT_EQ(crc32(table.data(), checksumOffset), impl.checkSum());
+        }
+        else
+        {
+            EXPECT_EQ(0, impl.checkSum());
+        }
+        uint32_t checksum{};
+        std::memcpy(&checksum, table.data() + checksumOffset,
+                    sizeof(checksum));
+        EXPECT_EQ(impl.checkSum(), checksum);
+    }
+
+    /** @brief Whether the record set contains the field value */
+    bool hasField(uint16_t recordSetIdentifier, const std::string& value)
+    {
+        pldm::responder::Response records;
+        if (impl.getFRURecordByOption(records, 0, recordSetIdentifier, 0, 0) !=
+            PLDM_SUCCESS)
+        {
+            return false;
+        }
+        return std::search(records.begin(), records.end(), value.begin(),
+                           value.end()) != records.end();
+    }
+
+    static pldm::responder::dbus::InterfaceMap
+        cpu(const std::string& partNumber, const std::string& serialNumber)
+    {
+        return {{cpuItem, {}},
+                {asset,
+                 {{"PartNumber", partNumber},
+                  {"SerialNumber", serialNumber}}}};
+    }
+
+    static constexpr auto cpuItem = "xyz.openbmc_project.Inventory.Item.Cpu";
+    static constexpr auto asset =
+        "xyz.openbmc_project.Inventory.Decorator.Asset";
+    static constexpr auto cpu0 = "/xyz/openbmc_project/inventory/cpu0";
+    static constexpr auto cpu1 = "/xyz/openbmc_project/inventory/cpu1";
+
+    pldm_pdr* pdrRepo;
+    pldm_entity_association_tree* entityTree;
+    pldm_entity_association_tree* bmcEntityTree;
+    pldm::responder::FruImpl impl;
+};
+
+TEST_F(FruImplTest, updateRecordSets)
+{
+    // objects which are not FRUs are ignored
+    impl.updateObject("/xyz/openbmc_project/inventory/fan0",
+                      {{asset, {{"PartNumber", std::string("F1")}}}});
+    EXPECT_EQ(0, impl.size());
+    checkTable();
+
+    // a property change doesn't add a FRU, even with its item interface
+    impl.updateProperties(cpu0, cpuItem, {});
+    impl.updateProperties(cpu0, asset, {{"PartNumber", std::string("P1")}});
+    EXPECT_EQ(0, impl.numRSI());
+    EXPECT_EQ(0, impl.size());
+
+    // the default and the Cpu_General records
+    impl.updateObject(cpu0, cpu("P1", "S1"));
+    EXPECT_EQ(1, impl.numRSI());
+    EXPECT_EQ(2, impl.numRecords());
+    EXPECT_EQ(1, pldm_pdr_get_record_count(pdrRepo));
+    EXPECT_TRUE(hasField(1, "S1"));
+    checkTable();
+
+    // a change of the same size patches the checksum
+    auto size = impl.size();
+    impl.updateProperties(cpu0, asset, {{"SerialNumber", std::string("S2")}});
+    EXPECT_EQ(size, impl.size());
+    EXPECT_TRUE(hasField(1, "S2"));
+    EXPECT_FALSE(hasField(1, "S1"));
+    EXPECT_TRUE(hasField(1, "P1"));
+    checkTable();
+
+    // a hot-plugged FRU gets the next record set
+    impl.updateObject(cpu1, cpu("P3", "S3"));
+    EXPECT_EQ(2, impl.numRSI());
+    EXPECT_EQ(4, impl.numRecords());
+    EXPECT_EQ(2, pldm_pdr_get_record_count(pdrRepo));
+    EXPECT_TRUE(hasField(2, "S3"));
+    EXPECT_FALSE(hasField(2, "S2"));
+    checkTable();
+
+    // the record sets after a resized one are moved
+    size = impl.size();
+    impl.updateObject(cpu0,
+                      {{asset, {{"SerialNumber", std::string("S2-longer")}}}});
+    EXPECT_EQ(size + 2 * 7, impl.size());
+    EXPECT_TRUE(hasField(1, "S2-longer"));
+    EXPECT_TRUE(hasField(2, "S3"));
+    checkTable();
+
+    // the FRU is removed along with its item interface
+    impl.removeInterfaces(cpu0, {cpuItem});
+    EXPECT_EQ(1, impl.numRSI());
+    EXPECT_EQ(2, impl.numRecords());
+    EXPECT_EQ(1, pldm_pdr_get_record_count(pdrRepo));
+    EXPECT_EQ(0, impl.getAssociateEntityMap().count(cpu0));
+    EXPECT_FALSE(hasField(1, "P1"));
+    EXPECT_TRUE(hasField(2, "S3"));
+    checkTable();
+
+    // a FRU without FRU fields takes no room in the table
+    impl.removeInterfaces(cpu1, {asset});
+    EXPECT_EQ(0, impl.numRSI());
+    EXPECT_EQ(0, impl.numRecords());
+    EXPECT_EQ(0, impl.size());
+    EXPECT_FALSE(hasField(2, "S3"));
+    checkTable();
+
+    impl.updateObject(cpu1, cpu("P4", "S4"));
+    EXPECT_EQ(1, impl.numRSI());
+    EXPECT_TRUE(hasField(2, "P4"));
+    checkTable();
+}
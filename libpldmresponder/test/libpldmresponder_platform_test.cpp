@@ -1,3 +1,5 @@
+#include "libpldm/utils.h"
+
 #include "common/test/mocked_utils.hpp"
 #include "common/utils.hpp"
 #include "libpldmresponder/event_parser.hpp"
@@ -11,6 +13,7 @@
 #include <sdbusplus/test/sdbus_mock.hpp>
 #include <sdeventplus/event.hpp>
 
+#include <cstring>
 #include <iostream>
 
 using namespace pldm::pdr;
@@ -93,6 +96,102 @@ TEST(getPDR, testShortRead)
     pldm_pdr_destroy(pdrRepo);
 }
 
+TEST(getPDR, testMultipartRead)
+{
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + PLDM_GET_PDR_REQ_BYTES>
+        requestPayload{};
+    auto req = reinterpret_cast<pldm_msg*>(requestPayload.data());
+    size_t requestPayloadLength = requestPayload.size() - sizeof(pldm_msg_hdr);
+
+    MockdBusHandler mockedUtils;
+    EXPECT_CALL(mockedUtils, getService(StrEq("/foo/bar"), _))
+        .Times(5)
+        .WillRepeatedly(Return("foo.bar"));
+
+    auto pdrRepo = pldm_pdr_init();
+    auto event = sdeventplus::Event::get_default();
+    Handler handler(&mockedUtils, "./pdr_jsons/state_effecter/good", pdrRepo,
+                    nullptr, nullptr, nullptr, nullptr, event);
+    Repo repo(pdrRepo);
+    ASSERT_EQ(repo.empty(), false);
+
+    // the parts are shorter than the PDR header, so the record change number
+    // is taken from the repo
+    pdr_utils::PdrEntry e;
+    ASSERT_NE(pdr::getRecordByHandle(repo, 1, e), nullptr);
+    ASSERT_GE(e.size, sizeof(pldm_pdr_hdr));
+    pldm_pdr_hdr pdrHdr{};
+    std::memcpy(&pdrHdr, e.data, sizeof(pdrHdr));
+    uint16_t recordChangeNum = le16toh(pdrHdr.record_change_num);
+
+    constexpr uint16_t partSize = 5;
+    std::vector<uint8_t> record;
+    uint32_t dataTransferHandle = 0;
+    uint8_t transferOpFlag = PLDM_GET_FIRSTPART;
+    uint8_t transferFlag = 0;
+    uint8_t transferCRC = 0;
+    do
+    {
+        auto rc = encode_get_pdr_req(0, 1, dataTransferHandle, transferOpFlag,
+                                     partSize, recordChangeNum, req,
+                                     requestPayloadLength);
+        ASSERT_EQ(rc, PLDM_SUCCESS);
+        auto response = handler.getPDR(req, requestPayloadLength);
+        auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
+
+        uint8_t completionCode{};
+        uint32_t nextRecordHandle{};
+        uint16_t respCount{};
+        std::array<uint8_t, partSize> data{};
+        rc = decode_get_pdr_resp(responsePtr,
+                                 response.size() - sizeof(pldm_msg_hdr),
+                                 &completionCode, &nextRecordHandle,
+                                 &dataTransferHandle, &transferFlag,
+                                 &respCount, data.data(), data.size(),
+                                 &transferCRC);
+        ASSERT_EQ(rc, PLDM_SUCCESS);
+        ASSERT_EQ(completionCode, PLDM_SUCCESS);
+        EXPECT_EQ(nextRecordHandle, 2u);
+        EXPECT_EQ(transferFlag, record.empty() ? PLDM_START
+                                 : dataTransferHandle ? PLDM_MIDDLE
+                                                      : PLDM_END);
+        record.insert(record.end(), data.begin(), data.begin() + respCount);
+        transferOpFlag = PLDM_GET_NEXTPART;
+    } while (transferFlag != PLDM_END);
+
+    ASSERT_EQ(record.size(), e.size);
+    EXPECT_TRUE(std::equal(record.begin(), record.end(), e.data));
+    EXPECT_EQ(transferCRC, crc8(record.data(), record.size()));
+
+    // a part past the end of the record
+    auto rc = encode_get_pdr_req(0, 1, e.size, PLDM_GET_NEXTPART, partSize,
+                                 recordChangeNum, req, requestPayloadLength);
+    ASSERT_EQ(rc, PLDM_SUCCESS);
+    auto response = handler.getPDR(req, requestPayloadLength);
+    auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
+    EXPECT_EQ(responsePtr->payload[0],
+              PLDM_PLATFORM_INVALID_DATA_TRANSFER_HANDLE);
+
+    // the record changed since the first part
+    rc = encode_get_pdr_req(0, 1, partSize, PLDM_GET_NEXTPART, partSize,
+                            recordChangeNum + 1, req, requestPayloadLength);
+    ASSERT_EQ(rc, PLDM_SUCCESS);
+    response = handler.getPDR(req, requestPayloadLength);
+    responsePtr = reinterpret_cast<pldm_msg*>(response.data());
+    EXPECT_EQ(responsePtr->payload[0],
+              PLDM_PLATFORM_INVALID_RECORD_CHANGE_NUMBER);
+
+    // a zero sized part past the start of the record
+    rc = encode_get_pdr_req(0, 1, partSize, PLDM_GET_NEXTPART, 0,
+                            recordChangeNum, req, requestPayloadLength);
+    ASSERT_EQ(rc, PLDM_SUCCESS);
+    response = handler.getPDR(req, requestPayloadLength);
+    responsePtr = reinterpret_cast<pldm_msg*>(response.data());
+    EXPECT_EQ(responsePtr->payload[0], PLDM_ERROR_INVALID_DATA);
+
+    pldm_pdr_destroy(pdrRepo);
+}
+
 TEST(getPDR, testBadRecordHandle)
 {
     std::array<uint8_t, sizeof(pldm_msg_hdr) + PLDM_GET_PDR_REQ_BYTES>
@@ -20,6 +20,10 @@
 #include "libpldm/pdr.h"
 #include "libpldm/platform.h"
 
+#ifdef OEM_NVIDIA
+#include "oem/nvidia/libpldm/energy_count_numeric_sensor_oem.h"
+#endif
+
 #include "common/types.hpp"
 #include "common/utils.hpp"
 #include "libpldmresponder/base.hpp"
@@ -80,7 +84,11 @@ static const std::map<uint8_t, std::vector<uint8_t>> capabilities{
       PLDM_SET_BIOS_ATTRIBUTE_CURRENT_VALUE, PLDM_SET_BIOS_TABLE}},
     {PLDM_FRU,
      {PLDM_GET_FRU_RECORD_TABLE_METADATA, PLDM_GET_FRU_RECORD_TABLE,
-      PLDM_GET_FRU_RECORD_BY_OPTION}}};
+      PLDM_GET_FRU_RECORD_BY_OPTION}},
+#ifdef OEM_NVIDIA
+    {PLDM_OEM, {PLDM_OEM_GET_SENSOR_READINGS_BULK}},
+#endif
+};
 
 MockupResponder::MockupResponder(bool verbose, sdeventplus::Event& event,
                                  sdbusplus::asio::object_server& server,
@@ -348,7 +356,7 @@ Response MockupResponder::getPLDMVersion(const pldm_msg* request,
         {PLDM_PLATFORM, {0x00, 0xF0, 0xF2, 0xF1}},
         {PLDM_BIOS, {0x00, 0xF0, 0xF0, 0xF1}},
         {PLDM_FRU, {0x00, 0xF0, 0xF0, 0xF1}},
-#ifdef OEM_IBM
+#if defined(OEM_IBM) || defined(OEM_NVIDIA)
         {PLDM_OEM, {0x00, 0xF0, 0xF0, 0xF1}},
 #endif
     };
@@ -837,6 +845,69 @@ Response MockupResponder::getSensorReading(const pldm_msg* request,
     return response;
 }
 
+#ifdef OEM_NVIDIA
+Response MockupResponder::getSensorReadingsBulk(const pldm_msg* request,
+                                                size_t payloadLength)
+{
+    lg2::info("GetOEMSensorReadingsBulk");
+
+    uint8_t sensorCount = 0;
+    std::array<uint16_t, PLDM_GET_OEM_SENSOR_READINGS_BULK_MAX_SENSORS>
+        sensorIds{};
+    auto rc = decode_get_oem_sensor_readings_bulk_req(
+        request, payloadLength, &sensorCount, sensorIds.data());
+    if (rc != PLDM_SUCCESS)
+    {
+        lg2::error(
+            "Failed to decode getSensorReadingsBulk request, instance_id: {ID}, RC: {RC}",
+            "ID", request->hdr.instance_id, "RC", rc);
+        return CmdHandler::ccOnlyResponse(request, rc);
+    }
+
+    std::vector<pldm_oem_sensor_reading_entry> entries(sensorCount);
+    for (uint8_t i = 0; i < sensorCount; i++)
+    {
+        auto& entry = entries[i];
+        entry.sensor_id = sensorIds[i];
+        entry.completion_code = PLDM_PLATFORM_INVALID_SENSOR_ID;
+
+        for (auto& s : sensors)
+        {
+            if (s->sensorId == entry.sensor_id)
+            {
+                entry.completion_code = PLDM_SUCCESS;
+                entry.sensor_data_size = PLDM_SENSOR_DATA_SIZE_UINT32;
+                entry.sensor_operational_state = PLDM_SENSOR_ENABLED;
+                entry.present_reading.value_u32 =
+                    static_cast<uint32_t>(s->value);
+                break;
+            }
+        }
+    }
+
+    size_t hdrSize = sizeof(pldm_msg_hdr);
+    size_t responseLength = PLDM_GET_OEM_SENSOR_READINGS_BULK_MIN_RESP_BYTES +
+                            sensorCount *
+                                PLDM_OEM_SENSOR_READINGS_BULK_ENTRY_MAX_BYTES;
+    Response response(hdrSize + responseLength, 0);
+    auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
+
+    rc = encode_get_oem_sensor_readings_bulk_resp(
+        request->hdr.instance_id, PLDM_SUCCESS, sensorCount, entries.data(),
+        responsePtr, &responseLength);
+    if (rc != PLDM_SUCCESS)
+    {
+        lg2::error(
+            "Failed to encode getSensorReadingsBulk response, instance_id: {ID}, RC: {RC}",
+            "ID", request->hdr.instance_id, "RC", rc);
+        return CmdHandler::ccOnlyResponse(request, rc);
+    }
+    response.resize(hdrSize + responseLength);
+
+    return response;
+}
+#endif
+
 Response MockupResponder::getEventMessageBufferSize(const pldm_msg* request,
                                                     size_t payloadLength,
                                                     MockupResponder& responder)
@@ -1129,6 +1200,21 @@ std::optional<std::vector<uint8_t>>
                     // unsupportedCommandHandler case
             }
         }
+#ifdef OEM_NVIDIA
+        else if (msgType == PLDM_OEM)
+        {
+            switch (command)
+            {
+                case PLDM_OEM_GET_SENSOR_READINGS_BULK:
+                    return getSensorReadingsBulk(request, requestLen);
+                default:
+                    lg2::error(
+                        "unsupported Message:{TYPE} request length={LEN}",
+                        "TYPE", msgType, "LEN", requestLen);
+                    return unsupportedCommandHandler(requestLen, hdrFields);
+            }
+        }
+#endif
     }
     else
     {
@@ -153,6 +153,11 @@ class MockupResponder
     Response getSensorReading(const pldm_msg* request, size_t payloadLength,
                               pldm_pdr* pdrRepoRef);
 
+#ifdef OEM_NVIDIA
+    Response getSensorReadingsBulk(const pldm_msg* request,
+                                   size_t payloadLength);
+#endif
+
     Response getEventMessageBufferSize(const pldm_msg* request,
                                        size_t payloadLength,
                                        MockupResponder& responder);
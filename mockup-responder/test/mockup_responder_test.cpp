@@ -26,6 +26,10 @@
 #include "common/utils.hpp"
 #include "mockup_responder.hpp"
 
+#ifdef OEM_NVIDIA
+#include "oem/nvidia/libpldm/energy_count_numeric_sensor_oem.h"
+#endif
+
 #include <string.h>
 
 #include <boost/asio/io_context.hpp>
@@ -1499,6 +1503,58 @@ TEST_F(MockupResponderTest, testBadPayloadLengthGetSensorReading)
     EXPECT_EQ(completionCode, PLDM_ERROR_INVALID_LENGTH);
 }
 
+#ifdef OEM_NVIDIA
+TEST_F(MockupResponderTest, testGoodGetSensorReadingsBulk)
+{
+    uint8_t instanceID = 0;
+    uint8_t eid = 31;
+
+    std::array<uint16_t, 2> sensorIds{20, 200};
+    Request request(hdrSize + PLDM_GET_OEM_SENSOR_READINGS_BULK_MIN_REQ_BYTES +
+                        sensorIds.size() * sizeof(uint16_t),
+                    0);
+    auto requestMsg = reinterpret_cast<pldm_msg*>(request.data());
+
+    auto rc = encode_get_oem_sensor_readings_bulk_req(
+        instanceID, sensorIds.size(), sensorIds.data(), requestMsg,
+        request.size() - hdrSize);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    uint8_t hdr[] = {MCTP_MSG_TAG_REQ, eid, MCTP_MSG_TYPE_PLDM};
+
+    std::vector<uint8_t> fullMessage;
+    fullMessage.insert(fullMessage.end(), std::begin(hdr), std::end(hdr));
+    fullMessage.insert(fullMessage.end(), request.begin(), request.end());
+
+    auto responseOpt = mockupResponder->processRxMsg(fullMessage);
+    ASSERT_TRUE(responseOpt.has_value());
+
+    const auto& response = responseOpt.value();
+
+    auto* responseMsg = reinterpret_cast<const pldm_msg*>(response.data());
+    EXPECT_EQ(responseMsg->hdr.instance_id, instanceID);
+
+    uint8_t completionCode{};
+    uint8_t sensorCount{};
+    std::array<pldm_oem_sensor_reading_entry, 2> entries{};
+    rc = decode_get_oem_sensor_readings_bulk_resp(
+        responseMsg, response.size() - hdrSize, &completionCode, &sensorCount,
+        entries.data(), entries.size());
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    EXPECT_EQ(completionCode, PLDM_SUCCESS);
+    ASSERT_EQ(sensorCount, 2);
+
+    EXPECT_EQ(entries[0].sensor_id, 20);
+    EXPECT_EQ(entries[0].completion_code, PLDM_SUCCESS);
+    EXPECT_EQ(entries[0].sensor_data_size, PLDM_SENSOR_DATA_SIZE_UINT32);
+    EXPECT_EQ(entries[0].sensor_operational_state, PLDM_SENSOR_ENABLED);
+    EXPECT_EQ(entries[0].present_reading.value_u32, 0u);
+
+    EXPECT_EQ(entries[1].sensor_id, 200);
+    EXPECT_EQ(entries[1].completion_code, PLDM_PLATFORM_INVALID_SENSOR_ID);
+}
+#endif
+
 TEST_F(MockupResponderTest, testGoodProcessRxMsg)
 {
     uint8_t instanceId = 0;
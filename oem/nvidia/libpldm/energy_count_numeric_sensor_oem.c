@@ -133,4 +133,309 @@ int decode_get_oem_energy_count_sensor_reading_resp(
     }
 
     return PLDM_SUCCESS;
-}
\ No newline at end of file
+}
+
+static size_t sensor_data_size_to_bytes(uint8_t sensor_data_size)
+{
+    switch (sensor_data_size)
+    {
+        case PLDM_SENSOR_DATA_SIZE_UINT8:
+        case PLDM_SENSOR_DATA_SIZE_SINT8:
+            return sizeof(uint8_t);
+        case PLDM_SENSOR_DATA_SIZE_UINT16:
+        case PLDM_SENSOR_DATA_SIZE_SINT16:
+            return sizeof(uint16_t);
+        case PLDM_SENSOR_DATA_SIZE_UINT32:
+        case PLDM_SENSOR_DATA_SIZE_SINT32:
+            return sizeof(uint32_t);
+        case PLDM_SENSOR_DATA_SIZE_UINT64:
+        case PLDM_SENSOR_DATA_SIZE_SINT64:
+            return sizeof(uint64_t);
+        default:
+            return 0;
+    }
+}
+
+int encode_get_oem_sensor_readings_bulk_req(uint8_t instance_id,
+                                            uint8_t sensor_count,
+                                            const uint16_t* sensor_ids,
+                                            struct pldm_msg* msg,
+                                            size_t payload_length)
+{
+    if (msg == NULL || sensor_ids == NULL || sensor_count == 0 ||
+        sensor_count > PLDM_GET_OEM_SENSOR_READINGS_BULK_MAX_SENSORS)
+    {
+        return PLDM_ERROR_INVALID_DATA;
+    }
+
+    if (payload_length < PLDM_GET_OEM_SENSOR_READINGS_BULK_MIN_REQ_BYTES +
+                             sensor_count * sizeof(uint16_t))
+    {
+        return PLDM_ERROR_INVALID_LENGTH;
+    }
+
+    struct pldm_header_info header = {0};
+    header.msg_type = PLDM_REQUEST;
+    header.instance = instance_id;
+    header.pldm_type = PLDM_OEM;
+    header.command = PLDM_OEM_GET_SENSOR_READINGS_BULK;
+
+    uint8_t rc = pack_pldm_header(&header, &(msg->hdr));
+    if (rc != PLDM_SUCCESS)
+    {
+        return rc;
+    }
+
+    uint8_t* payload = msg->payload;
+    *payload++ = sensor_count;
+    for (uint8_t i = 0; i < sensor_count; i++)
+    {
+        uint16_t sensor_id = htole16(sensor_ids[i]);
+        memcpy(payload, &sensor_id, sizeof(sensor_id));
+        payload += sizeof(sensor_id);
+    }
+
+    return PLDM_SUCCESS;
+}
+
+int decode_get_oem_sensor_readings_bulk_req(const struct pldm_msg* msg,
+                                            size_t payload_length,
+                                            uint8_t* sensor_count,
+                                            uint16_t* sensor_ids)
+{
+    if (msg == NULL || sensor_count == NULL || sensor_ids == NULL)
+    {
+        return PLDM_ERROR_INVALID_DATA;
+    }
+
+    if (payload_length < PLDM_GET_OEM_SENSOR_READINGS_BULK_MIN_REQ_BYTES)
+    {
+        return PLDM_ERROR_INVALID_LENGTH;
+    }
+
+    const uint8_t* payload = msg->payload;
+    uint8_t count = *payload++;
+    if (count == 0 || count > PLDM_GET_OEM_SENSOR_READINGS_BULK_MAX_SENSORS)
+    {
+        return PLDM_ERROR_INVALID_DATA;
+    }
+
+    if (payload_length != PLDM_GET_OEM_SENSOR_READINGS_BULK_MIN_REQ_BYTES +
+                              count * sizeof(uint16_t))
+    {
+        return PLDM_ERROR_INVALID_LENGTH;
+    }
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        uint16_t sensor_id;
+        memcpy(&sensor_id, payload, sizeof(sensor_id));
+        sensor_ids[i] = le16toh(sensor_id);
+        payload += sizeof(sensor_id);
+    }
+    *sensor_count = count;
+
+    return PLDM_SUCCESS;
+}
+
+int encode_get_oem_sensor_readings_bulk_resp(
+    uint8_t instance_id, uint8_t completion_code, uint8_t sensor_count,
+    const struct pldm_oem_sensor_reading_entry* entries, struct pldm_msg* msg,
+    size_t* payload_length)
+{
+    if (msg == NULL || payload_length == NULL ||
+        (sensor_count && entries == NULL))
+    {
+        return PLDM_ERROR_INVALID_DATA;
+    }
+
+    struct pldm_header_info header = {0};
+    header.msg_type = PLDM_RESPONSE;
+    header.instance = instance_id;
+    header.pldm_type = PLDM_OEM;
+    header.command = PLDM_OEM_GET_SENSOR_READINGS_BULK;
+
+    uint8_t rc = pack_pldm_header(&header, &(msg->hdr));
+    if (rc != PLDM_SUCCESS)
+    {
+        return rc;
+    }
+
+    if (*payload_length < sizeof(completion_code))
+    {
+        return PLDM_ERROR_INVALID_LENGTH;
+    }
+
+    msg->payload[0] = completion_code;
+    if (completion_code != PLDM_SUCCESS)
+    {
+        *payload_length = sizeof(completion_code);
+        return PLDM_SUCCESS;
+    }
+
+    size_t length = PLDM_GET_OEM_SENSOR_READINGS_BULK_MIN_RESP_BYTES;
+    if (*payload_length < length)
+    {
+        return PLDM_ERROR_INVALID_LENGTH;
+    }
+    msg->payload[1] = sensor_count;
+
+    for (uint8_t i = 0; i < sensor_count; i++)
+    {
+        const struct pldm_oem_sensor_reading_entry* entry = &entries[i];
+        size_t reading_size = 0;
+        size_t entry_size = sizeof(uint16_t) + sizeof(uint8_t);
+
+        if (entry->completion_code == PLDM_SUCCESS)
+        {
+            reading_size = sensor_data_size_to_bytes(entry->sensor_data_size);
+            if (reading_size == 0)
+            {
+                return PLDM_ERROR_INVALID_DATA;
+            }
+            entry_size =
+                PLDM_OEM_SENSOR_READINGS_BULK_ENTRY_HDR_BYTES + reading_size;
+        }
+
+        if (*payload_length < length + entry_size)
+        {
+            return PLDM_ERROR_INVALID_LENGTH;
+        }
+
+        uint8_t* dst = msg->payload + length;
+        uint16_t sensor_id = htole16(entry->sensor_id);
+        memcpy(dst, &sensor_id, sizeof(sensor_id));
+        dst[2] = entry->completion_code;
+        if (entry->completion_code == PLDM_SUCCESS)
+        {
+            dst[3] = entry->sensor_data_size;
+            dst[4] = entry->sensor_operational_state;
+
+            union_sensor_data_size reading = entry->present_reading;
+            if (reading_size == sizeof(uint16_t))
+            {
+                reading.value_u16 = htole16(reading.value_u16);
+            }
+            else if (reading_size == sizeof(uint32_t))
+            {
+                reading.value_u32 = htole32(reading.value_u32);
+            }
+            else if (reading_size == sizeof(uint64_t))
+            {
+                reading.value_u64 = htole64(reading.value_u64);
+            }
+            memcpy(dst + PLDM_OEM_SENSOR_READINGS_BULK_ENTRY_HDR_BYTES,
+                   &reading, reading_size);
+        }
+        length += entry_size;
+    }
+    *payload_length = length;
+
+    return PLDM_SUCCESS;
+}
+
+int decode_get_oem_sensor_readings_bulk_resp(
+    const struct pldm_msg* msg, size_t payload_length, uint8_t* completion_code,
+    uint8_t* sensor_count, struct pldm_oem_sensor_reading_entry* entries,
+    uint8_t max_entries)
+{
+    if (msg == NULL || completion_code == NULL || sensor_count == NULL ||
+        entries == NULL)
+    {
+        return PLDM_ERROR_INVALID_DATA;
+    }
+
+    if (payload_length < sizeof(*completion_code))
+    {
+        return PLDM_ERROR_INVALID_LENGTH;
+    }
+
+    *completion_code = msg->payload[0];
+    if (PLDM_SUCCESS != *completion_code)
+    {
+        return PLDM_SUCCESS;
+    }
+
+    if (payload_length < PLDM_GET_OEM_SENSOR_READINGS_BULK_MIN_RESP_BYTES)
+    {
+        return PLDM_ERROR_INVALID_LENGTH;
+    }
+
+    uint8_t count = msg->payload[1];
+    if (count > max_entries)
+    {
+        return PLDM_ERROR_INVALID_LENGTH;
+    }
+
+    size_t offset = PLDM_GET_OEM_SENSOR_READINGS_BULK_MIN_RESP_BYTES;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        struct pldm_oem_sensor_reading_entry* entry = &entries[i];
+        const uint8_t* src = msg->payload + offset;
+
+        if (payload_length < offset + sizeof(uint16_t) + sizeof(uint8_t))
+        {
+            return PLDM_ERROR_INVALID_LENGTH;
+        }
+
+        uint16_t sensor_id;
+        memcpy(&sensor_id, src, sizeof(sensor_id));
+        memset(entry, 0, sizeof(*entry));
+        entry->sensor_id = le16toh(sensor_id);
+        entry->completion_code = src[2];
+        if (entry->completion_code != PLDM_SUCCESS)
+        {
+            offset += sizeof(uint16_t) + sizeof(uint8_t);
+            continue;
+        }
+
+        if (payload_length <
+            offset + PLDM_OEM_SENSOR_READINGS_BULK_ENTRY_HDR_BYTES)
+        {
+            return PLDM_ERROR_INVALID_LENGTH;
+        }
+        entry->sensor_data_size = src[3];
+        entry->sensor_operational_state = src[4];
+
+        size_t reading_size =
+            sensor_data_size_to_bytes(entry->sensor_data_size);
+        if (reading_size == 0)
+        {
+            return PLDM_ERROR_INVALID_DATA;
+        }
+        if (payload_length < offset +
+                                 PLDM_OEM_SENSOR_READINGS_BULK_ENTRY_HDR_BYTES +
+                                 reading_size)
+        {
+            return PLDM_ERROR_INVALID_LENGTH;
+        }
+
+        memcpy(&entry->present_reading,
+               src + PLDM_OEM_SENSOR_READINGS_BULK_ENTRY_HDR_BYTES,
+               reading_size);
+        if (reading_size == sizeof(uint16_t))
+        {
+            entry->present_reading.value_u16 =
+                le16toh(entry->present_reading.value_u16);
+        }
+        else if (reading_size == sizeof(uint32_t))
+        {
+            entry->present_reading.value_u32 =
+                le32toh(entry->present_reading.value_u32);
+        }
+        else if (reading_size == sizeof(uint64_t))
+        {
+            entry->present_reading.value_u64 =
+                le64toh(entry->present_reading.value_u64);
+        }
+        offset += PLDM_OEM_SENSOR_READINGS_BULK_ENTRY_HDR_BYTES + reading_size;
+    }
+
+    if (offset != payload_length)
+    {
+        return PLDM_ERROR_INVALID_LENGTH;
+    }
+    *sensor_count = count;
+
+    return PLDM_SUCCESS;
+}
@@ -35,6 +35,19 @@ extern "C"
 // Minimum response length
 #define PLDM_GET_OEM_ENERGYCOUNT_SENSOR_READING_MIN_RESP_BYTES 4
 
+// Minimum request and response length of GetOEMSensorReadingsBulk
+#define PLDM_GET_OEM_SENSOR_READINGS_BULK_MIN_REQ_BYTES 1
+#define PLDM_GET_OEM_SENSOR_READINGS_BULK_MIN_RESP_BYTES 2
+
+// Maximum number of sensors in one GetOEMSensorReadingsBulk request
+#define PLDM_GET_OEM_SENSOR_READINGS_BULK_MAX_SENSORS 32
+
+// Size of a reading entry in the GetOEMSensorReadingsBulk response, without
+// the present reading whose size depends on the sensor data size
+#define PLDM_OEM_SENSOR_READINGS_BULK_ENTRY_HDR_BYTES 5
+#define PLDM_OEM_SENSOR_READINGS_BULK_ENTRY_MAX_BYTES                          \
+    (PLDM_OEM_SENSOR_READINGS_BULK_ENTRY_HDR_BYTES + sizeof(uint64_t))
+
 // Minimum length of OEM energyCount numeric sensor PDR
 #define PLDM_PDR_OEM_ENERGYCOUNT_NUMERIC_SENSOR_PDR_FIXED_LENGTH 19
 #define PLDM_PDR_OEM_ENERGYCOUNT_NUMERIC_SENSOR_PDR_VARIED_MIN_LENGTH 2
@@ -46,7 +59,8 @@ extern "C"
      */
     enum pldm_oem_commands
     {
-        PLDM_OEM_GET_ENERGYCOUNT_SENSOR_READING = 0x11
+        PLDM_OEM_GET_ENERGYCOUNT_SENSOR_READING = 0x11,
+        PLDM_OEM_GET_SENSOR_READINGS_BULK = 0x12
     };
 
     /** @struct pldm_oem_energycount_numeric_sensor_value_pdr
@@ -124,6 +138,87 @@ extern "C"
         uint8_t* completion_code, uint8_t* sensor_data_size,
         uint8_t* sensor_operational_state, uint8_t* present_reading);
 
+    /** @struct pldm_oem_sensor_reading_entry
+     *
+     *  Structure representing the reading of one sensor in the
+     *  GetOEMSensorReadingsBulk response. On the wire an entry is the sensor
+     *  ID and completion code, followed by the data size, operational state
+     *  and present reading only when the completion code is PLDM_SUCCESS.
+     */
+    struct pldm_oem_sensor_reading_entry
+    {
+        uint16_t sensor_id;
+        uint8_t completion_code;
+        uint8_t sensor_data_size;
+        uint8_t sensor_operational_state;
+        union_sensor_data_size present_reading;
+    };
+
+    /* GetOEMSensorReadingsBulk */
+
+    /** @brief Encode GetOEMSensorReadingsBulk request data
+     *
+     *  @param[in] instance_id - Message's instance id
+     *  @param[in] sensor_count - Number of sensors to be read, at most
+     *         PLDM_GET_OEM_SENSOR_READINGS_BULK_MAX_SENSORS
+     *  @param[in] sensor_ids - IDs of the sensors to be read
+     *  @param[out] msg - Message will be written to this
+     *  @param[in] payload_length - Length of request message payload
+     *  @return pldm_completion_codes
+     *  @note	Caller is responsible for memory alloc and dealloc of param
+     * 		'msg.payload'
+     */
+    int encode_get_oem_sensor_readings_bulk_req(uint8_t instance_id,
+                                                uint8_t sensor_count,
+                                                const uint16_t* sensor_ids,
+                                                struct pldm_msg* msg,
+                                                size_t payload_length);
+
+    /** @brief Decode GetOEMSensorReadingsBulk request data
+     *
+     *  @param[in] msg - Request message
+     *  @param[in] payload_length - Length of request message payload
+     *  @param[out] sensor_count - Number of sensors to be read
+     *  @param[out] sensor_ids - IDs of the sensors to be read, it must hold
+     *         PLDM_GET_OEM_SENSOR_READINGS_BULK_MAX_SENSORS entries
+     *  @return pldm_completion_codes
+     */
+    int decode_get_oem_sensor_readings_bulk_req(const struct pldm_msg* msg,
+                                                size_t payload_length,
+                                                uint8_t* sensor_count,
+                                                uint16_t* sensor_ids);
+
+    /** @brief Encode GetOEMSensorReadingsBulk response data
+     *
+     *  @param[in] instance_id - Message's instance id
+     *  @param[in] completion_code - PLDM completion code
+     *  @param[in] sensor_count - Number of reading entries
+     *  @param[in] entries - The reading entries
+     *  @param[out] msg - Message will be written to this
+     *  @param[in,out] payload_length - Size of the response payload buffer on
+     *         input, length of the encoded payload on output
+     *  @return pldm_completion_codes
+     */
+    int encode_get_oem_sensor_readings_bulk_resp(
+        uint8_t instance_id, uint8_t completion_code, uint8_t sensor_count,
+        const struct pldm_oem_sensor_reading_entry* entries,
+        struct pldm_msg* msg, size_t* payload_length);
+
+    /** @brief Decode GetOEMSensorReadingsBulk response data
+     *
+     *  @param[in] msg - Response message
+     *  @param[in] payload_length - Length of response message payload
+     *  @param[out] completion_code - PLDM completion code
+     *  @param[out] sensor_count - Number of reading entries
+     *  @param[out] entries - The reading entries
+     *  @param[in] max_entries - Number of entries the entries array can hold
+     *  @return pldm_completion_codes
+     */
+    int decode_get_oem_sensor_readings_bulk_resp(
+        const struct pldm_msg* msg, size_t payload_length,
+        uint8_t* completion_code, uint8_t* sensor_count,
+        struct pldm_oem_sensor_reading_entry* entries, uint8_t max_entries);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,145 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "oem/nvidia/libpldm/energy_count_numeric_sensor_oem.h"
+
+#include <array>
+
+#include <gtest/gtest.h>
+
+constexpr auto hdrSize = sizeof(pldm_msg_hdr);
+
+TEST(GetOEMSensorReadingsBulk, testGoodEncodeDecodeRequest)
+{
+    constexpr uint8_t sensorCount = 3;
+    std::array<uint16_t, sensorCount> sensorIds{0x1234, 0x0001, 0xff00};
+    std::array<uint8_t, hdrSize +
+                            PLDM_GET_OEM_SENSOR_READINGS_BULK_MIN_REQ_BYTES +
+                            sensorCount * sizeof(uint16_t)>
+        requestMsg{};
+    auto request = reinterpret_cast<pldm_msg*>(requestMsg.data());
+
+    auto rc = encode_get_oem_sensor_readings_bulk_req(
+        0, sensorCount, sensorIds.data(), request,
+        requestMsg.size() - hdrSize);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    EXPECT_EQ(request->hdr.type, PLDM_OEM);
+    EXPECT_EQ(request->hdr.command, PLDM_OEM_GET_SENSOR_READINGS_BULK);
+    EXPECT_EQ(request->payload[0], sensorCount);
+    EXPECT_EQ(request->payload[1], 0x34);
+    EXPECT_EQ(request->payload[2], 0x12);
+
+    uint8_t count = 0;
+    std::array<uint16_t, PLDM_GET_OEM_SENSOR_READINGS_BULK_MAX_SENSORS> ids{};
+    rc = decode_get_oem_sensor_readings_bulk_req(
+        request, requestMsg.size() - hdrSize, &count, ids.data());
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    EXPECT_EQ(count, sensorCount);
+    EXPECT_EQ(ids[0], sensorIds[0]);
+    EXPECT_EQ(ids[1], sensorIds[1]);
+    EXPECT_EQ(ids[2], sensorIds[2]);
+}
+
+TEST(GetOEMSensorReadingsBulk, testBadEncodeRequest)
+{
+    std::array<uint16_t, 2> sensorIds{1, 2};
+    std::array<uint8_t, hdrSize + 8> requestMsg{};
+    auto request = reinterpret_cast<pldm_msg*>(requestMsg.data());
+
+    auto rc = encode_get_oem_sensor_readings_bulk_req(0, 0, sensorIds.data(),
+                                                      request, 8);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+    rc = encode_get_oem_sensor_readings_bulk_req(
+        0, PLDM_GET_OEM_SENSOR_READINGS_BULK_MAX_SENSORS + 1,
+        sensorIds.data(), request, 8);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+    rc = encode_get_oem_sensor_readings_bulk_req(0, 2, sensorIds.data(),
+                                                 request, 4);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_LENGTH);
+}
+
+TEST(GetOEMSensorReadingsBulk, testGoodEncodeDecodeResponse)
+{
+    std::array<pldm_oem_sensor_reading_entry, 3> entries{};
+    entries[0].sensor_id = 1;
+    entries[0].completion_code = PLDM_SUCCESS;
+    entries[0].sensor_data_size = PLDM_SENSOR_DATA_SIZE_UINT8;
+    entries[0].sensor_operational_state = PLDM_SENSOR_ENABLED;
+    entries[0].present_reading.value_u8 = 0x5a;
+    entries[1].sensor_id = 2;
+    entries[1].completion_code = PLDM_ERROR_INVALID_DATA;
+    entries[2].sensor_id = 3;
+    entries[2].completion_code = PLDM_SUCCESS;
+    entries[2].sensor_data_size = PLDM_SENSOR_DATA_SIZE_UINT64;
+    entries[2].sensor_operational_state = PLDM_SENSOR_ENABLED;
+    entries[2].present_reading.value_u64 = 0x0102030405060708;
+
+    std::array<uint8_t,
+               hdrSize + PLDM_GET_OEM_SENSOR_READINGS_BULK_MIN_RESP_BYTES +
+                   3 * PLDM_OEM_SENSOR_READINGS_BULK_ENTRY_MAX_BYTES>
+        responseMsg{};
+    auto response = reinterpret_cast<pldm_msg*>(responseMsg.data());
+    size_t payloadLength = responseMsg.size() - hdrSize;
+
+    auto rc = encode_get_oem_sensor_readings_bulk_resp(
+        0, PLDM_SUCCESS, entries.size(), entries.data(), response,
+        &payloadLength);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    EXPECT_EQ(payloadLength, 2u + (5u + 1u) + 3u + (5u + 8u));
+
+    uint8_t completionCode = PLDM_ERROR;
+    uint8_t count = 0;
+    std::array<pldm_oem_sensor_reading_entry, 3> decoded{};
+    rc = decode_get_oem_sensor_readings_bulk_resp(
+        response, payloadLength, &completionCode, &count, decoded.data(),
+        decoded.size());
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    EXPECT_EQ(completionCode, PLDM_SUCCESS);
+    EXPECT_EQ(count, 3);
+    EXPECT_EQ(decoded[0].sensor_id, 1);
+    EXPECT_EQ(decoded[0].present_reading.value_u8, 0x5a);
+    EXPECT_EQ(decoded[1].sensor_id, 2);
+    EXPECT_EQ(decoded[1].completion_code, PLDM_ERROR_INVALID_DATA);
+    EXPECT_EQ(decoded[2].sensor_id, 3);
+    EXPECT_EQ(decoded[2].sensor_data_size, PLDM_SENSOR_DATA_SIZE_UINT64);
+    EXPECT_EQ(decoded[2].present_reading.value_u64, 0x0102030405060708u);
+}
+
+TEST(GetOEMSensorReadingsBulk, testBadDecodeResponse)
+{
+    std::array<uint8_t, hdrSize + 8> responseMsg{0, 0, 0, PLDM_SUCCESS,
+                                                 2,  1, 0, PLDM_SUCCESS,
+                                                 PLDM_SENSOR_DATA_SIZE_UINT8};
+    auto response = reinterpret_cast<pldm_msg*>(responseMsg.data());
+
+    uint8_t completionCode = 0;
+    uint8_t count = 0;
+    std::array<pldm_oem_sensor_reading_entry, 2> decoded{};
+
+    // Entry is truncated before its present reading
+    auto rc = decode_get_oem_sensor_readings_bulk_resp(
+        response, 6, &completionCode, &count, decoded.data(), decoded.size());
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_LENGTH);
+
+    // More entries than the caller can hold
+    rc = decode_get_oem_sensor_readings_bulk_resp(
+        response, 8, &completionCode, &count, decoded.data(), 1);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_LENGTH);
+
+    rc = decode_get_oem_sensor_readings_bulk_resp(
+        nullptr, 8, &completionCode, &count, decoded.data(), decoded.size());
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+}
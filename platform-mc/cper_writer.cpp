@@ -0,0 +1,214 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cper_writer.hpp"
+
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+namespace pldm
+{
+namespace platform_mc
+{
+namespace fs = std::filesystem;
+
+static uint64_t nowInUsec()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+CperWriter::CperWriter(sdeventplus::Event& event, const fs::path& dirName,
+                       size_t maxRecords, size_t maxBytes, Callback callback,
+                       bool verbose) :
+    dirName(dirName),
+    maxRecords(maxRecords), maxBytes(maxBytes), callback(std::move(callback)),
+    verbose(verbose), worker(event, [this]() { processWritten(); })
+{
+    worker.start([this]() { run(); });
+}
+
+CperWriter::~CperWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    cv.notify_one();
+    worker.join();
+}
+
+bool CperWriter::enqueue(tid_t tid, std::vector<uint8_t>&& data)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.size() >= maxRecords ||
+            queuedBytes + data.size() > maxBytes)
+        {
+            statistics.dropped++;
+            lg2::error(
+                "CPER queue is full, drop the record from TID={TID}, QUEUE_DEPTH={DEPTH} QUEUED_BYTES={BYTES} DROPPED={DROPPED}.",
+                "TID", tid, "DEPTH", queue.size(), "BYTES", queuedBytes,
+                "DROPPED", statistics.dropped);
+            return false;
+        }
+
+        queuedBytes += data.size();
+        queue.emplace_back(Record{tid, std::move(data), nowInUsec()});
+        statistics.queueDepth = queue.size();
+        statistics.maxQueueDepth =
+            std::max(statistics.maxQueueDepth, statistics.queueDepth);
+    }
+    cv.notify_one();
+    return true;
+}
+
+CperWriterStatistics CperWriter::getStatistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return statistics;
+}
+
+void CperWriter::run()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        cv.wait(lock, [this] { return stop || !queue.empty(); });
+        if (queue.empty())
+        {
+            // stopped and all the queued records are written
+            break;
+        }
+
+        // the record stays accounted in the queue limits until it is written
+        const auto& record = queue.front();
+        lock.unlock();
+        auto fileName = write(record);
+        auto latency = nowInUsec() - record.enqueueTimeInUsec;
+        lock.lock();
+
+        queuedBytes -= record.data.size();
+        queue.pop_front();
+        statistics.queueDepth = queue.size();
+        statistics.lastLatencyInUsec = latency;
+        statistics.maxLatencyInUsec =
+            std::max(statistics.maxLatencyInUsec, latency);
+        if (fileName.empty())
+        {
+            statistics.failed++;
+            continue;
+        }
+        statistics.written++;
+        written.emplace_back(std::move(fileName));
+        worker.notify();
+    }
+}
+
+std::string CperWriter::write(const Record& record)
+{
+    std::error_code ec;
+    auto dirStatus = fs::status(dirName, ec);
+    if (fs::exists(dirStatus))
+    {
+        if (!fs::is_directory(dirStatus))
+        {
+            lg2::error("Failed to create {DIRNAME} directory", "DIRNAME",
+                       dirName.string());
+            return {};
+        }
+    }
+    else
+    {
+        fs::create_directory(dirName, ec);
+    }
+
+    std::string fileName{(dirName / "cper-XXXXXX").string()};
+    auto fd = mkstemp(fileName.data());
+    if (fd < 0)
+    {
+        lg2::error("Failed to generate temp file:{ERRORNO}", "ERRORNO",
+                   std::strerror(errno));
+        return {};
+    }
+    close(fd);
+
+    std::ofstream ofs;
+    ofs.exceptions(std::ofstream::failbit | std::ofstream::badbit |
+                   std::ofstream::eofbit);
+    try
+    {
+        ofs.open(fileName);
+        ofs.write(reinterpret_cast<const char*>(record.data.data()),
+                  record.data.size());
+        ofs.close();
+    }
+    catch (const std::exception& e)
+    {
+        lg2::error("Failed to save CPER to {FILENAME}, {ERROR}.", "FILENAME",
+                   fileName, "ERROR", e);
+        return {};
+    }
+
+    return fileName;
+}
+
+void CperWriter::processWritten()
+{
+    std::vector<std::string> fileNames;
+    CperWriterStatistics current;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        fileNames.swap(written);
+        current = statistics;
+    }
+
+    // the counters are reported on the first written file and then each
+    // time the count doubles, or on every batch in verbose mode
+    bool report = current.written >= nextReportCount;
+    if (report)
+    {
+        nextReportCount = current.written * 2;
+    }
+    if (verbose || report)
+    {
+        lg2::info(
+            "CPER files written, COUNT={COUNT} WRITTEN={WRITTEN} DROPPED={DROPPED} FAILED={FAILED} QUEUE_DEPTH={DEPTH} MAX_QUEUE_DEPTH={MAX_DEPTH} LATENCY_US={LATENCY} MAX_LATENCY_US={MAX_LATENCY}.",
+            "COUNT", fileNames.size(), "WRITTEN", current.written, "DROPPED",
+            current.dropped, "FAILED", current.failed, "DEPTH",
+            current.queueDepth, "MAX_DEPTH", current.maxQueueDepth, "LATENCY",
+            current.lastLatencyInUsec, "MAX_LATENCY",
+            current.maxLatencyInUsec);
+    }
+
+    for (const auto& fileName : fileNames)
+    {
+        if (callback)
+        {
+            callback(fileName);
+        }
+    }
+}
+
+} // namespace platform_mc
+} // namespace pldm
@@ -0,0 +1,164 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "common/types.hpp"
+#include "common/worker_thread.hpp"
+
+#include <sdeventplus/event.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+/** @struct CperWriterStatistics
+ *
+ *  The counters of CperWriter, for reporting the health of the persistence
+ *  stage.
+ */
+struct CperWriterStatistics
+{
+    /** @brief records written to files */
+    uint64_t written = 0;
+
+    /** @brief records dropped because the queue was full */
+    uint64_t dropped = 0;
+
+    /** @brief records failed to be written */
+    uint64_t failed = 0;
+
+    /** @brief records waiting in the queue */
+    size_t queueDepth = 0;
+
+    /** @brief the highest queue depth seen */
+    size_t maxQueueDepth = 0;
+
+    /** @brief the time from enqueue to the file written of the last record */
+    uint64_t lastLatencyInUsec = 0;
+
+    /** @brief the highest time from enqueue to the file written */
+    uint64_t maxLatencyInUsec = 0;
+};
+
+/**
+ * @brief CperWriter
+ *
+ * CperWriter saves the CPER event data to files in a worker thread, so a
+ * burst of large records doesn't block the event loop which drives sensor
+ * polling and the MCTP socket. The queue is bounded by the number of records
+ * and their total size, the records which don't fit are dropped. The
+ * callback is invoked on the event loop once a file is written.
+ */
+class CperWriter
+{
+  public:
+    /** @brief callback invoked on the event loop with the written file */
+    using Callback = std::function<void(const std::string& fileName)>;
+
+    CperWriter() = delete;
+    CperWriter(const CperWriter&) = delete;
+    CperWriter(CperWriter&&) = delete;
+    CperWriter& operator=(const CperWriter&) = delete;
+    CperWriter& operator=(CperWriter&&) = delete;
+
+    /** @brief Constructor
+     *
+     *  @param[in] event - the event loop to invoke the callback on
+     *  @param[in] dirName - directory of the CPER files
+     *  @param[in] maxRecords - the maximum number of queued records
+     *  @param[in] maxBytes - the maximum total size of queued records
+     *  @param[in] callback - callback invoked once a file is written
+     *  @param[in] verbose - log the counters on every written batch instead
+     *  of each time the written count doubles
+     */
+    CperWriter(sdeventplus::Event& event, const std::filesystem::path& dirName,
+               size_t maxRecords, size_t maxBytes, Callback callback,
+               bool verbose = false);
+
+    /** @brief Stop the worker thread after the queued records are written */
+    ~CperWriter();
+
+    /** @brief Queue a record to be written
+     *
+     *  @param[in] tid - the terminus ID the record is from
+     *  @param[in] data - the record data
+     *
+     *  @return true if queued, false if dropped by the queue limits
+     */
+    bool enqueue(tid_t tid, std::vector<uint8_t>&& data);
+
+    /** @brief Get the counters of the writer */
+    CperWriterStatistics getStatistics() const;
+
+  private:
+    struct Record
+    {
+        tid_t tid;
+        std::vector<uint8_t> data;
+        uint64_t enqueueTimeInUsec;
+    };
+
+    /** @brief The worker thread loop */
+    void run();
+
+    /** @brief Write a record to a new file in dirName
+     *
+     *  @param[in] record - the record to be written
+     *
+     *  @return the file name, empty if failed
+     */
+    std::string write(const Record& record);
+
+    /** @brief Invoke the callback for the written files, run on the event
+     *         loop when the worker notifies
+     */
+    void processWritten();
+
+    std::filesystem::path dirName;
+    size_t maxRecords;
+    size_t maxBytes;
+    Callback callback;
+    bool verbose;
+
+    mutable std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<Record> queue;
+    size_t queuedBytes = 0;
+    std::vector<std::string> written;
+    CperWriterStatistics statistics;
+    bool stop = false;
+
+    /** @brief the written count the counters are next reported at, only
+     *         used on the event loop
+     */
+    uint64_t nextReportCount = 1;
+
+    pldm::utils::WorkerThread worker;
+};
+
+} // namespace platform_mc
+} // namespace pldm
@@ -27,6 +27,7 @@
 #include <xyz/openbmc_project/Logging/Entry/server.hpp>
 
 #include <cerrno>
+#include <cmath>
 #include <variant>
 
 namespace pldm
@@ -125,52 +126,29 @@ int EventManager::handlePlatformEvent(tid_t tid, uint8_t eventClass,
             return rc;
         }
 
-        // save event data to file
-        std::string dirName{"/var/cper"};
-        auto dirStatus = fs::status(dirName);
-        if (fs::exists(dirStatus))
-        {
-            if (!fs::is_directory(dirStatus))
-            {
-                lg2::error("Failed to create {DIRNAME} directory", "DIRNAME",
-                           dirName);
-                return PLDM_ERROR;
-            }
-        }
-        else
+        // save event data to file in the writer thread, the CPER logger is
+        // notified on the event loop once the file is written
+        if (!cperWriter)
         {
-            fs::create_directory(dirName);
+            auto event = sdeventplus::Event::get_default();
+            cperWriter = std::make_unique<CperWriter>(
+                event, "/var/cper", CPER_QUEUE_MAX_RECORDS,
+                CPER_QUEUE_MAX_BYTES,
+                [this](const std::string& fileName) {
+                    notifyCPERLogger(fileName);
+                },
+                verbose);
         }
 
-        std::string fileName{dirName + "/cper-XXXXXX"};
-        auto fd = mkstemp(fileName.data());
-        if (fd < 0)
-        {
-            lg2::error("Failed to generate temp file:{ERRORNO}", "ERRORNO",
-                       std::strerror(errno));
-            return PLDM_ERROR;
-        }
-        close(fd);
-
-        std::ofstream ofs;
-        ofs.exceptions(std::ofstream::failbit | std::ofstream::badbit |
-                       std::ofstream::eofbit);
-
-        try
-        {
-            platformEventStatus = PLDM_EVENT_ACCEPTED_FOR_LOGGING;
-            ofs.open(fileName);
-            ofs.write(reinterpret_cast<const char*>(eventData), eventDataSize);
-            ofs.close();
-        }
-        catch (const std::exception& e)
+        if (!cperWriter->enqueue(
+                tid, std::vector<uint8_t>(eventData, eventData + eventDataSize)))
         {
-            lg2::error("Failed to save CPER to {FILENAME}, {ERROR}.",
-                       "FILENAME", fileName, "ERROR", e);
-            return PLDM_ERROR;
+            // the event is answered with the rejected status, an error
+            // completion code would hide it from the terminus
+            platformEventStatus = PLDM_EVENT_LOGGING_REJECTED;
+            return PLDM_SUCCESS;
         }
-
-        notifyCPERLogger(fileName);
+        platformEventStatus = PLDM_EVENT_ACCEPTED_FOR_LOGGING;
     }
     else if (eventClass == PLDM_OEM_EVENT_CLASS_0xFC)
     {
@@ -217,7 +195,7 @@ requester::Coroutine
     uint8_t rc = 0;
     uint8_t transferOperationFlag = PLDM_GET_FIRSTPART;
     uint32_t dataTransferHandle = 0;
-    uint32_t eventIdToAcknowledge = 0;
+    uint16_t eventIdToAcknowledge = 0;
 
     uint8_t completionCode = 0;
     uint8_t eventTid = 0;
@@ -225,17 +203,29 @@ requester::Coroutine
     uint32_t nextDataTransferHandle = 0;
     uint8_t transferFlag = 0;
     uint8_t eventClass = 0;
-    std::vector<uint8_t> eventMessage{};
-    uint32_t eventDataSize = maxBufferSize;
-    std::vector<uint8_t> eventData(eventDataSize);
     uint32_t eventDataIntegrityChecksum = 0;
+
+    auto it = termini.find(tid);
+    bool mergedEventAck = it != termini.end() && it->second->mergedEventAck;
+
+    // The parts of an event are decoded in place at the end of eventMessage,
+    // a part never carries more than the negotiated buffer size. The buffer
+    // is reused for the following events.
+    std::vector<uint8_t> eventMessage;
+    eventMessage.reserve(maxBufferSize);
+    // checksum of the received parts, updated as each part arrives
+    uint32_t eventMessageChecksum = 0;
     while (eventId != 0)
     {
+        auto offset = eventMessage.size();
+        eventMessage.resize(offset + maxBufferSize);
+        uint32_t eventDataSize = 0;
         rc = co_await pollForPlatformEventMessage(
             tid, transferOperationFlag, dataTransferHandle,
             eventIdToAcknowledge, completionCode, eventTid, eventId,
-            nextDataTransferHandle, transferFlag, eventClass, eventDataSize,
-            eventData, eventDataIntegrityChecksum);
+            nextDataTransferHandle, transferFlag, eventClass,
+            eventMessage.data() + offset, maxBufferSize, eventDataSize,
+            eventDataIntegrityChecksum);
         if (rc)
         {
             lg2::error(
@@ -246,6 +236,23 @@ requester::Coroutine
 
         if (completionCode != PLDM_SUCCESS)
         {
+            eventMessage.resize(offset);
+            it = termini.find(tid);
+            if (mergedEventAck && transferOperationFlag == PLDM_GET_FIRSTPART &&
+                eventIdToAcknowledge != 0 && it != termini.end())
+            {
+                // the terminus doesn't take the acknowledgement in
+                // GetFirstPart, acknowledge separately from now on
+                lg2::info(
+                    "TID:{TID} rejected the acknowledgement in GetFirstPart, cc={CC}, use AcknowledgementOnly.",
+                    "TID", tid, "CC", completionCode);
+                mergedEventAck = false;
+                it->second->mergedEventAck = false;
+                transferOperationFlag = PLDM_ACKNOWLEDGEMENT_ONLY;
+                dataTransferHandle = 0;
+                continue;
+            }
+
             lg2::error(
                 "pollForPlatformEventMessage failed. tid={TID} transferOpFlag={OPFLAG} cc={CC}",
                 "TID", tid, "OPFLAG", transferOperationFlag, "CC",
@@ -253,69 +260,95 @@ requester::Coroutine
             co_return completionCode;
         }
 
-        if (eventDataSize > 0)
+        if (mergedEventAck && transferOperationFlag == PLDM_GET_FIRSTPART &&
+            eventIdToAcknowledge != 0 && eventId == eventIdToAcknowledge)
         {
-            eventMessage.insert(eventMessage.end(), eventData.begin(),
-                                eventData.begin() + eventDataSize);
+            // the terminus ignored the acknowledgement in GetFirstPart and
+            // sent the same event again, acknowledge separately from now on
+            lg2::info(
+                "TID:{TID} ignored the acknowledgement of eventId={EVENTID} in GetFirstPart, use AcknowledgementOnly.",
+                "TID", tid, "EVENTID", eventId);
+            eventMessage.resize(offset);
+            mergedEventAck = false;
+            it = termini.find(tid);
+            if (it != termini.end())
+            {
+                it->second->mergedEventAck = false;
+            }
+            transferOperationFlag = PLDM_ACKNOWLEDGEMENT_ONLY;
+            dataTransferHandle = 0;
+            continue;
         }
 
-        if (transferOperationFlag == PLDM_ACKNOWLEDGEMENT_ONLY)
+        eventMessage.resize(offset + eventDataSize);
+        eventMessageChecksum = crc32_update(
+            eventMessageChecksum, eventMessage.data() + offset, eventDataSize);
+        if (eventId == 0xffff)
         {
-            if (eventId == 0xffff)
-            {
-                transferOperationFlag = PLDM_GET_FIRSTPART;
-                dataTransferHandle = 0;
-                eventIdToAcknowledge = 0;
-                eventMessage.clear();
-            }
+            // no event data is returned, start with the next event
+            transferOperationFlag = PLDM_GET_FIRSTPART;
+            dataTransferHandle = 0;
+            eventIdToAcknowledge = 0;
+            eventMessage.clear();
+            eventMessageChecksum = 0;
+            continue;
+        }
+
+        if (eventId == 0 || transferOperationFlag == PLDM_ACKNOWLEDGEMENT_ONLY)
+        {
+            // no more events, or wait for the acknowledgement to complete
+            continue;
+        }
+
+        /*
+         * Check if transferFlag represents either a START or MIDDLE state.
+         * For backward compatibility, handle values from both transfer flag
+         * enums: PLATFORM_EVENT and PLDM. Note: PLATFORM_EVENT_MIDDLE and
+         * PLDM_START both have the value 1.
+         */
+        if (transferFlag == PLATFORM_EVENT_START ||
+            transferFlag == PLATFORM_EVENT_MIDDLE ||
+            transferFlag == PLDM_MIDDLE)
+        {
+            transferOperationFlag = PLDM_GET_NEXTPART;
+            dataTransferHandle = nextDataTransferHandle;
+            eventIdToAcknowledge = 0xffff;
         }
         else
         {
-            /*
-             * Check if transferFlag represents either a START or MIDDLE state.
-             * For backward compatibility, handle values from both transfer flag
-             * enums: PLATFORM_EVENT and PLDM. Note: PLATFORM_EVENT_MIDDLE and
-             * PLDM_START both have the value 1.
-             */
-            if (transferFlag == PLATFORM_EVENT_START ||
-                transferFlag == PLATFORM_EVENT_MIDDLE ||
-                transferFlag == PLDM_MIDDLE)
+            uint8_t platformEventStatus = PLDM_EVENT_NO_LOGGING;
+            if (transferFlag == PLATFORM_EVENT_START_AND_END)
             {
-                transferOperationFlag = PLDM_GET_NEXTPART;
-                dataTransferHandle = nextDataTransferHandle;
-                eventIdToAcknowledge = 0xffff;
+                handlePlatformEvent(eventTid, eventClass, eventMessage.data(),
+                                    eventMessage.size(), platformEventStatus);
             }
-            else
+            else if (transferFlag == PLATFORM_EVENT_END)
             {
-                uint8_t platformEventStatus = PLDM_EVENT_NO_LOGGING;
-                if (transferFlag == PLATFORM_EVENT_START_AND_END)
+                if (eventDataIntegrityChecksum == eventMessageChecksum)
                 {
-                    handlePlatformEvent(
-                        eventTid, eventClass, eventMessage.data(),
-                        eventMessage.size(), platformEventStatus);
+                    handlePlatformEvent(eventTid, eventClass,
+                                        eventMessage.data(),
+                                        eventMessage.size(),
+                                        platformEventStatus);
                 }
-                else if (transferFlag == PLATFORM_EVENT_END)
+                else
                 {
-                    if (eventDataIntegrityChecksum ==
-                        crc32(eventMessage.data(), eventMessage.size()))
-                    {
-                        handlePlatformEvent(
-                            eventTid, eventClass, eventMessage.data(),
-                            eventMessage.size(), platformEventStatus);
-                    }
-                    else
-                    {
-                        lg2::error(
-                            "pollForPlatformEventMessage checksum error, tid={TID} eventId={EVENTID} eventClass={EVENTCLASS} ",
-                            "TID", tid, "EVENTID", eventId, "EVENTCLASS",
-                            eventClass);
-                    }
+                    lg2::error(
+                        "pollForPlatformEventMessage checksum error, tid={TID} eventId={EVENTID} eventClass={EVENTCLASS} ",
+                        "TID", tid, "EVENTID", eventId, "EVENTCLASS",
+                        eventClass);
                 }
-
-                transferOperationFlag = PLDM_ACKNOWLEDGEMENT_ONLY;
-                dataTransferHandle = 0;
-                eventIdToAcknowledge = eventId;
             }
+
+            // Acknowledge the event in the GetFirstPart request of the next
+            // event, so draining the queue costs one exchange per event
+            // part instead of an extra AcknowledgementOnly per event.
+            transferOperationFlag = mergedEventAck ? PLDM_GET_FIRSTPART
+                                                   : PLDM_ACKNOWLEDGEMENT_ONLY;
+            dataTransferHandle = 0;
+            eventIdToAcknowledge = eventId;
+            eventMessage.clear();
+            eventMessageChecksum = 0;
         }
     }
 
@@ -326,8 +359,8 @@ requester::Coroutine EventManager::pollForPlatformEventMessage(
     tid_t tid, uint8_t transferOperationFlag, uint32_t dataTransferHandle,
     uint16_t eventIdToAcknowledge, uint8_t& completionCode, uint8_t& eventTid,
     uint16_t& eventId, uint32_t& nextDataTransferHandle, uint8_t& transferFlag,
-    uint8_t& eventClass, uint32_t& eventDataSize,
-    std::vector<uint8_t>& eventData, uint32_t& eventDataIntegrityChecksum)
+    uint8_t& eventClass, uint8_t* eventData, size_t eventDataLength,
+    uint32_t& eventDataSize, uint32_t& eventDataIntegrityChecksum)
 {
     Request request(sizeof(pldm_msg_hdr) +
                     PLDM_POLL_FOR_PLATFORM_EVENT_MESSAGE_REQ_BYTES);
@@ -352,10 +385,32 @@ requester::Coroutine EventManager::pollForPlatformEventMessage(
         co_return rc;
     }
 
+    // the event data of the response is decoded into eventData directly,
+    // only an END part carries the integrity checksum after it
+    size_t maxResponseLen =
+        PLDM_POLL_FOR_PLATFORM_EVENT_MESSAGE_MIN_RESP_BYTES + eventDataLength;
+    if (responseLen > maxResponseLen)
+    {
+        auto response = reinterpret_cast<
+            const pldm_poll_for_platform_event_message_resp*>(
+            responseMsg->payload);
+        if (response->transfer_flag == PLATFORM_EVENT_END)
+        {
+            maxResponseLen += sizeof(uint32_t);
+        }
+    }
+    if (responseLen > maxResponseLen)
+    {
+        lg2::error(
+            "pollForPlatformEventMessage response is too long. tid={TID} responseLen={RLEN}",
+            "TID", tid, "RLEN", responseLen);
+        co_return PLDM_ERROR_INVALID_LENGTH;
+    }
+
     rc = decode_poll_for_platform_event_message_resp(
         responseMsg, responseLen, &completionCode, &eventTid, &eventId,
         &nextDataTransferHandle, &transferFlag, &eventClass, &eventDataSize,
-        eventData.data(), &eventDataIntegrityChecksum);
+        eventData, &eventDataIntegrityChecksum);
     if (rc)
     {
         lg2::error(
@@ -474,9 +529,15 @@ void EventManager::processNumericSensorEvent(tid_t tid, uint16_t sensorId,
     uint8_t previousEventState = 0;
     uint8_t sensorDataSize = 0;
     uint32_t presentReading;
-    decode_numeric_sensor_data(sensorData, sensorDataLength, &eventState,
-                               &previousEventState, &sensorDataSize,
-                               &presentReading);
+    auto rc = decode_numeric_sensor_data(sensorData, sensorDataLength,
+                                         &eventState, &previousEventState,
+                                         &sensorDataSize, &presentReading);
+    if (rc != PLDM_SUCCESS)
+    {
+        lg2::error("failed to decode received numeric sensor event,sid={SID}.",
+                   "SID", sensorId);
+        return;
+    }
 
     for (auto& [terminusId, terminus] : termini)
     {
@@ -549,6 +610,18 @@ void EventManager::processNumericSensorEvent(tid_t tid, uint16_t sensorId,
                 messageId, sensor->getSensorName(),
                 sensor->unitModifier(sensor->conversionFormula(reading)),
                 threshold);
+
+            // the event carries a fresh reading, the sensor is not polled
+            // again until its next deadline
+            if (!std::isnan(reading))
+            {
+                uint64_t now = 0;
+                sd_event_now(sdeventplus::Event::get_default().get(),
+                             CLOCK_MONOTONIC, &now);
+                sensor->updateReading(true, true, reading);
+                sensor->setLastUpdatedTimeStamp(now);
+                sensor->setRefreshed(true);
+            }
         }
     }
 }
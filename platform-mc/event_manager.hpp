@@ -20,6 +20,7 @@
 #include "libpldm/requester/pldm.h"
 
 #include "common/types.hpp"
+#include "cper_writer.hpp"
 #include "numeric_sensor.hpp"
 #include "pldmd/dbus_impl_requester.hpp"
 #include "requester/handler.hpp"
@@ -93,9 +94,12 @@ class EventManager
     std::string getSensorThresholdMessageId(uint8_t previousEventState,
                                             uint8_t eventState);
 
-    /** @brief A Coroutine to poll all events from terminus
+    /** @brief A Coroutine to poll all events from terminus, each event is
+     *         acknowledged in the request fetching the next one unless the
+     *         terminus rejects it
      *
-     *  @param[in] dstTid - the destination TID
+     *  @param[in] tid - the destination TID
+     *  @param[in] maxBufferSize - the negotiated buffer size of terminus
      */
     requester::Coroutine pollForPlatformEventTask(tid_t tid,
                                                   uint16_t maxBufferSize);
@@ -113,8 +117,9 @@ class EventManager
      *  @param[out] nextDataTransferHandle
      *  @param[out] transferFlag
      *  @param[out] eventClass
+     *  @param[out] eventData - buffer the event data is decoded into
+     *  @param[in] eventDataLength - size of the eventData buffer
      *  @param[out] eventDataSize
-     *  @param[out] eventData
      *  @param[out] eventDataIntegrityChecksum
      *  @return coroutine return_value - PLDM completion code
      *
@@ -123,8 +128,9 @@ class EventManager
         tid_t tid, uint8_t transferOperationFlag, uint32_t dataTransferHandle,
         uint16_t eventIdToAcknowledge, uint8_t& completionCode,
         uint8_t& eventTid, uint16_t& eventId, uint32_t& nextDataTransferHandle,
-        uint8_t& transferFlag, uint8_t& eventClass, uint32_t& eventDataSize,
-        std::vector<uint8_t>& eventData, uint32_t& eventDataIntegrityChecksum);
+        uint8_t& transferFlag, uint8_t& eventClass, uint8_t* eventData,
+        size_t eventDataLength, uint32_t& eventDataSize,
+        uint32_t& eventDataIntegrityChecksum);
 
     void notifyCPERLogger(const std::string& dataPath);
 
@@ -153,6 +159,9 @@ class EventManager
 
     /** @brief verbose tracing flag */
     bool verbose;
+
+    /** @brief Writer of the CPER files, created on the first CPER event */
+    std::unique_ptr<CperWriter> cperWriter;
 };
 } // namespace platform_mc
 } // namespace pldm
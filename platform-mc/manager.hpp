@@ -58,7 +58,11 @@ class Manager : public pldm::MctpDiscoveryHandlerIntf
         fwUpdateManager(fwUpdateManager),
         terminusManager(event, handler, requester, termini, LOCAL_EID_OVER_I2C,
                         this, numericSensorsWithoutAuxName),
+#ifdef PDR_CACHE_DIR
+        platformManager(terminusManager, termini, PDR_CACHE_DIR),
+#else
         platformManager(terminusManager, termini),
+#endif
         sensorManager(event, terminusManager, termini, this, verbose),
         eventManager(terminusManager, termini, fwUpdateManager, verbose),
         verbose(verbose)
@@ -69,9 +73,9 @@ class Manager : public pldm::MctpDiscoveryHandlerIntf
         co_return PLDM_SUCCESS;
     }
 
-    requester::Coroutine afterDiscoverTerminus()
+    requester::Coroutine initTerminus(tid_t tid)
     {
-        auto rc = co_await platformManager.initTerminus();
+        auto rc = co_await platformManager.initTerminus(tid);
         co_return rc;
     }
 
@@ -107,6 +111,11 @@ class Manager : public pldm::MctpDiscoveryHandlerIntf
         sensorManager.startPolling();
     }
 
+    void startSensorPolling(tid_t tid)
+    {
+        sensorManager.startPolling(tid);
+    }
+
     void stopSensorPolling()
     {
         sensorManager.stopPolling();
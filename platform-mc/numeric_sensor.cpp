@@ -23,6 +23,7 @@
 #include <phosphor-logging/lg2.hpp>
 #include <tal.hpp>
 
+#include <cmath>
 #include <limits>
 #include <regex>
 
@@ -331,6 +332,16 @@ NumericSensor::NumericSensor(const tid_t tid, const bool sensorDisabled,
     offset = pdr->offset;
     baseUnitModifier = pdr->unit_modifier;
 
+    // a reading change within the tolerance of the sensor is noise
+    deadband = unitModifier(
+        std::abs(std::isnan(resolution) ? 1 : resolution) *
+        std::max(pdr->plus_tolerance, pdr->minus_tolerance));
+
+    // the terminus sends numeric sensor events on threshold crossings, a
+    // sensor without thresholds never generates one
+    eventGeneration = pdr->sensor_init != PLDM_SENSOR_DISABLE &&
+                      pdr->supported_thresholds.byte != 0;
+
     updateTime = std::numeric_limits<uint64_t>::max();
     if (!std::isnan(pdr->update_interval))
     {
@@ -506,6 +517,8 @@ NumericSensor::NumericSensor(
     resolution = 1;
     offset = 0;
     baseUnitModifier = pdr->unit_modifier;
+    deadband = unitModifier(
+        std::max(pdr->plus_tolerance, pdr->minus_tolerance));
 
     updateTime = std::numeric_limits<uint64_t>::max();
     if (!std::isnan(pdr->update_interval))
@@ -563,23 +576,45 @@ void NumericSensor::updateReading(bool available, bool functional, double value)
                    "NEW", functional);
 
     rawValue = value;
-    availabilityIntf->available(available);
-    operationalStatusIntf->functional(functional);
+
+    // the properties are signalled by the coalescer when it is set
+    bool skipSignal = coalescer != nullptr;
+    bool statusChanged = false;
+    if (available != availabilityIntf->available())
+    {
+        availabilityIntf->available(available, skipSignal);
+        propertyChanged(availabilityIntf->interface, "Available");
+        statusChanged = true;
+    }
+    if (functional != operationalStatusIntf->functional())
+    {
+        operationalStatusIntf->functional(functional, skipSignal);
+        propertyChanged(operationalStatusIntf->interface, "Functional");
+        statusChanged = true;
+    }
 
     if (!valueIntf)
     {
         return;
     }
 
+    double newValue = std::numeric_limits<double>::quiet_NaN();
     if (functional && available)
     {
-        valueIntf->value(unitModifier(conversionFormula(value)));
-        updateThresholds();
+        newValue = unitModifier(conversionFormula(value));
+        updateThresholds(newValue);
     }
-    else
+    reading = newValue;
+
+    // the reading within the deadband is neither published nor pushed to
+    // the telemetry
+    if (!statusChanged && !exceedsDeadband(newValue))
     {
-        valueIntf->value(std::numeric_limits<double>::quiet_NaN());
+        return;
     }
+    hasReading = true;
+    valueIntf->value(newValue, skipSignal);
+    propertyChanged(valueIntf->interface, "Value");
 
     std::string propertyName = "Value";
     std::string objPath = path;
@@ -612,6 +647,131 @@ void NumericSensor::updateReading(bool available, bool functional, double value)
     }
 }
 
+bool NumericSensor::exceedsDeadband(double value)
+{
+    if (!hasReading)
+    {
+        return true;
+    }
+
+    auto lastValue = valueIntf->value();
+    if (std::isnan(value) || std::isnan(lastValue))
+    {
+        return std::isnan(value) != std::isnan(lastValue);
+    }
+    return std::abs(value - lastValue) > deadband;
+}
+
+void NumericSensor::propertyChanged(const std::string& interface,
+                                    const std::string& property)
+{
+    if (coalescer)
+    {
+        coalescer->add(tid, path, interface, property);
+    }
+}
+
+void NumericSensor::updatePollingInterval(const uint64_t currentTimestampInUsec)
+{
+    auto previousReading = lastReading;
+    auto previousTimeInUsec = lastReadingTimeInUsec;
+    lastReading = reading;
+    lastReadingTimeInUsec = currentTimestampInUsec;
+
+    adaptiveIntervalInUsec = 0;
+    if (!minAdaptiveIntervalInUsec || eventPrimary ||
+        updateTime == std::numeric_limits<uint64_t>::max())
+    {
+        return;
+    }
+
+    auto intervalInUsec = getPollingInterval();
+    auto maxIntervalInUsec = std::max(intervalInUsec, refreshLimitInUsec);
+    auto minIntervalInUsec = std::min(minAdaptiveIntervalInUsec,
+                                      intervalInUsec);
+    if (std::isnan(reading) || std::isnan(previousReading) ||
+        currentTimestampInUsec <= previousTimeInUsec)
+    {
+        return;
+    }
+    auto lastIntervalInUsec = currentTimestampInUsec - previousTimeInUsec;
+
+    auto change = reading - previousReading;
+    if (std::abs(change) <= std::max(hysteresis, deadband))
+    {
+        // a stable reading backs off, unless a threshold is asserted
+        adaptiveIntervalInUsec =
+            alarmAsserted() ? intervalInUsec
+                            : std::min(std::max(lastIntervalInUsec * 2,
+                                                intervalInUsec),
+                                       maxIntervalInUsec);
+        return;
+    }
+
+    auto margin = thresholdMargin(change > 0);
+    if (std::isnan(margin))
+    {
+        return;
+    }
+
+    // read the sensor a few times before it reaches the threshold at the
+    // current rate of change
+    constexpr double readingsBeforeThreshold = 4;
+    auto timeToThresholdInUsec = margin / std::abs(change) *
+                                 lastIntervalInUsec;
+    adaptiveIntervalInUsec = static_cast<uint64_t>(
+        std::clamp(timeToThresholdInUsec / readingsBeforeThreshold,
+                   static_cast<double>(minIntervalInUsec),
+                   static_cast<double>(intervalInUsec)));
+}
+
+bool NumericSensor::alarmAsserted()
+{
+    return (thresholdWarningIntf &&
+            (thresholdWarningIntf->warningAlarmHigh() ||
+             thresholdWarningIntf->warningAlarmLow())) ||
+           (thresholdCriticalIntf &&
+            (thresholdCriticalIntf->criticalAlarmHigh() ||
+             thresholdCriticalIntf->criticalAlarmLow())) ||
+           (thresholdFatalIntf &&
+            (thresholdFatalIntf->hardShutdownAlarmHigh() ||
+             thresholdFatalIntf->hardShutdownAlarmLow()));
+}
+
+double NumericSensor::thresholdMargin(bool rising)
+{
+    std::vector<double> thresholds;
+    if (thresholdWarningIntf)
+    {
+        thresholds.emplace_back(rising ? thresholdWarningIntf->warningHigh()
+                                       : thresholdWarningIntf->warningLow());
+    }
+    if (thresholdCriticalIntf)
+    {
+        thresholds.emplace_back(rising
+                                    ? thresholdCriticalIntf->criticalHigh()
+                                    : thresholdCriticalIntf->criticalLow());
+    }
+    if (thresholdFatalIntf)
+    {
+        thresholds.emplace_back(rising
+                                    ? thresholdFatalIntf->hardShutdownHigh()
+                                    : thresholdFatalIntf->hardShutdownLow());
+    }
+
+    auto margin = std::numeric_limits<double>::quiet_NaN();
+    for (auto threshold : thresholds)
+    {
+        auto distance = rising ? threshold - reading : reading - threshold;
+        // NaN thresholds and the crossed ones are skipped
+        if (distance > 0 && (std::isnan(margin) || distance < margin))
+        {
+            margin = distance;
+        }
+    }
+    return margin;
+}
+
 void NumericSensor::handleErrGetSensorReading()
 {
     updateReading(true, false, std::numeric_limits<double>::quiet_NaN());
@@ -645,9 +805,11 @@ bool NumericSensor::checkThreshold(bool alarm, bool direction, double value,
     return alarm;
 }
 
-void NumericSensor::updateThresholds()
+void NumericSensor::updateThresholds(double value)
 {
-    auto value = getReading();
+    // the alarm properties are signalled by the coalescer when it is set,
+    // the alarm asserted and deasserted signals are emitted right away
+    bool skipSignal = coalescer != nullptr;
 
     if (thresholdWarningIntf &&
         !std::isnan(thresholdWarningIntf->warningHigh()))
@@ -658,7 +820,9 @@ void NumericSensor::updateThresholds()
             checkThreshold(alarm, true, value, threshold, hysteresis);
         if (alarm != newAlarm)
         {
-            thresholdWarningIntf->warningAlarmHigh(newAlarm);
+            thresholdWarningIntf->warningAlarmHigh(newAlarm, skipSignal);
+            propertyChanged(thresholdWarningIntf->interface,
+                            "WarningAlarmHigh");
             if (newAlarm)
             {
                 thresholdWarningIntf->warningHighAlarmAsserted(value);
@@ -678,7 +842,8 @@ void NumericSensor::updateThresholds()
             checkThreshold(alarm, false, value, threshold, hysteresis);
         if (alarm != newAlarm)
         {
-            thresholdWarningIntf->warningAlarmLow(newAlarm);
+            thresholdWarningIntf->warningAlarmLow(newAlarm, skipSignal);
+            propertyChanged(thresholdWarningIntf->interface, "WarningAlarmLow");
             if (newAlarm)
             {
                 thresholdWarningIntf->warningLowAlarmAsserted(value);
@@ -699,7 +864,9 @@ void NumericSensor::updateThresholds()
             checkThreshold(alarm, true, value, threshold, hysteresis);
         if (alarm != newAlarm)
         {
-            thresholdCriticalIntf->criticalAlarmHigh(newAlarm);
+            thresholdCriticalIntf->criticalAlarmHigh(newAlarm, skipSignal);
+            propertyChanged(thresholdCriticalIntf->interface,
+                            "CriticalAlarmHigh");
             if (newAlarm)
             {
                 thresholdCriticalIntf->criticalHighAlarmAsserted(value);
@@ -720,7 +887,9 @@ void NumericSensor::updateThresholds()
             checkThreshold(alarm, false, value, threshold, hysteresis);
         if (alarm != newAlarm)
         {
-            thresholdCriticalIntf->criticalAlarmLow(newAlarm);
+            thresholdCriticalIntf->criticalAlarmLow(newAlarm, skipSignal);
+            propertyChanged(thresholdCriticalIntf->interface,
+                            "CriticalAlarmLow");
             if (newAlarm)
             {
                 thresholdCriticalIntf->criticalLowAlarmAsserted(value);
@@ -741,7 +910,9 @@ void NumericSensor::updateThresholds()
             checkThreshold(alarm, true, value, threshold, hysteresis);
         if (alarm != newAlarm)
         {
-            thresholdFatalIntf->hardShutdownAlarmHigh(newAlarm);
+            thresholdFatalIntf->hardShutdownAlarmHigh(newAlarm, skipSignal);
+            propertyChanged(thresholdFatalIntf->interface,
+                            "HardShutdownAlarmHigh");
             if (newAlarm)
             {
                 thresholdFatalIntf->hardShutdownHighAlarmAsserted(value);
@@ -762,7 +933,9 @@ void NumericSensor::updateThresholds()
             checkThreshold(alarm, false, value, threshold, hysteresis);
         if (alarm != newAlarm)
         {
-            thresholdFatalIntf->hardShutdownAlarmLow(newAlarm);
+            thresholdFatalIntf->hardShutdownAlarmLow(newAlarm, skipSignal);
+            propertyChanged(thresholdFatalIntf->interface,
+                            "HardShutdownAlarmLow");
             if (newAlarm)
             {
                 thresholdFatalIntf->hardShutdownLowAlarmAsserted(value);
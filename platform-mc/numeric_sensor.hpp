@@ -26,6 +26,7 @@
 
 #include "common/types.hpp"
 #include "platform-mc/oem_base.hpp"
+#include "platform-mc/properties_coalescer.hpp"
 
 #include <sdbusplus/server/object.hpp>
 #include <xyz/openbmc_project/Association/Definitions/server.hpp>
@@ -37,6 +38,9 @@
 #include <xyz/openbmc_project/State/Decorator/Availability/server.hpp>
 #include <xyz/openbmc_project/State/Decorator/OperationalStatus/server.hpp>
 
+#include <algorithm>
+#include <limits>
+
 namespace pldm
 {
 namespace platform_mc
@@ -78,6 +82,52 @@ enum polling_method_indicator
     POLLING_METHOD_INDICATOR_PLDM_TYPE_OEM
 };
 
+/** @struct PollingStatistics
+ *
+ *  Tracks how late a sensor is read compared to the deadline derived from its
+ *  update interval, so the sensors which miss their deadlines can be found.
+ */
+struct PollingStatistics
+{
+    /** @brief staleness of the latest reading in usec */
+    uint64_t lastStalenessInUsec = 0;
+
+    /** @brief worst staleness seen since the sensor was created in usec */
+    uint64_t maxStalenessInUsec = 0;
+
+    /** @brief number of readings later than the staleness limit */
+    uint64_t missedDeadlines = 0;
+
+    /** @brief Record the staleness of a reading
+     *
+     *  @param[in] stalenessInUsec - time elapsed past the sensor deadline
+     *  @param[in] limitInUsec - staleness above which the deadline is missed
+     *  @return bool - true if the deadline is missed
+     */
+    bool update(uint64_t stalenessInUsec, uint64_t limitInUsec)
+    {
+        lastStalenessInUsec = stalenessInUsec;
+        maxStalenessInUsec = std::max(maxStalenessInUsec, stalenessInUsec);
+        if (stalenessInUsec > limitInUsec)
+        {
+            missedDeadlines++;
+            return true;
+        }
+        return false;
+    }
+
+    /** @brief Check if the missed deadlines are to be reported, on the
+     *         first miss and then each time the count doubles so a sensor
+     *         which keeps missing does not flood the log
+     *
+     *  @return bool - true if the count of missed deadlines is to be logged
+     */
+    bool reportMissed() const
+    {
+        return missedDeadlines && !(missedDeadlines & (missedDeadlines - 1));
+    }
+};
+
 /**
  * @brief NumericSensor
  *
@@ -291,6 +341,17 @@ class NumericSensor
     /** @brief indicate if sensor is polled in priority */
     bool isPriority;
 
+    /** @brief indicate the PDR lets the sensor generate threshold events */
+    bool eventGeneration = false;
+
+    /** @brief indicate the readings come from sensor events, the sensor is
+     * polled only at heartbeatInUsec to catch a drift */
+    bool eventPrimary = false;
+
+    /** @brief  The heartbeat polling interval of event-primary sensor in
+     * usec */
+    uint64_t heartbeatInUsec = 0;
+
     void removeValueIntf();
 
     void setRefreshed(bool r)
@@ -304,14 +365,46 @@ class NumericSensor
     }
 
     /** @brief  The time since last getSensorReading command in usec */
-    uint64_t lastUpdatedTimeStampInUsec;
+    uint64_t lastUpdatedTimeStampInUsec = 0;
 
     /** @brief  The refresh limit in usec */
     uint64_t refreshLimitInUsec = DEFAULT_RR_REFRESH_LIMIT_IN_MS * 1000;
 
+    /** @brief  Staleness of the sensor readings */
+    PollingStatistics pollingStatistics;
+
+    /** @brief  The shortest polling interval in usec of the sensor trending
+     * toward a threshold, the polling interval is static if it is 0 */
+    uint64_t minAdaptiveIntervalInUsec = 0;
+
     inline void setLastUpdatedTimeStamp(const uint64_t currentTimestampInUsec)
     {
         lastUpdatedTimeStampInUsec = currentTimestampInUsec;
+        updatePollingInterval(currentTimestampInUsec);
+    }
+
+    /** @brief Adapt the polling interval to the rate of change of the
+     * readings. A stable sensor backs off toward the refresh limit, a sensor
+     * trending toward a threshold is polled sooner, down to
+     * minAdaptiveIntervalInUsec.
+     *
+     *  @param[in] currentTimestampInUsec - the time of the latest reading
+     */
+    void updatePollingInterval(const uint64_t currentTimestampInUsec);
+
+    /** @brief The polling interval of the sensor in usec
+     *
+     *  @return uint64_t - the adapted interval, or the static one derived
+     *                     from the PDR and the refresh limit
+     */
+    inline uint64_t getPollingInterval()
+    {
+        if (adaptiveIntervalInUsec)
+        {
+            return adaptiveIntervalInUsec;
+        }
+        return isPriority ? updateTime
+                          : std::max(updateTime, refreshLimitInUsec);
     }
 
     inline bool needsUpdate(const uint64_t currentTimestampInUsec)
@@ -322,6 +415,16 @@ class NumericSensor
         }
         const uint64_t deltaInUsec =
             currentTimestampInUsec - lastUpdatedTimeStampInUsec;
+        if (eventPrimary)
+        {
+            return deltaInUsec >= heartbeatInUsec;
+        }
+
+        if (adaptiveIntervalInUsec)
+        {
+            return deltaInUsec >= adaptiveIntervalInUsec;
+        }
+
         if (updateTime > deltaInUsec)
         {
             return false;
@@ -332,6 +435,28 @@ class NumericSensor
             || (deltaInUsec > refreshLimitInUsec));
     }
 
+    /** @brief The time at which the sensor is due for update in usec, used to
+     *         order the sensors polled in a round
+     */
+    inline uint64_t getDeadline()
+    {
+        if (eventPrimary)
+        {
+            return lastUpdatedTimeStampInUsec + heartbeatInUsec;
+        }
+
+        if (updateTime == std::numeric_limits<uint64_t>::max())
+        {
+            return std::numeric_limits<uint64_t>::max();
+        }
+
+        return lastUpdatedTimeStampInUsec + getPollingInterval();
+    }
+
+    /** @brief  The coalescer of the PropertiesChanged signals, the signals
+     * are emitted right away when it is not set */
+    std::shared_ptr<PropertiesChangedCoalescer> coalescer = nullptr;
+
     /** @brief  A container to store OemIntf, it allows us to add additional OEM
      * sdbusplus object as extra attribute */
     std::vector<std::shared_ptr<platform_mc::OemIntf>> oemIntfs;
@@ -351,8 +476,55 @@ class NumericSensor
     /**
      * @brief Check sensor reading if any threshold has been crossed and update
      * Threshold interfaces accordingly
+     *
+     *  @param[in] value - the sensor reading in Units
+     */
+    void updateThresholds(double value);
+
+    /** @brief Check if the reading is to be published to D-Bus, a change
+     * within the deadband of the last published reading is not
+     *
+     *  @param[in] value - the sensor reading in Units
+     *  @return bool - true if the reading is to be published
      */
-    void updateThresholds();
+    bool exceedsDeadband(double value);
+
+    /** @brief Record the changed property to the coalescer
+     *
+     *  @param[in] interface - interface of the property
+     *  @param[in] property - property name
+     */
+    void propertyChanged(const std::string& interface,
+                         const std::string& property);
+
+    /** @brief The change of reading in Units below which the reading is not
+     * published, derived from the resolution and tolerance in PDR */
+    double deadband = 0;
+
+    /** @brief indicate a reading has been published to D-Bus */
+    bool hasReading = false;
+
+    /** @brief Check if any threshold alarm of the sensor is asserted */
+    bool alarmAsserted();
+
+    /** @brief The distance from the reading to the nearest threshold not yet
+     * crossed in the direction of the trend
+     *
+     *  @param[in] rising - the reading is rising
+     *  @return double - the distance in Units, NaN if there is no threshold
+     */
+    double thresholdMargin(bool rising);
+
+    /** @brief The latest sensor reading in Units, NaN if failed */
+    double reading = std::numeric_limits<double>::quiet_NaN();
+
+    /** @brief The reading and its time in usec the polling interval was last
+     * adapted with */
+    double lastReading = std::numeric_limits<double>::quiet_NaN();
+    uint64_t lastReadingTimeInUsec = 0;
+
+    /** @brief The adapted polling interval in usec, 0 if not adapted */
+    uint64_t adaptiveIntervalInUsec = 0;
 
     /** @brief Amount of hysteresis associated with the sensor thresholds */
     double hysteresis{};
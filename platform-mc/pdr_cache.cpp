@@ -0,0 +1,316 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "pdr_cache.hpp"
+
+#include "libpldm/utils.h"
+
+#include "common/utils.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+PHOSPHOR_LOG2_USING;
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+namespace
+{
+
+/* File layout, all integers are little endian:
+ *   magic(4) version(1) updateTime(13) oemUpdateTime(13) recordCount(4)
+ *   repositorySize(4) largestRecordSize(4) numberOfPDRs(4)
+ *   { pdrSize(4) pdr(pdrSize) } * numberOfPDRs
+ *   crc32(4) of all the preceding bytes
+ */
+constexpr uint32_t cacheMagic = 0x43524450; // "PDRC"
+constexpr uint8_t cacheVersion = 1;
+constexpr size_t cacheHeaderSize = 4 + 1 + 2 * PLDM_TIMESTAMP104_SIZE + 4 * 4;
+
+void appendLE32(std::vector<uint8_t>& buffer, uint32_t value)
+{
+    for (size_t i = 0; i < sizeof(value); i++)
+    {
+        buffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+uint32_t readLE32(const uint8_t* data)
+{
+    return static_cast<uint32_t>(data[0]) |
+           (static_cast<uint32_t>(data[1]) << 8) |
+           (static_cast<uint32_t>(data[2]) << 16) |
+           (static_cast<uint32_t>(data[3]) << 24);
+}
+
+/** @brief Write the data to the file and flush it to the storage
+ *
+ *  @param[in] path - file to be created or truncated
+ *  @param[in] data - file content
+ *  @return true if the data reached the storage
+ */
+bool writeFileSync(const std::filesystem::path& path,
+                   const std::vector<uint8_t>& data)
+{
+    pldm::utils::CustomFD fd(
+        open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644));
+    if (fd() < 0)
+    {
+        lg2::error("Failed to create PDR cache file {PATH}, {ERROR}.", "PATH",
+                   path.string(), "ERROR", std::strerror(errno));
+        return false;
+    }
+
+    size_t offset = 0;
+    while (offset < data.size())
+    {
+        auto written = write(fd(), data.data() + offset, data.size() - offset);
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (written <= 0)
+        {
+            lg2::error("Failed to write PDR cache file {PATH}, {ERROR}.",
+                       "PATH", path.string(), "ERROR", std::strerror(errno));
+            return false;
+        }
+        offset += written;
+    }
+
+    if (fsync(fd()) < 0)
+    {
+        lg2::error("Failed to sync PDR cache file {PATH}, {ERROR}.", "PATH",
+                   path.string(), "ERROR", std::strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+bool PDRRepositorySignature::hasUpdateTime() const
+{
+    auto isSet = [](uint8_t byte) { return byte != 0; };
+    return std::any_of(updateTime.begin(), updateTime.end(), isSet) ||
+           std::any_of(oemUpdateTime.begin(), oemUpdateTime.end(), isSet);
+}
+
+std::optional<std::filesystem::path>
+    PDRCache::cacheFile(const UUID& uuid) const
+{
+    if (cacheDir.empty() || uuid.empty())
+    {
+        return std::nullopt;
+    }
+
+    // UUID is reported by terminus, only keep the characters of a UUID string
+    std::string name;
+    std::copy_if(uuid.begin(), uuid.end(), std::back_inserter(name),
+                 [](char c) {
+        return std::isxdigit(static_cast<unsigned char>(c)) || c == '-';
+    });
+    if (name.empty())
+    {
+        return std::nullopt;
+    }
+    return cacheDir / name;
+}
+
+std::optional<std::vector<std::vector<uint8_t>>>
+    PDRCache::load(const UUID& uuid,
+                   const PDRRepositorySignature& signature) const
+{
+    auto path = cacheFile(uuid);
+    if (!path || !signature.hasUpdateTime())
+    {
+        return std::nullopt;
+    }
+
+    std::error_code ec;
+    auto fileSize = std::filesystem::file_size(*path, ec);
+    if (ec || fileSize < cacheHeaderSize + 4 + 4)
+    {
+        return std::nullopt;
+    }
+
+    std::vector<uint8_t> buffer(fileSize);
+    std::ifstream stream(*path, std::ios::in | std::ios::binary);
+    if (!stream.read(reinterpret_cast<char*>(buffer.data()), buffer.size()))
+    {
+        return std::nullopt;
+    }
+
+    auto crcOffset = buffer.size() - 4;
+    if (crc32(buffer.data(), crcOffset) != readLE32(buffer.data() + crcOffset))
+    {
+        lg2::error("PDR cache file {PATH} is corrupted.", "PATH",
+                   path->string());
+        return std::nullopt;
+    }
+
+    const uint8_t* ptr = buffer.data();
+    if (readLE32(ptr) != cacheMagic || ptr[4] != cacheVersion)
+    {
+        return std::nullopt;
+    }
+    ptr += 5;
+
+    PDRRepositorySignature cached;
+    std::copy_n(ptr, PLDM_TIMESTAMP104_SIZE, cached.updateTime.begin());
+    ptr += PLDM_TIMESTAMP104_SIZE;
+    std::copy_n(ptr, PLDM_TIMESTAMP104_SIZE, cached.oemUpdateTime.begin());
+    ptr += PLDM_TIMESTAMP104_SIZE;
+    cached.recordCount = readLE32(ptr);
+    cached.repositorySize = readLE32(ptr + 4);
+    cached.largestRecordSize = readLE32(ptr + 8);
+    auto numberOfPDRs = readLE32(ptr + 12);
+    ptr += 16;
+    if (cached != signature)
+    {
+        return std::nullopt;
+    }
+
+    const uint8_t* end = buffer.data() + crcOffset;
+    std::vector<std::vector<uint8_t>> pdrs;
+    pdrs.reserve(std::min<size_t>(numberOfPDRs, signature.recordCount));
+    for (uint32_t i = 0; i < numberOfPDRs; i++)
+    {
+        if (end - ptr < 4)
+        {
+            return std::nullopt;
+        }
+        auto pdrSize = readLE32(ptr);
+        ptr += 4;
+        if (static_cast<size_t>(end - ptr) < pdrSize)
+        {
+            return std::nullopt;
+        }
+        pdrs.emplace_back(ptr, ptr + pdrSize);
+        ptr += pdrSize;
+    }
+    if (ptr != end)
+    {
+        return std::nullopt;
+    }
+
+    return pdrs;
+}
+
+bool PDRCache::store(const UUID& uuid, const PDRRepositorySignature& signature,
+                     const std::vector<std::vector<uint8_t>>& pdrs) const
+{
+    auto path = cacheFile(uuid);
+    if (!path)
+    {
+        return false;
+    }
+    if (!signature.hasUpdateTime())
+    {
+        remove(uuid);
+        return false;
+    }
+
+    size_t size = cacheHeaderSize + 4;
+    for (const auto& pdr : pdrs)
+    {
+        size += 4 + pdr.size();
+    }
+
+    std::vector<uint8_t> buffer;
+    buffer.reserve(size);
+    appendLE32(buffer, cacheMagic);
+    buffer.push_back(cacheVersion);
+    buffer.insert(buffer.end(), signature.updateTime.begin(),
+                  signature.updateTime.end());
+    buffer.insert(buffer.end(), signature.oemUpdateTime.begin(),
+                  signature.oemUpdateTime.end());
+    appendLE32(buffer, signature.recordCount);
+    appendLE32(buffer, signature.repositorySize);
+    appendLE32(buffer, signature.largestRecordSize);
+    appendLE32(buffer, static_cast<uint32_t>(pdrs.size()));
+    for (const auto& pdr : pdrs)
+    {
+        appendLE32(buffer, static_cast<uint32_t>(pdr.size()));
+        buffer.insert(buffer.end(), pdr.begin(), pdr.end());
+    }
+    appendLE32(buffer, crc32(buffer.data(), buffer.size()));
+
+    std::error_code ec;
+    std::filesystem::create_directories(cacheDir, ec);
+    if (ec)
+    {
+        lg2::error("Failed to create PDR cache directory {PATH}, {ERROR}.",
+                   "PATH", cacheDir.string(), "ERROR", ec.message());
+        return false;
+    }
+
+    // write and sync a temporary file first, then rename it over the cache
+    // file, so a power loss leaves either the old or the new cache file
+    auto tmpPath = *path;
+    tmpPath += ".tmp";
+    if (!writeFileSync(tmpPath, buffer))
+    {
+        std::filesystem::remove(tmpPath, ec);
+        return false;
+    }
+
+    std::filesystem::rename(tmpPath, *path, ec);
+    if (ec)
+    {
+        lg2::error("Failed to rename PDR cache file {PATH}, {ERROR}.", "PATH",
+                   tmpPath.string(), "ERROR", ec.message());
+        std::filesystem::remove(tmpPath, ec);
+        return false;
+    }
+
+    // persist the rename
+    pldm::utils::CustomFD dirFd(
+        open(cacheDir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+    if (dirFd() < 0 || fsync(dirFd()) < 0)
+    {
+        lg2::error("Failed to sync PDR cache directory {PATH}, {ERROR}.",
+                   "PATH", cacheDir.string(), "ERROR", std::strerror(errno));
+    }
+    return true;
+}
+
+void PDRCache::remove(const UUID& uuid) const
+{
+    auto path = cacheFile(uuid);
+    if (!path)
+    {
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(*path, ec);
+}
+
+} // namespace platform_mc
+} // namespace pldm
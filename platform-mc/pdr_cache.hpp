@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "libpldm/platform.h"
+
+#include "common/types.hpp"
+
+#include <array>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+/** @struct PDRRepositorySignature
+ *
+ *  The fields of the GetPDRRepositoryInfo response which identify the content
+ *  of a terminus PDR repository. The repository is expected to be unchanged
+ *  as long as all of them are the same.
+ */
+struct PDRRepositorySignature
+{
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> updateTime{};
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> oemUpdateTime{};
+    uint32_t recordCount = 0;
+    uint32_t repositorySize = 0;
+    uint32_t largestRecordSize = 0;
+
+    bool operator==(const PDRRepositorySignature&) const = default;
+
+    /** @brief Check if the terminus reported the time of the last repository
+     *         update, a signature without it can not tell a changed
+     *         repository of the same size apart
+     */
+    bool hasUpdateTime() const;
+};
+
+/**
+ * @brief PDRCache
+ *
+ * PDRCache keeps the raw PDRs fetched from a terminus on the disk, one file
+ * per terminus UUID, so they don't have to be fetched again on the next
+ * discovery when the repository signature is unchanged.
+ */
+class PDRCache
+{
+  public:
+    PDRCache() = delete;
+    PDRCache(const PDRCache&) = delete;
+    PDRCache(PDRCache&&) = delete;
+    PDRCache& operator=(const PDRCache&) = delete;
+    PDRCache& operator=(PDRCache&&) = delete;
+    ~PDRCache() = default;
+
+    /** @brief Constructor
+     *
+     *  @param[in] cacheDir - directory of the cache files, the cache is
+     *                        disabled if it is empty
+     */
+    explicit PDRCache(const std::filesystem::path& cacheDir) :
+        cacheDir(cacheDir)
+    {}
+
+    /** @brief Load the cached PDRs of a terminus
+     *
+     *  @param[in] uuid - terminus UUID
+     *  @param[in] signature - the current repository signature of terminus
+     *
+     *  @return the cached PDRs, std::nullopt if nothing is cached or the
+     *          cache doesn't match the signature
+     */
+    std::optional<std::vector<std::vector<uint8_t>>>
+        load(const UUID& uuid, const PDRRepositorySignature& signature) const;
+
+    /** @brief Store the PDRs of a terminus, replace the previous cache
+     *
+     *  @param[in] uuid - terminus UUID
+     *  @param[in] signature - the repository signature the PDRs belong to
+     *  @param[in] pdrs - the raw PDRs
+     *
+     *  @return true if the cache file is written
+     */
+    bool store(const UUID& uuid, const PDRRepositorySignature& signature,
+               const std::vector<std::vector<uint8_t>>& pdrs) const;
+
+    /** @brief Remove the cached PDRs of a terminus
+     *
+     *  @param[in] uuid - terminus UUID
+     */
+    void remove(const UUID& uuid) const;
+
+  private:
+    /** @brief Path of the cache file of a terminus
+     *
+     *  @param[in] uuid - terminus UUID
+     *
+     *  @return the file path, std::nullopt if caching is not possible
+     */
+    std::optional<std::filesystem::path> cacheFile(const UUID& uuid) const;
+
+    /** @brief directory of the cache files */
+    std::filesystem::path cacheDir;
+};
+
+} // namespace platform_mc
+} // namespace pldm
@@ -16,6 +16,8 @@
  */
 #include "platform_manager.hpp"
 
+#include "libpldm/utils.h"
+
 #include "terminus_manager.hpp"
 
 #include <phosphor-logging/lg2.hpp>
@@ -29,49 +31,62 @@ requester::Coroutine PlatformManager::initTerminus()
 {
     for (auto& [tid, terminus] : termini)
     {
-        if (terminus->doesSupport(PLDM_PLATFORM))
-        {
-            uint16_t terminusMaxBufferSize = terminus->maxBufferSize;
-            auto rc = co_await eventMessageBufferSize(
-                tid, terminus->maxBufferSize, terminusMaxBufferSize);
-            if (!rc)
-            {
-                terminus->maxBufferSize =
-                    std::min(terminus->maxBufferSize, terminusMaxBufferSize);
-            }
+        co_await initTerminus(tid);
+    }
+    co_return PLDM_SUCCESS;
+}
 
-            uint8_t synchronyConfiguration = 0;
-            uint8_t numberEventClassReturned = 0;
-            std::vector<uint8_t> eventClass{};
-            rc = co_await eventMessageSupported(
-                tid, 1, synchronyConfiguration,
-                terminus->synchronyConfigurationSupported,
-                numberEventClassReturned, eventClass);
-            if (rc)
-            {
-                lg2::error("failed to send eventMessageSupported, rc={RC}.",
-                           "RC", rc);
-                terminus->synchronyConfigurationSupported = 0;
-            }
+requester::Coroutine PlatformManager::initTerminus(tid_t tid)
+{
+    if (termini.find(tid) == termini.end())
+    {
+        co_return PLDM_ERROR;
+    }
 
-            if (!terminus->initalized)
-            {
-                rc = co_await getPDRs(terminus);
-                if (!rc)
-                {
-                    terminus->parsePDRs();
-                    // look for Platform Configuration PDIs like SensorAuxName
-                    // etc.
-                    co_await terminus->scanInventories();
-                    // update Sensor Objects with information from Platform
-                    // Configuration PDIs
-                    terminus->updateAssociations();
-                    terminus->initalized = true;
-                }
-            }
-            co_await initEventReceiver(tid);
+    auto terminus = termini[tid];
+    if (!terminus->doesSupport(PLDM_PLATFORM))
+    {
+        co_return PLDM_SUCCESS;
+    }
+
+    uint16_t terminusMaxBufferSize = terminus->maxBufferSize;
+    auto rc = co_await eventMessageBufferSize(tid, terminus->maxBufferSize,
+                                              terminusMaxBufferSize);
+    if (!rc)
+    {
+        terminus->advertisedBufferSize = terminusMaxBufferSize;
+        terminus->maxBufferSize =
+            std::min(terminus->maxBufferSize, terminusMaxBufferSize);
+    }
+
+    uint8_t synchronyConfiguration = 0;
+    uint8_t numberEventClassReturned = 0;
+    std::vector<uint8_t> eventClass{};
+    rc = co_await eventMessageSupported(
+        tid, 1, synchronyConfiguration,
+        terminus->synchronyConfigurationSupported, numberEventClassReturned,
+        eventClass);
+    if (rc)
+    {
+        lg2::error("failed to send eventMessageSupported, rc={RC}.", "RC", rc);
+        terminus->synchronyConfigurationSupported = 0;
+    }
+
+    if (!terminus->initalized)
+    {
+        rc = co_await getPDRs(terminus);
+        if (!rc)
+        {
+            terminus->parsePDRs();
+            // look for Platform Configuration PDIs like SensorAuxName etc.
+            co_await terminus->scanInventories();
+            // update Sensor Objects with information from Platform
+            // Configuration PDIs
+            terminus->updateAssociations();
+            terminus->initalized = true;
         }
     }
+    co_await initEventReceiver(tid);
     co_return PLDM_SUCCESS;
 }
 
@@ -84,12 +99,14 @@ requester::Coroutine PlatformManager::initEventReceiver(tid_t tid)
 
     auto& terminus = termini[tid];
     uint8_t rc = PLDM_SUCCESS;
+    bool asyncEventEnabled = false;
     if (terminus->synchronyConfigurationSupported &
         (1 << PLDM_EVENT_MESSAGE_GLOBAL_ENABLE_ASYNC))
     {
         rc = co_await setEventReceiver(tid,
                                        PLDM_EVENT_MESSAGE_GLOBAL_ENABLE_ASYNC,
                                        terminusManager.getLocalEid());
+        asyncEventEnabled = (rc == PLDM_SUCCESS);
         if (rc)
         {
             auto mctpInfo = terminusManager.toMctpInfo(tid);
@@ -110,6 +127,21 @@ requester::Coroutine PlatformManager::initEventReceiver(tid_t tid)
             }
         }
     }
+
+    // the terminus can be removed while waiting for the response
+    auto it = termini.find(tid);
+    if (it == termini.end())
+    {
+        co_return rc;
+    }
+
+    // the sensors switch between event-primary and polling mode when the
+    // polling list is initialized again
+    if (it->second->asyncEventEnabled != asyncEventEnabled)
+    {
+        it->second->asyncEventEnabled = asyncEventEnabled;
+        it->second->initSensorList = true;
+    }
     co_return rc;
 }
 
@@ -119,11 +151,10 @@ requester::Coroutine
     tid_t tid = terminus->getTid();
 
     uint8_t repositoryState = 0;
-    uint32_t recordCount = 0;
-    uint32_t repositorySize = 0;
-    uint32_t largestRecordSize = 0;
-    auto rc = co_await getPDRRepositoryInfo(tid, repositoryState, recordCount,
-                                            repositorySize, largestRecordSize);
+    PDRRepositorySignature signature{};
+    auto rc = co_await getPDRRepositoryInfo(tid, repositoryState, signature);
+    uint32_t recordCount = signature.recordCount;
+    uint32_t largestRecordSize = signature.largestRecordSize;
     if (rc)
     {
         lg2::error(
@@ -150,81 +181,175 @@ requester::Coroutine
         co_return PLDM_ERROR_NOT_READY;
     }
 
+    if (!rc)
+    {
+        auto pdrs = pdrCache.load(terminus->getUuid(), signature);
+        if (pdrs)
+        {
+            lg2::info("Use the cached PDRs of terminus tid={TID}.", "TID",
+                      tid);
+            terminus->pdrs = std::move(*pdrs);
+            co_return PLDM_SUCCESS;
+        }
+    }
+    bool cacheable = !rc;
+
     uint32_t recordHndl = 0;
     uint32_t nextRecordHndl = 0;
     uint32_t nextDataTransferHndl = 0;
     uint8_t transferFlag = 0;
     uint16_t responseCnt = 0;
-    constexpr uint16_t recvBufSize = 1024;
+    uint16_t recvBufSize = getPDRTransferSize(terminus, largestRecordSize);
     std::vector<uint8_t> recvBuf(recvBufSize);
     uint8_t transferCrc = 0;
 
     terminus->pdrs.clear();
+    if (!rc)
+    {
+        // bound by the repository size against a bogus record count
+        terminus->pdrs.reserve(
+            std::min<size_t>(recordCount, signature.repositorySize /
+                                              sizeof(pldm_pdr_hdr)) +
+            1);
+    }
     uint32_t receivedRecordCount = 0;
 
     do
     {
-        rc =
-            co_await getPDR(tid, recordHndl, 0, PLDM_GET_FIRSTPART, recvBufSize,
-                            0, nextRecordHndl, nextDataTransferHndl,
-                            transferFlag, responseCnt, recvBuf, transferCrc);
+        rc = co_await getPDR(tid, recordHndl, 0, PLDM_GET_FIRSTPART,
+                             recvBufSize, 0, nextRecordHndl,
+                             nextDataTransferHndl, transferFlag, responseCnt,
+                             recvBuf.data(), recvBuf.size(), transferCrc);
 
         if (rc)
         {
             co_return rc;
         }
 
-        if (transferFlag == PLDM_START || transferFlag == PLDM_START_AND_END)
+        if (transferFlag == PLDM_START_AND_END || nextDataTransferHndl == 0)
         {
             // single-part transfer
-            terminus->pdrs.emplace_back(std::vector<uint8_t>(
-                recvBuf.begin(), recvBuf.begin() + responseCnt));
+            terminus->pdrs.emplace_back(recvBuf.begin(),
+                                        recvBuf.begin() + responseCnt);
             recordHndl = nextRecordHndl;
         }
         else
         {
-            // multipart transfer
-            uint32_t receivedRecordSize = 0;
-            auto pdrHdr = reinterpret_cast<pldm_pdr_hdr*>(recvBuf.data());
-            uint16_t recordChgNum = le16toh(pdrHdr->record_change_num);
-            std::vector<uint8_t> receivedPdr(recvBuf.begin(),
-                                             recvBuf.begin() + responseCnt);
+            // multipart transfer, the record buffer is sized from the PDR
+            // header and the following parts are decoded into it in place
+            size_t recordSize = responseCnt;
+            uint16_t recordChgNum = 0;
+            if (responseCnt >= sizeof(pldm_pdr_hdr))
+            {
+                auto pdrHdr = reinterpret_cast<pldm_pdr_hdr*>(recvBuf.data());
+                recordChgNum = le16toh(pdrHdr->record_change_num);
+                recordSize = std::max<size_t>(
+                    recordSize, sizeof(pldm_pdr_hdr) + le16toh(pdrHdr->length));
+            }
+            std::vector<uint8_t> receivedPdr(recordSize);
+            std::copy_n(recvBuf.begin(), responseCnt, receivedPdr.begin());
+            size_t receivedRecordSize = responseCnt;
+            bool recordReceived = false;
             do
             {
-                rc = co_await getPDR(tid, recordHndl, nextDataTransferHndl,
-                                     PLDM_GET_NEXTPART, recvBufSize,
-                                     recordChgNum, nextRecordHndl,
-                                     nextDataTransferHndl, transferFlag,
-                                     responseCnt, recvBuf, transferCrc);
+                // only ask for the rest of the record, grow the buffer if the
+                // terminus sends more than its header told
+                size_t remaining = receivedPdr.size() - receivedRecordSize;
+                if (remaining == 0)
+                {
+                    receivedPdr.resize(receivedRecordSize + recvBufSize);
+                    remaining = recvBufSize;
+                }
+                auto requestCnt = static_cast<uint16_t>(
+                    std::min<size_t>(remaining, recvBufSize));
+
+                rc = co_await getPDR(
+                    tid, recordHndl, nextDataTransferHndl, PLDM_GET_NEXTPART,
+                    requestCnt, recordChgNum, nextRecordHndl,
+                    nextDataTransferHndl, transferFlag, responseCnt,
+                    receivedPdr.data() + receivedRecordSize, remaining,
+                    transferCrc);
                 if (rc)
                 {
                     co_return rc;
                 }
-
-                receivedPdr.insert(receivedPdr.end(), recvBuf.begin(),
-                                   recvBuf.begin() + responseCnt);
                 receivedRecordSize += responseCnt;
 
                 if (transferFlag == PLDM_END)
                 {
-                    terminus->pdrs.emplace_back(receivedPdr);
-                    recordHndl = nextRecordHndl;
+                    receivedPdr.resize(receivedRecordSize);
+                    if (transferCrc !=
+                        crc8(receivedPdr.data(), receivedPdr.size()))
+                    {
+                        lg2::error(
+                            "PDR transfer CRC mismatch, tid={TID} recordHandle={HANDLE}.",
+                            "TID", tid, "HANDLE", recordHndl);
+                        break;
+                    }
+                    terminus->pdrs.emplace_back(std::move(receivedPdr));
+                    recordReceived = true;
+                    break;
+                }
+
+                // a part without data would ask for the same part again
+                if (responseCnt == 0)
+                {
+                    break;
                 }
             } while (nextDataTransferHndl != 0 &&
                      receivedRecordSize < largestRecordSize);
+
+            if (!recordReceived)
+            {
+                lg2::error(
+                    "Drop the incomplete PDR, tid={TID} recordHandle={HANDLE} size={SIZE}.",
+                    "TID", tid, "HANDLE", recordHndl, "SIZE",
+                    receivedRecordSize);
+                cacheable = false;
+            }
+            recordHndl = nextRecordHndl;
         }
         receivedRecordCount++;
     } while (nextRecordHndl != 0 && receivedRecordCount < recordCount);
 
+    // only a complete repository is cached
+    if (cacheable && nextRecordHndl == 0)
+    {
+        pdrCache.store(terminus->getUuid(), signature, terminus->pdrs);
+    }
+
     co_return PLDM_SUCCESS;
 }
 
+uint16_t PlatformManager::getPDRTransferSize(
+    std::shared_ptr<Terminus> terminus, uint32_t largestRecordSize)
+{
+    constexpr size_t defaultTransferSize = 1024;
+    constexpr size_t respHdrSize =
+        sizeof(pldm_msg_hdr) + PLDM_GET_PDR_MIN_RESP_BYTES + sizeof(uint8_t);
+
+    // follow the buffer size of terminus when it can send more than the
+    // default, so larger records still arrive in one part
+    size_t transferSize = defaultTransferSize;
+    if (terminus->advertisedBufferSize > respHdrSize)
+    {
+        transferSize = std::max<size_t>(
+            transferSize, terminus->advertisedBufferSize - respHdrSize);
+    }
+
+    // no need to ask for more than the largest record of the repository
+    transferSize = std::min<size_t>(transferSize, largestRecordSize);
+    return static_cast<uint16_t>(std::clamp<size_t>(
+        transferSize, sizeof(pldm_pdr_hdr),
+        std::numeric_limits<uint16_t>::max()));
+}
+
 requester::Coroutine PlatformManager::getPDR(
     tid_t tid, uint32_t recordHndl, uint32_t dataTransferHndl,
     uint8_t transferOpFlag, uint16_t requestCnt, uint16_t recordChgNum,
     uint32_t& nextRecordHndl, uint32_t& nextDataTransferHndl,
-    uint8_t& transferFlag, uint16_t& responseCnt,
-    std::vector<uint8_t>& recordData, uint8_t& transferCrc)
+    uint8_t& transferFlag, uint16_t& responseCnt, uint8_t* recordData,
+    size_t recordDataLength, uint8_t& transferCrc)
 {
     Request request(sizeof(pldm_msg_hdr) + PLDM_GET_PDR_REQ_BYTES);
     auto requestMsg = reinterpret_cast<pldm_msg*>(request.data());
@@ -248,8 +373,8 @@ requester::Coroutine PlatformManager::getPDR(
     uint8_t completionCode;
     rc = decode_get_pdr_resp(responseMsg, responseLen, &completionCode,
                              &nextRecordHndl, &nextDataTransferHndl,
-                             &transferFlag, &responseCnt, recordData.data(),
-                             recordData.size(), &transferCrc);
+                             &transferFlag, &responseCnt, recordData,
+                             recordDataLength, &transferCrc);
     if (rc)
     {
         co_return rc;
@@ -258,8 +383,7 @@ requester::Coroutine PlatformManager::getPDR(
 }
 
 requester::Coroutine PlatformManager::getPDRRepositoryInfo(
-    tid_t tid, uint8_t& repositoryState, uint32_t& recordCount,
-    uint32_t& repositorySize, uint32_t& largestRecordSize)
+    tid_t tid, uint8_t& repositoryState, PDRRepositorySignature& signature)
 {
     Request request(sizeof(pldm_msg_hdr));
     auto requestMsg = reinterpret_cast<pldm_msg*>(request.data());
@@ -280,14 +404,13 @@ requester::Coroutine PlatformManager::getPDRRepositoryInfo(
     }
 
     uint8_t completionCode = 0;
-    uint8_t updateTime[PLDM_TIMESTAMP104_SIZE] = {0};
-    uint8_t oemUpdateTime[PLDM_TIMESTAMP104_SIZE] = {0};
     uint8_t dataTransferHandleTimeout = 0;
 
     rc = decode_get_pdr_repository_info_resp(
-        responseMsg, responseLen, &completionCode, &repositoryState, updateTime,
-        oemUpdateTime, &recordCount, &repositorySize, &largestRecordSize,
-        &dataTransferHandleTimeout);
+        responseMsg, responseLen, &completionCode, &repositoryState,
+        signature.updateTime.data(), signature.oemUpdateTime.data(),
+        &signature.recordCount, &signature.repositorySize,
+        &signature.largestRecordSize, &dataTransferHandleTimeout);
     if (rc)
     {
         co_return rc;
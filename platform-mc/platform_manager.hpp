@@ -19,9 +19,12 @@
 #include "libpldm/platform.h"
 #include "libpldm/requester/pldm.h"
 
+#include "pdr_cache.hpp"
 #include "terminus.hpp"
 #include "terminus_manager.hpp"
 
+#include <filesystem>
+
 namespace pldm
 {
 
@@ -44,11 +47,19 @@ class PlatformManager
     PlatformManager& operator=(PlatformManager&&) = delete;
     ~PlatformManager() = default;
 
+    /** @brief Constructor
+     *
+     *  @param[in] terminusManager - reference of TerminusManager
+     *  @param[in] termini - the managed termini list
+     *  @param[in] pdrCacheDir - directory of the PDR cache files, the fetched
+     *                           PDRs are not cached if it is empty
+     */
     explicit PlatformManager(
         TerminusManager& terminusManager,
-        std::map<tid_t, std::shared_ptr<Terminus>>& termini) :
+        std::map<tid_t, std::shared_ptr<Terminus>>& termini,
+        const std::filesystem::path& pdrCacheDir = {}) :
         terminusManager(terminusManager),
-        termini(termini)
+        termini(termini), pdrCache(pdrCacheDir)
     {}
 
     /** @brief Initialize terminus which supports PLDM Type 2
@@ -56,6 +67,13 @@ class PlatformManager
      */
     requester::Coroutine initTerminus();
 
+    /** @brief Initialize one terminus which supports PLDM Type 2, it can run
+     *         concurrently with the initialization of other termini
+     *  @param[in] tid - Terminus ID
+     *  @return coroutine return_value - PLDM completion code
+     */
+    requester::Coroutine initTerminus(tid_t tid);
+
     /** @brief Initialize terminus Event Receiver setting
      *  @param[in] tid - Terminus ID
      *  @return coroutine return_value - PLDM completion code
@@ -63,7 +81,9 @@ class PlatformManager
     requester::Coroutine initEventReceiver(tid_t tid);
 
   private:
-    /** @brief Fetch all PDRs from terminus.
+    /** @brief Fetch all PDRs from terminus. The PDRs cached for the terminus
+     *         UUID are used instead when the repository signature reported by
+     *         GetPDRRepositoryInfo is unchanged.
      *
      *  @param[in] terminus - The terminus object to store fetched PDRs
      *  @return coroutine return_value - PLDM completion code
@@ -82,7 +102,8 @@ class PlatformManager
      *  @param[out] nextDataTransferHndl - Next data transfer handle
      *  @param[out] transferFlag - Transfer flag
      *  @param[out] responseCnt - Response count of record data
-     *  @param[out] recordData - Returned record data
+     *  @param[out] recordData - Buffer to decode the returned record data into
+     *  @param[in] recordDataLength - Length of the recordData buffer
      *  @param[out] transferCrc - CRC value when record data is last part of PDR
      *  @return coroutine return_value - PLDM completion code
      */
@@ -92,19 +113,31 @@ class PlatformManager
                                 uint16_t recordChgNum, uint32_t& nextRecordHndl,
                                 uint32_t& nextDataTransferHndl,
                                 uint8_t& transferFlag, uint16_t& responseCnt,
-                                std::vector<uint8_t>& recordData,
+                                uint8_t* recordData, size_t recordDataLength,
                                 uint8_t& transferCrc);
 
+    /** @brief The request count of GetPDR, derived from the buffer size of
+     *         terminus and the largest record of its repository
+     *
+     *  @param[in] terminus - the terminus to fetch PDRs from
+     *  @param[in] largestRecordSize - the largest record size reported by
+     *                                 GetPDRRepositoryInfo
+     *  @return the number of record bytes to request in one GetPDR
+     */
+    uint16_t getPDRTransferSize(std::shared_ptr<Terminus> terminus,
+                                uint32_t largestRecordSize);
+
     /** @brief get PDR repository information.
      *
-     *  @param[in] terminus - The terminus object to store fetched PDRs
+     *  @param[in] tid - Destination TID
+     *  @param[out] repositoryState - state of the PDR repository
+     *  @param[out] signature - update times, record count and sizes of the
+     *                          PDR repository
      *  @return coroutine return_value - PLDM completion code
      */
-    requester::Coroutine getPDRRepositoryInfo(tid_t tid,
-                                              uint8_t& repositoryState,
-                                              uint32_t& recordCount,
-                                              uint32_t& repositorySize,
-                                              uint32_t& largestRecordSize);
+    requester::Coroutine
+        getPDRRepositoryInfo(tid_t tid, uint8_t& repositoryState,
+                             PDRRepositorySignature& signature);
 
     /** @brief Send setEventReceiver command to destination EID.
      *
@@ -151,6 +184,9 @@ class PlatformManager
 
     /** @brief Managed termini list */
     std::map<tid_t, std::shared_ptr<Terminus>>& termini;
+
+    /** @brief The on disk cache of the PDRs fetched from termini */
+    PDRCache pdrCache;
 };
 } // namespace platform_mc
 } // namespace pldm
@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "properties_coalescer.hpp"
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <cstring>
+#include <vector>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+PropertiesChangedCoalescer::PropertiesChangedCoalescer(
+    sdbusplus::bus::bus& bus, sdeventplus::Event& event, bool verbose) :
+    bus(bus),
+    verbose(verbose)
+{
+    deferFlush = std::make_unique<sdeventplus::source::Defer>(
+        event, [this](sdeventplus::source::EventBase&) {
+            // flush the changes of the termini not being polled, erasing
+            // the flushed terminus does not invalidate the next iterator
+            for (auto it = changes.begin(); it != changes.end();)
+            {
+                auto tid = (it++)->first;
+                if (!holds.contains(tid))
+                {
+                    flush(tid);
+                }
+            }
+        });
+    deferFlush->set_enabled(sdeventplus::source::Enabled::Off);
+}
+
+void PropertiesChangedCoalescer::add(tid_t tid, const std::string& path,
+                                     const std::string& interface,
+                                     const std::string& property)
+{
+    changes[tid][std::make_pair(path, interface)].emplace(property);
+    if (!holds.contains(tid))
+    {
+        deferFlush->set_enabled(sdeventplus::source::Enabled::OneShot);
+    }
+}
+
+void PropertiesChangedCoalescer::hold(tid_t tid)
+{
+    holds[tid]++;
+}
+
+void PropertiesChangedCoalescer::release(tid_t tid)
+{
+    auto it = holds.find(tid);
+    if (it == holds.end())
+    {
+        return;
+    }
+    if (--it->second == 0)
+    {
+        holds.erase(it);
+        flush(tid);
+    }
+}
+
+size_t PropertiesChangedCoalescer::flush()
+{
+    deferFlush->set_enabled(sdeventplus::source::Enabled::Off);
+
+    size_t signals = 0;
+    for (const auto& [tid, objects] : changes)
+    {
+        signals += emit(objects);
+    }
+    changes.clear();
+
+    if (verbose && signals)
+    {
+        lg2::info("Emitted {SIGNALS} coalesced PropertiesChanged signals.",
+                  "SIGNALS", signals);
+    }
+    return signals;
+}
+
+size_t PropertiesChangedCoalescer::flush(tid_t tid)
+{
+    auto it = changes.find(tid);
+    if (it == changes.end())
+    {
+        return 0;
+    }
+
+    auto signals = emit(it->second);
+    changes.erase(it);
+
+    if (verbose && signals)
+    {
+        lg2::info(
+            "Emitted {SIGNALS} coalesced PropertiesChanged signals of terminus {TID}.",
+            "SIGNALS", signals, "TID", tid);
+    }
+    return signals;
+}
+
+size_t PropertiesChangedCoalescer::pending() const
+{
+    size_t objects = 0;
+    for (const auto& [tid, terminusChanges] : changes)
+    {
+        objects += terminusChanges.size();
+    }
+    return objects;
+}
+
+size_t PropertiesChangedCoalescer::pending(tid_t tid) const
+{
+    auto it = changes.find(tid);
+    return it == changes.end() ? 0 : it->second.size();
+}
+
+size_t PropertiesChangedCoalescer::emit(const Changes& objects)
+{
+    size_t signals = 0;
+    for (const auto& [object, properties] : objects)
+    {
+        const auto& [path, interface] = object;
+        std::vector<char*> names;
+        names.reserve(properties.size() + 1);
+        for (const auto& property : properties)
+        {
+            names.emplace_back(const_cast<char*>(property.c_str()));
+        }
+        names.emplace_back(nullptr);
+
+        auto rc = sd_bus_emit_properties_changed_strv(
+            bus.get(), path.c_str(), interface.c_str(), names.data());
+        if (rc < 0)
+        {
+            // the object might be removed before the flush
+            if (verbose)
+            {
+                lg2::error(
+                    "Failed to emit PropertiesChanged of {PATH} {INTERFACE}, {ERROR}.",
+                    "PATH", path, "INTERFACE", interface, "ERROR",
+                    std::strerror(-rc));
+            }
+            continue;
+        }
+        signals++;
+    }
+    return signals;
+}
+
+} // namespace platform_mc
+} // namespace pldm
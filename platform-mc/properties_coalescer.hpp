@@ -0,0 +1,149 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "common/types.hpp"
+
+#include <sdbusplus/bus.hpp>
+#include <sdeventplus/event.hpp>
+#include <sdeventplus/source/event.hpp>
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+/**
+ * @brief PropertiesChangedCoalescer
+ *
+ * The sensors set their D-Bus properties without emitting the
+ * PropertiesChanged signal and record the changed property here instead. The
+ * changes are emitted as one signal per object interface when flushed, so a
+ * property updated several times in a polling round is signalled once.
+ *
+ * The changes are recorded per terminus. The changes of a terminus are
+ * flushed on the next event loop iteration unless a polling round of that
+ * terminus holds them, then they are flushed when the round releases them,
+ * so the rounds of other termini never delay them.
+ */
+class PropertiesChangedCoalescer
+{
+  public:
+    PropertiesChangedCoalescer() = delete;
+    PropertiesChangedCoalescer(const PropertiesChangedCoalescer&) = delete;
+    PropertiesChangedCoalescer(PropertiesChangedCoalescer&&) = delete;
+    PropertiesChangedCoalescer&
+        operator=(const PropertiesChangedCoalescer&) = delete;
+    PropertiesChangedCoalescer&
+        operator=(PropertiesChangedCoalescer&&) = delete;
+
+    /** @brief Constructor
+     *
+     *  @param[in] bus - the bus to emit the signals on
+     *  @param[in] event - the event loop to schedule the flush on
+     *  @param[in] verbose - log the number of emitted signals
+     */
+    PropertiesChangedCoalescer(sdbusplus::bus::bus& bus,
+                               sdeventplus::Event& event,
+                               bool verbose = false);
+
+    /** @brief Record a changed property to be signalled
+     *
+     *  @param[in] tid - the terminus of the object
+     *  @param[in] path - object path
+     *  @param[in] interface - interface of the property
+     *  @param[in] property - property name
+     */
+    void add(tid_t tid, const std::string& path, const std::string& interface,
+             const std::string& property);
+
+    /** @brief Hold the changes of a terminus until release(), called at the
+     *         start of its polling round
+     *
+     *  @param[in] tid - the terminus polled
+     */
+    void hold(tid_t tid);
+
+    /** @brief Release a hold, the changes of the terminus are flushed once
+     *         no polling round of it holds them
+     *
+     *  @param[in] tid - the terminus polled
+     */
+    void release(tid_t tid);
+
+    /** @brief Emit the PropertiesChanged signals of the recorded changes of
+     *         every terminus
+     *
+     *  @return the number of signals emitted
+     */
+    size_t flush();
+
+    /** @brief Emit the PropertiesChanged signals of the recorded changes of
+     *         a terminus
+     *
+     *  @param[in] tid - the terminus
+     *
+     *  @return the number of signals emitted
+     */
+    size_t flush(tid_t tid);
+
+    /** @brief The number of object interfaces waiting to be signalled */
+    size_t pending() const;
+
+    /** @brief The number of object interfaces of a terminus waiting to be
+     *         signalled
+     *
+     *  @param[in] tid - the terminus
+     */
+    size_t pending(tid_t tid) const;
+
+  private:
+    sdbusplus::bus::bus& bus;
+
+    /** @brief flush on the next event loop iteration */
+    std::unique_ptr<sdeventplus::source::Defer> deferFlush;
+
+    using Changes =
+        std::map<std::pair<std::string, std::string>, std::set<std::string>>;
+
+    /** @brief Emit the PropertiesChanged signals of the changes
+     *
+     *  @param[in] objects - the changed properties to be signalled
+     *
+     *  @return the number of signals emitted
+     */
+    size_t emit(const Changes& objects);
+
+    /** @brief the changed properties of each terminus by object path and
+     *         interface */
+    std::map<tid_t, Changes> changes;
+
+    /** @brief the number of polling rounds holding the changes of each
+     *         terminus */
+    std::map<tid_t, size_t> holds;
+
+    bool verbose;
+};
+
+} // namespace platform_mc
+} // namespace pldm
@@ -28,8 +28,6 @@ namespace platform_mc
 {
 
 using namespace std::chrono;
-using SensorVariant =
-    std::variant<std::shared_ptr<NumericSensor>, std::shared_ptr<StateSensor>>;
 
 SensorPollingEnableIntf::SensorPollingEnableIntf(SensorManager& parent) :
     EnableIntf(pldm::utils::DBusHandler::getBus(), sensorPollingControlPath),
@@ -55,9 +53,16 @@ SensorManager::SensorManager(
     bool verbose, const std::filesystem::path& configJson) :
     event(event),
     terminusManager(terminusManager), termini(termini),
-    pollingTime(SENSOR_POLLING_TIME), verbose(verbose), manager(manager)
+    pollingTime(SENSOR_POLLING_TIME), pollingWindow(SENSOR_POLLING_WINDOW),
+    staleLimitInUsec(STALE_SENSOR_UPPER_LIMITS_POLLING_TIME * 1000),
+    bulkSensorReading(false),
+    eventHeartbeatInUsec(SENSOR_EVENT_HEARTBEAT_TIME * 1000),
+    adaptivePollingMinTimeInUsec(SENSOR_ADAPTIVE_POLLING_MIN_TIME * 1000),
+    verbose(verbose), manager(manager)
 {
     enableIntf = std::make_unique<SensorPollingEnableIntf>(*this);
+    coalescer = std::make_shared<PropertiesChangedCoalescer>(
+        pldm::utils::DBusHandler::getBus(), event, verbose);
 
     // default priority sensor name spaces
     prioritySensorNameSpaces.emplace_back(
@@ -92,6 +97,25 @@ SensorManager::SensorManager(
             prioritySensorNameSpaces.emplace_back(nameSpace);
         }
     }
+
+    // load the number of concurrent sensor readings per terminus
+    pollingWindow = std::max<size_t>(
+        data.value("SensorPollingWindow", pollingWindow), 1);
+
+    // batch the numeric sensor readings with the OEM bulk command
+    bulkSensorReading = data.value("BulkSensorReading", bulkSensorReading);
+
+    // heartbeat polling interval in ms of the sensors updated by events
+    eventHeartbeatInUsec = data.value("SensorEventHeartbeatTime",
+                                      eventHeartbeatInUsec / 1000) *
+                           1000;
+
+    // shortest polling interval in ms of the sensors trending toward a
+    // threshold
+    adaptivePollingMinTimeInUsec =
+        data.value("SensorAdaptivePollingMinTime",
+                   adaptivePollingMinTimeInUsec / 1000) *
+        1000;
 }
 
 bool SensorManager::isPriority(std::shared_ptr<NumericSensor> sensor)
@@ -109,6 +133,10 @@ void SensorManager::startPolling(tid_t tid)
         return;
     }
 
+    // the readings of the polling window are in flight to the terminus at
+    // the same time
+    terminusManager.setMaxOutstandingRequests(tid, pollingWindow);
+
     auto terminus = termini[tid];
     terminus->stopPolling = false;
     doSensorPolling(tid);
@@ -274,176 +302,399 @@ requester::Coroutine SensorManager::doSensorPollingTask(tid_t tid)
             initSensorList(tid);
         }
 
-        // poll priority Sensors
-        for (auto& sensor : terminus->prioritySensors)
+        // poll priority and round robin sensors, earliest deadline first,
+        // with up to pollingWindow readings in flight
+        auto window = std::make_shared<PollingWindow>();
+        window->startTimeInUsec = t0;
+        sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
+        collectDueSensors(terminus, t1, *window);
+
+        window->activeWorkers =
+            std::min(pollingWindow, window->sensors.size());
+        auto workers = window->activeWorkers;
+        // the readings of the round are signalled together once it is over
+        coalescer->hold(tid);
+        for (size_t i = 0; i < workers; i++)
         {
-            if (manager && terminus->pollEvent)
-            {
-                break;
-            }
+            pollSensorsWorker(tid, window).detach();
+        }
+        co_await *window;
+        coalescer->release(tid);
 
-            if (sensor->updateTime == std::numeric_limits<uint64_t>::max())
-            {
-                continue;
-            }
+        if (terminus->stopPolling)
+        {
+            co_return PLDM_ERROR;
+        }
 
-            sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
-            if (sensor->needsUpdate(t1))
-            {
-                co_await getSensorReading(sensor);
-                if (terminus->stopPolling)
-                {
-                    co_return PLDM_ERROR;
-                }
-                sensor->setLastUpdatedTimeStamp(t1);
-            }
+        // ServiceReady Logic:
+        // The terminus is ready once every round robin sensor has been
+        // refreshed at least once, or there are no sensors to be refreshed.
+        if (!terminus->ready &&
+            std::all_of(terminus->roundRobinSensors.begin(),
+                        terminus->roundRobinSensors.end(), [](auto& sensor) {
+            return std::visit(
+                [](auto&& sensor) { return sensor->isRefreshed(); }, sensor);
+        }))
+        {
+            terminus->ready = true;
+            checkAllTerminiReady();
         }
 
         if (verbose)
         {
             sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
             lg2::info(
-                "TID:{TID} end prioritySensors polling at {END}. duration(us):{DELTA}",
-                "TID", tid, "END", t1, "DELTA", t1 - t0);
+                "TID:{TID} end sensors polling at {END}. duration(us):{DELTA} polled:{POLLED}/{DUE}",
+                "TID", tid, "END", t1, "DELTA", t1 - t0, "POLLED",
+                window->next, "DUE", window->sensors.size());
         }
 
-        // poll roundRobin Sensors
         sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
-        auto toBeUpdated = terminus->roundRobinSensors.size();
 
-        do
+        uint64_t diff = t1 - t0;
+        if (diff > pollingTimeInUsec)
+        {
+            // We have already crossed the polling interval. Don't sleep
+            continue;
+        }
+
+        uint64_t sleepDeltaInUsec = pollingTimeInUsec - diff;
+        if (sleepDeltaInUsec < allowedBufferInUsec)
         {
-            if (!toBeUpdated)
+            // If the delta is within the allowed buffer, we can skip sleeping
+            // and continue polling.
+            continue;
+        }
+
+        co_await timer::Sleep(event, sleepDeltaInUsec, timer::Priority);
+
+    } while (true);
+
+    co_return PLDM_SUCCESS;
+}
+
+void SensorManager::collectDueSensors(std::shared_ptr<Terminus> terminus,
+                                      uint64_t now, PollingWindow& window)
+{
+    window.sensors.clear();
+    window.next = 0;
+
+    for (auto& sensor : terminus->prioritySensors)
+    {
+        if (sensor->updateTime == std::numeric_limits<uint64_t>::max())
+        {
+            continue;
+        }
+
+        if (sensor->needsUpdate(now))
+        {
+            window.sensors.emplace_back(sensor->getDeadline(), sensor);
+        }
+    }
+
+    for (auto& sensor : terminus->roundRobinSensors)
+    {
+        std::visit(
+            [&window, now](auto&& sensor) {
+            if (sensor->needsUpdate(now))
             {
-                if (!terminus->ready)
-                {
-                    // Either we were able to succesfully update all sensors in
-                    // one iteration or there are no sensors in the queue. Mark
-                    // ready in both cases.
-                    terminus->ready = true;
-                    checkAllTerminiReady();
-                }
-                break;
+                window.sensors.emplace_back(sensor->getDeadline(), sensor);
             }
+            else
+            {
+                // Nothing to do for the sensor in this round
+                sensor->setRefreshed(true);
+            }
+        },
+            sensor);
+    }
 
-            if (manager && terminus->pollEvent)
+    std::stable_sort(
+        window.sensors.begin(), window.sensors.end(),
+        [](const auto& a, const auto& b) { return a.first < b.first; });
+}
+
+std::optional<SensorVariant>
+    SensorManager::nextDueSensor(std::shared_ptr<Terminus> terminus,
+                                 PollingWindow& window)
+{
+    uint64_t now = 0;
+    uint64_t pollingTimeInUsec = pollingTime * 1000;
+
+    while (window.next < window.sensors.size())
+    {
+        if (terminus->stopPolling || (manager && terminus->pollEvent))
+        {
+            return std::nullopt;
+        }
+
+        sd_event_now(event.get(), CLOCK_MONOTONIC, &now);
+        auto& [deadline, sensor] = window.sensors[window.next++];
+
+        // Once the polling interval is used up only the priority sensors are
+        // read, the remaining round robin sensors keep their early deadline
+        // and come first in the next round.
+        bool priority =
+            std::holds_alternative<std::shared_ptr<NumericSensor>>(sensor) &&
+            std::get<std::shared_ptr<NumericSensor>>(sensor)->isPriority;
+        if (!priority && (now - window.startTimeInUsec) >= pollingTimeInUsec)
+        {
+            continue;
+        }
+
+        uint64_t staleness = now > deadline ? now - deadline : 0;
+        std::visit(
+            [this, staleness](auto&& sensor) {
+            auto& stats = sensor->pollingStatistics;
+            if (stats.update(staleness, staleLimitInUsec) &&
+                (verbose || stats.reportMissed()))
             {
-                break;
+                lg2::info(
+                    "TID:{TID} sensorId:{SID} missed its deadline by {STALENESS}us, MISSED={MISSED} MAX_STALENESS={MAX}us.",
+                    "TID", sensor->tid, "SID", sensor->sensorId, "STALENESS",
+                    staleness, "MISSED", stats.missedDeadlines, "MAX",
+                    stats.maxStalenessInUsec);
             }
+        },
+            sensor);
 
-            auto sensor = terminus->roundRobinSensors.front();
-            terminus->roundRobinSensors.pop();
-            terminus->roundRobinSensors.push(sensor);
-            toBeUpdated--;
-
-            // ServiceReady Logic:
-            // The round-robin queue is circular hence encountering the first
-            // refreshed sensor marks a "complete iteration" of the queue.
-            std::visit(
-                [&terminus, this](auto&& sensor) {
-                    using T = std::decay_t<decltype(sensor)>;
-                    if constexpr (std::is_same_v<
-                                      T, std::shared_ptr<NumericSensor>> ||
-                                  std::is_same_v<T,
-                                                 std::shared_ptr<StateSensor>>)
-                    {
-                        if (!terminus->ready && sensor->isRefreshed())
-                        {
-                            // The terminus isn't ready but we have found our
-                            // first refreshed sensor. Mark the device ready.
-                            terminus->ready = true;
-                            checkAllTerminiReady();
-                        }
-                    }
-                    else
-                    {
-                        assert(false && "Unhandled sensor type encountered");
-                    }
-                },
-                sensor);
+        return sensor;
+    }
 
-            sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
-            if (std::holds_alternative<std::shared_ptr<NumericSensor>>(sensor))
+    return std::nullopt;
+}
+
+requester::Coroutine
+    SensorManager::pollSensorsWorker(tid_t tid,
+                                     std::shared_ptr<PollingWindow> window)
+{
+    std::optional<SensorVariant> pending;
+    while (termini.find(tid) != termini.end())
+    {
+        auto terminus = termini[tid];
+        auto sensor = pending ? pending : nextDueSensor(terminus, *window);
+        pending.reset();
+        if (!sensor)
+        {
+            break;
+        }
+
+        uint64_t t1 = 0;
+        sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
+#ifdef OEM_NVIDIA
+        if (isBulkReadable(terminus, *sensor))
+        {
+            // batch the following due sensors which are bulk readable too,
+            // a sensor that can't be batched is read after the batch
+            std::vector<std::shared_ptr<NumericSensor>> batch{
+                std::get<std::shared_ptr<NumericSensor>>(*sensor)};
+            auto limit = bulkReadingLimit(terminus);
+            while (batch.size() < limit &&
+                   window->next < window->sensors.size() &&
+                   isBulkReadable(terminus,
+                                  window->sensors[window->next].second))
             {
-                auto numericSesnor =
-                    std::get<std::shared_ptr<NumericSensor>>(sensor);
-                if (numericSesnor->needsUpdate(t1))
+                auto next = nextDueSensor(terminus, *window);
+                if (!next)
                 {
-                    co_await getSensorReading(numericSesnor);
-                    if (terminus->stopPolling)
-                    {
-                        co_return PLDM_ERROR;
-                    }
-                    numericSesnor->setLastUpdatedTimeStamp(t1);
+                    break;
                 }
+                if (!isBulkReadable(terminus, *next))
+                {
+                    pending = next;
+                    break;
+                }
+                batch.emplace_back(
+                    std::get<std::shared_ptr<NumericSensor>>(*next));
             }
-            else if (std::holds_alternative<std::shared_ptr<StateSensor>>(
-                         sensor))
+
+            if (batch.size() > 1)
             {
-                auto stateSesnor =
-                    std::get<std::shared_ptr<StateSensor>>(sensor);
-                if (stateSesnor->needsUpdate(t1))
+                co_await getSensorReadingsBulk(tid, batch);
+                if (terminus->stopPolling)
+                {
+                    break;
+                }
+                for (auto& numericSensor : batch)
                 {
-                    co_await getStateSensorReadings(stateSesnor);
-                    if (terminus->stopPolling)
-                    {
-                        co_return PLDM_ERROR;
-                    }
-                    stateSesnor->setLastUpdatedTimeStamp(t1);
+                    numericSensor->setLastUpdatedTimeStamp(t1);
+                    numericSensor->setRefreshed(true);
                 }
+                continue;
+            }
+        }
+#endif
+        if (std::holds_alternative<std::shared_ptr<NumericSensor>>(*sensor))
+        {
+            auto numericSensor =
+                std::get<std::shared_ptr<NumericSensor>>(*sensor);
+            co_await getSensorReading(numericSensor);
+            if (terminus->stopPolling)
+            {
+                break;
+            }
+            numericSensor->setLastUpdatedTimeStamp(t1);
+            numericSensor->setRefreshed(true);
+        }
+        else
+        {
+            auto stateSensor = std::get<std::shared_ptr<StateSensor>>(*sensor);
+            co_await getStateSensorReadings(stateSensor);
+            if (terminus->stopPolling)
+            {
+                break;
             }
+            stateSensor->setLastUpdatedTimeStamp(t1);
+            stateSensor->setRefreshed(true);
+        }
+    }
 
-            std::visit(
-                [](auto&& sensor) {
-                    using T = std::decay_t<decltype(sensor)>;
-                    if constexpr (std::is_same_v<
-                                      T, std::shared_ptr<NumericSensor>> ||
-                                  std::is_same_v<T,
-                                                 std::shared_ptr<StateSensor>>)
-                    {
-                        sensor->setRefreshed(true);
-                    }
-                    else
-                    {
-                        assert(false && "Unhandled sensor type encountered");
-                    }
-                },
-                sensor);
+    window->workerDone();
+    co_return PLDM_SUCCESS;
+}
 
-            sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
-        } while ((t1 - t0) < pollingTimeInUsec);
+#ifdef OEM_NVIDIA
+bool SensorManager::isBulkReadable(std::shared_ptr<Terminus> terminus,
+                                   const SensorVariant& sensor)
+{
+    // a terminus without the OEM type would only time out on the command
+    if (!bulkSensorReading || !terminus->bulkSensorReadingSupported ||
+        !terminus->doesSupport(PLDM_OEM) ||
+        !std::holds_alternative<std::shared_ptr<NumericSensor>>(sensor))
+    {
+        return false;
+    }
 
-        if (verbose)
+    return std::get<std::shared_ptr<NumericSensor>>(sensor)
+               ->getPollingIndicator() ==
+           POLLING_METHOD_INDICATOR_PLDM_TYPE_TWO;
+}
+
+size_t SensorManager::bulkReadingLimit(std::shared_ptr<Terminus> terminus)
+{
+    constexpr size_t respHdrSize =
+        sizeof(pldm_msg_hdr) + PLDM_GET_OEM_SENSOR_READINGS_BULK_MIN_RESP_BYTES;
+    if (terminus->maxBufferSize <= respHdrSize)
+    {
+        return 1;
+    }
+
+    size_t limit = (terminus->maxBufferSize - respHdrSize) /
+                   PLDM_OEM_SENSOR_READINGS_BULK_ENTRY_MAX_BYTES;
+    return std::clamp<size_t>(limit, 1,
+                              PLDM_GET_OEM_SENSOR_READINGS_BULK_MAX_SENSORS);
+}
+
+requester::Coroutine SensorManager::getSensorReadingsBulk(
+    tid_t tid, std::vector<std::shared_ptr<NumericSensor>> sensors)
+{
+    std::vector<uint16_t> sensorIds;
+    sensorIds.reserve(sensors.size());
+    for (const auto& sensor : sensors)
+    {
+        sensorIds.emplace_back(sensor->sensorId);
+    }
+
+    Request request(sizeof(pldm_msg_hdr) +
+                    PLDM_GET_OEM_SENSOR_READINGS_BULK_MIN_REQ_BYTES +
+                    sensorIds.size() * sizeof(uint16_t));
+    auto requestMsg = reinterpret_cast<pldm_msg*>(request.data());
+    auto rc = encode_get_oem_sensor_readings_bulk_req(
+        0, sensorIds.size(), sensorIds.data(), requestMsg,
+        request.size() - sizeof(pldm_msg_hdr));
+    if (rc)
+    {
+        lg2::error(
+            "encode_get_oem_sensor_readings_bulk_req failed, tid={TID}, rc={RC}.",
+            "TID", tid, "RC", rc);
+        co_return rc;
+    }
+
+    const pldm_msg* responseMsg = NULL;
+    size_t responseLen = 0;
+    rc = co_await terminusManager.SendRecvPldmMsg(tid, request, &responseMsg,
+                                                  &responseLen);
+    if (termini.find(tid) == termini.end())
+    {
+        co_return PLDM_ERROR;
+    }
+
+    auto terminus = termini[tid];
+    if (terminus->stopPolling)
+    {
+        co_return PLDM_ERROR;
+    }
+
+    uint8_t completionCode = PLDM_SUCCESS;
+    uint8_t sensorCount = 0;
+    std::array<pldm_oem_sensor_reading_entry,
+               PLDM_GET_OEM_SENSOR_READINGS_BULK_MAX_SENSORS>
+        entries{};
+    if (rc)
+    {
+        lg2::error(
+            "getSensorReadingsBulk failed, tid={TID}, sensors={COUNT}, rc={RC}.",
+            "TID", tid, "COUNT", sensors.size(), "RC", rc);
+    }
+    else
+    {
+        rc = decode_get_oem_sensor_readings_bulk_resp(
+            responseMsg, responseLen, &completionCode, &sensorCount,
+            entries.data(), entries.size());
+        if (rc || completionCode != PLDM_SUCCESS)
         {
-            sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
-            lg2::info(
-                "TID:{TID} end roundRobinSensors polling at {END}. duration(us):{DELTA}",
-                "TID", tid, "END", t1, "DELTA", t1 - t0);
+            // the terminus is polled sensor by sensor from now on
+            lg2::error(
+                "Failed to decode response of GetOEMSensorReadingsBulk, tid={TID}, rc={RC}, cc={CC}. Fall back to GetSensorReading.",
+                "TID", tid, "RC", rc, "CC", completionCode);
+            terminus->bulkSensorReadingSupported = false;
         }
+    }
 
-        sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
-
-        uint64_t diff = t1 - t0;
-        if (diff > pollingTimeInUsec)
+    if (rc || completionCode != PLDM_SUCCESS)
+    {
+        for (auto& sensor : sensors)
         {
-            // We have already crossed the polling interval. Don't sleep
-            continue;
+            co_await getSensorReading(sensor);
+            if (terminus->stopPolling)
+            {
+                co_return PLDM_ERROR;
+            }
         }
+        co_return rc ? rc : completionCode;
+    }
 
-        uint64_t sleepDeltaInUsec = pollingTimeInUsec - diff;
-        if (sleepDeltaInUsec < allowedBufferInUsec)
+    std::vector<std::shared_ptr<NumericSensor>> unreported;
+    for (auto& sensor : sensors)
+    {
+        auto it = std::find_if(entries.begin(), entries.begin() + sensorCount,
+                               [&sensor](const auto& entry) {
+            return entry.sensor_id == sensor->sensorId;
+        });
+        if (it == entries.begin() + sensorCount ||
+            it->completion_code != PLDM_SUCCESS)
         {
-            // If the delta is within the allowed buffer, we can skip sleeping
-            // and continue polling.
+            unreported.emplace_back(sensor);
             continue;
         }
 
-        co_await timer::Sleep(event, sleepDeltaInUsec, timer::Priority);
+        updateNumericSensorReading(sensor, it->sensor_data_size,
+                                   it->sensor_operational_state,
+                                   it->present_reading);
+    }
 
-    } while (true);
+    for (auto& sensor : unreported)
+    {
+        co_await getSensorReading(sensor);
+        if (terminus->stopPolling)
+        {
+            co_return PLDM_ERROR;
+        }
+    }
 
     co_return PLDM_SUCCESS;
 }
+#endif
 
 requester::Coroutine
     SensorManager::getSensorReading(std::shared_ptr<NumericSensor> sensor)
@@ -580,17 +831,27 @@ requester::Coroutine
         co_return completionCode;
     }
 
+    updateNumericSensorReading(sensor, sensorDataSize, sensorOperationalState,
+                               presentReading);
+    co_return completionCode;
+}
+
+void SensorManager::updateNumericSensorReading(
+    std::shared_ptr<NumericSensor> sensor, uint8_t sensorDataSize,
+    uint8_t sensorOperationalState,
+    const union_sensor_data_size& presentReading)
+{
     switch (sensorOperationalState)
     {
         case PLDM_SENSOR_ENABLED:
             break;
         case PLDM_SENSOR_DISABLED:
             sensor->updateReading(true, false, 0);
-            co_return completionCode;
+            return;
         case PLDM_SENSOR_UNAVAILABLE:
         default:
             sensor->updateReading(false, false, 0);
-            co_return completionCode;
+            return;
     }
 
     double value;
@@ -626,7 +887,6 @@ requester::Coroutine
     }
 
     sensor->updateReading(true, true, value);
-    co_return completionCode;
 }
 
 requester::Coroutine
@@ -714,14 +974,22 @@ void SensorManager::initSensorList(tid_t tid)
     auto terminus = termini[tid];
     // clear and initialize prioritySensors and roundRobinSensors list
     terminus->prioritySensors.clear();
-    std::queue<std::variant<std::shared_ptr<NumericSensor>,
-                            std::shared_ptr<StateSensor>>>
-        empty;
-    std::swap(terminus->roundRobinSensors, empty);
+    terminus->roundRobinSensors.clear();
 
     // numeric sensor
     for (auto& sensor : terminus->numericSensors)
     {
+        // the readings come from the sensor events, it is still polled at
+        // the heartbeat to catch a drift or a lost event. The event
+        // generation is only inferred from the PDR, so the heartbeat is
+        // opt-in for the termini known to send the events.
+        sensor->eventPrimary = eventHeartbeatInUsec &&
+                               terminus->asyncEventEnabled &&
+                               sensor->eventGeneration;
+        sensor->heartbeatInUsec = eventHeartbeatInUsec;
+        sensor->coalescer = coalescer;
+        sensor->minAdaptiveIntervalInUsec = adaptivePollingMinTimeInUsec;
+
         if (isPriority(sensor))
         {
             sensor->isPriority = true;
@@ -730,7 +998,7 @@ void SensorManager::initSensorList(tid_t tid)
         else
         {
             sensor->isPriority = false;
-            terminus->roundRobinSensors.push(sensor);
+            terminus->roundRobinSensors.emplace_back(sensor);
         }
     }
 
@@ -739,7 +1007,7 @@ void SensorManager::initSensorList(tid_t tid)
     {
         if (!sensor->async)
         {
-            terminus->roundRobinSensors.push(sensor);
+            terminus->roundRobinSensors.emplace_back(sensor);
         }
     }
     terminus->initSensorList = false;
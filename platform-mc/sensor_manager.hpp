@@ -29,6 +29,7 @@
 #include "numeric_sensor.hpp"
 #include "pldmServiceReadyInterface.hpp"
 #include "pldmd/dbus_impl_requester.hpp"
+#include "properties_coalescer.hpp"
 #include "requester/handler.hpp"
 #include "terminus.hpp"
 #include "terminus_manager.hpp"
@@ -48,6 +49,27 @@ using EnableIntf = sdbusplus::xyz::openbmc_project::Object::server::Enable;
 constexpr auto sensorPollingControlPath =
     "/xyz/openbmc_project/pldm/sensor_polling";
 
+using SensorVariant =
+    std::variant<std::shared_ptr<NumericSensor>, std::shared_ptr<StateSensor>>;
+
+/** @struct PollingWindow
+ *
+ *  The sensors due for update in one polling round, ordered by deadline. The
+ *  workers reading them concurrently hand them out with next and the polling
+ *  task co_awaits the window to resume once every worker finished.
+ */
+struct PollingWindow : public requester::WorkerGroup
+{
+    /** @brief due sensors with their deadline, earliest deadline first */
+    std::vector<std::pair<uint64_t, SensorVariant>> sensors;
+
+    /** @brief index of the next sensor to hand out to a worker */
+    size_t next = 0;
+
+    /** @brief start time of the polling round in usec */
+    uint64_t startTimeInUsec = 0;
+};
+
 class SensorManager;
 class SensorPollingEnableIntf : public EnableIntf
 {
@@ -144,6 +166,36 @@ class SensorManager
      */
     requester::Coroutine doSensorPollingTask(tid_t tid);
 
+    /** @brief Worker coroutine of a polling round, it reads the due sensors
+     *         handed out by the window until none is left
+     *
+     *  @param[in] tid - terminus ID
+     *  @param[in] window - the polling window of the round
+     */
+    requester::Coroutine
+        pollSensorsWorker(tid_t tid, std::shared_ptr<PollingWindow> window);
+
+    /** @brief Collect the priority and round robin sensors due for update and
+     *         order them by earliest deadline
+     *
+     *  @param[in] terminus - the terminus to be polled
+     *  @param[in] now - current time in usec
+     *  @param[out] window - the polling window of the round
+     */
+    void collectDueSensors(std::shared_ptr<Terminus> terminus, uint64_t now,
+                           PollingWindow& window);
+
+    /** @brief Hand out the next due sensor of the window to a worker
+     *
+     *  @param[in] terminus - the terminus being polled
+     *  @param[in] window - the polling window of the round
+     *
+     *  @return the sensor to read, std::nullopt if the round is over
+     */
+    std::optional<SensorVariant>
+        nextDueSensor(std::shared_ptr<Terminus> terminus,
+                      PollingWindow& window);
+
     /** @brief Sending getSensorReading command for the sensor
      *
      *  @param[in] sensor - the sensor to be updated
@@ -151,6 +203,50 @@ class SensorManager
     requester::Coroutine
         getSensorReading(std::shared_ptr<NumericSensor> sensor);
 
+#ifdef OEM_NVIDIA
+    /** @brief Check if the numeric sensor can be read by the OEM bulk sensor
+     *         reading command
+     *
+     *  @param[in] terminus - the terminus owning the sensor
+     *  @param[in] sensor - the sensor to be checked
+     *
+     *  @return bool - true: the sensor can be batched
+     */
+    bool isBulkReadable(std::shared_ptr<Terminus> terminus,
+                        const SensorVariant& sensor);
+
+    /** @brief Number of sensors read by one OEM bulk sensor reading command,
+     *         bounded by the maximum buffer size of the terminus
+     *
+     *  @param[in] terminus - the terminus to be polled
+     *
+     *  @return size_t - the maximum number of sensors in a batch
+     */
+    size_t bulkReadingLimit(std::shared_ptr<Terminus> terminus);
+
+    /** @brief Sending the OEM bulk sensor reading command for a batch of
+     *         numeric sensors. The sensors the terminus failed to report are
+     *         read by getSensorReading one by one.
+     *
+     *  @param[in] tid - terminus ID
+     *  @param[in] sensors - the sensors to be updated
+     */
+    requester::Coroutine getSensorReadingsBulk(
+        tid_t tid, std::vector<std::shared_ptr<NumericSensor>> sensors);
+#endif
+
+    /** @brief Update the numeric sensor from a decoded sensor reading
+     *
+     *  @param[in] sensor - the sensor to be updated
+     *  @param[in] sensorDataSize - data size of the present reading
+     *  @param[in] sensorOperationalState - operational state of the sensor
+     *  @param[in] presentReading - the present reading
+     */
+    void updateNumericSensorReading(
+        std::shared_ptr<NumericSensor> sensor, uint8_t sensorDataSize,
+        uint8_t sensorOperationalState,
+        const union_sensor_data_size& presentReading);
+
     /** @brief Sending getStateSensorReadings command for the sensor
      *
      *  @param[in] sensor - the sensor to be updated
@@ -166,7 +262,9 @@ class SensorManager
      */
     bool isPriority(std::shared_ptr<NumericSensor> sensor);
 
-    /** @brief initialize priority and round robin sensor list
+    /** @brief initialize priority and round robin sensor list, the numeric
+     *         sensors generating events of a terminus with asynchronous
+     *         events enabled are switched to event-primary mode
      *
      *  @param[in] tid - terminus ID needs to initialize the list
      */
@@ -183,8 +281,30 @@ class SensorManager
     /** @brief sensor polling interval in ms. */
     uint32_t pollingTime;
 
+    /** @brief number of concurrent sensor readings per terminus */
+    size_t pollingWindow;
+
+    /** @brief staleness above which a sensor misses its deadline in usec */
+    uint64_t staleLimitInUsec;
+
+    /** @brief read numeric sensors in batches with the OEM bulk sensor
+     * reading command */
+    bool bulkSensorReading;
+
+    /** @brief polling interval of the event-primary sensors in usec, the
+     * numeric sensors are always polled if it is 0 */
+    uint64_t eventHeartbeatInUsec;
+
+    /** @brief the shortest adaptive polling interval of the numeric sensors
+     * in usec, the polling intervals are static if it is 0 */
+    uint64_t adaptivePollingMinTimeInUsec;
+
     std::unique_ptr<SensorPollingEnableIntf> enableIntf = nullptr;
 
+    /** @brief batches the PropertiesChanged signals of the numeric sensors
+     * updated in a polling round */
+    std::shared_ptr<PropertiesChangedCoalescer> coalescer = nullptr;
+
     /** @brief verbose tracing flag */
     bool verbose;
 
@@ -167,11 +167,14 @@ class StateSensor
     }
 
     /** @brief  The time since last getStateSensorReadings command in usec */
-    uint64_t lastUpdatedTimeStampInUsec;
+    uint64_t lastUpdatedTimeStampInUsec = 0;
 
     /** @brief  The refresh limit in usec */
     uint64_t refreshLimitInUsec = DEFAULT_RR_REFRESH_LIMIT_IN_MS * 1000;
 
+    /** @brief  Staleness of the sensor readings */
+    PollingStatistics pollingStatistics;
+
     inline void setLastUpdatedTimeStamp(const uint64_t currentTimestampInUsec)
     {
         lastUpdatedTimeStampInUsec = currentTimestampInUsec;
@@ -184,6 +187,12 @@ class StateSensor
         return (deltaInUsec > refreshLimitInUsec);
     }
 
+    /** @brief The time at which the sensor is due for update in usec */
+    inline uint64_t getDeadline()
+    {
+        return lastUpdatedTimeStampInUsec + refreshLimitInUsec;
+    }
+
   private:
     std::unique_ptr<AvailabilityIntf> availabilityIntf = nullptr;
     std::unique_ptr<OperationalStatusIntf> operationalStatusIntf = nullptr;
@@ -145,8 +145,8 @@ class Terminus
     std::vector<std::shared_ptr<NumericSensor>> prioritySensors;
 
     /** @brief round robin sensor list */
-    std::queue<std::variant<std::shared_ptr<NumericSensor>,
-                            std::shared_ptr<StateSensor>>>
+    std::vector<std::variant<std::shared_ptr<NumericSensor>,
+                             std::shared_ptr<StateSensor>>>
         roundRobinSensors;
 
     bool stopPolling = false;
@@ -158,6 +158,11 @@ class Terminus
     /** @brief A list of parsed OEM energyCount numeric sensor PDRs */
     std::vector<std::shared_ptr<pldm_oem_energycount_numeric_sensor_value_pdr>>
         oemEnergyCountNumericSensorPdrs{};
+
+    /** @brief The flag indicates whether the terminus is still polled with
+     * the OEM bulk sensor reading command, it is cleared once the terminus
+     * fails the command */
+    bool bulkSensorReadingSupported = true;
 #endif
 
     /** @brief A list of parsed numeric effecter PDRs */
@@ -230,6 +235,10 @@ class Terminus
     /** @brief maximum buffer size the terminus can send and receive */
     uint16_t maxBufferSize;
 
+    /** @brief buffer size advertised by the terminus in the
+     *         EventMessageBufferSize response, 0 if unknown */
+    uint16_t advertisedBufferSize = 0;
+
     /** @brief callback when received interfaceAdded signal from
      * /xyz/openbmc_project/inventory */
     void interfaceAdded(sdbusplus::message::message& m);
@@ -273,10 +282,19 @@ class Terminus
      * round robin sensors were checked at least once ) */
     bool ready;
 
+    /** @brief The flag indicates the terminus takes the acknowledgement of
+     * an event in the PollForPlatformEventMessage request of the next one,
+     * it is cleared once the terminus rejects it */
+    bool mergedEventAck = true;
+
     /** @brief This value indicates the event messaging styles supported by the
      * terminus */
     uint8_t synchronyConfigurationSupported;
 
+    /** @brief The flag indicates that the terminus accepted this BMC as its
+     * asynchronous event receiver, so sensor events can replace polling */
+    bool asyncEventEnabled = false;
+
     /** @brief This value indicates if the terminus is resumed successfully */
     bool resumed;
 
@@ -32,7 +32,8 @@ TerminusManager::TerminusManager(
     Manager* manager, bool numericSensorsWithoutAuxName) :
     numericSensorsWithoutAuxName(numericSensorsWithoutAuxName),
     event(event), handler(handler), requester(requester), termini(termini),
-    localEid(localEid), tidPool(tidPoolSize, false), manager(manager)
+    localEid(localEid), tidPool(tidPoolSize, false),
+    discoveryWindow(TERMINUS_DISCOVERY_WINDOW), manager(manager)
 {
     // DSP0240 v1.1.0 table-8, special value: 0,0xFF = reserved
     tidPool[0] = true;
@@ -55,6 +56,22 @@ std::optional<MctpInfo> TerminusManager::toMctpInfo(const tid_t& tid)
     return it->second;
 }
 
+void TerminusManager::setMaxOutstandingRequests(tid_t tid, size_t count)
+{
+    auto mctpInfo = toMctpInfo(tid);
+    if (!mctpInfo)
+    {
+        return;
+    }
+
+    auto eid = std::get<0>(mctpInfo.value());
+    if (count > handler.getMaxOutstandingRequests(eid))
+    {
+        handler.setMaxOutstandingRequests(
+            eid, static_cast<uint8_t>(std::min<size_t>(count, UINT8_MAX)));
+    }
+}
+
 std::optional<tid_t> TerminusManager::toTid(const MctpInfo& mctpInfo)
 {
     auto mctpInfoTableIterator = std::find_if(
@@ -247,15 +264,34 @@ requester::Coroutine TerminusManager::discoverMctpTerminusTask()
             co_await manager->beforeDiscoverTerminus();
         }
 
-        const MctpInfos& mctpInfos = queuedMctpInfos.front();
-        for (auto& mctpInfo : mctpInfos)
+        auto window = std::make_shared<DiscoveryWindow>();
+        window->mctpInfos = queuedMctpInfos.front();
+        window->activeWorkers =
+            std::min(discoveryWindow, window->mctpInfos.size());
+        auto workers = window->activeWorkers;
+        for (size_t i = 0; i < workers; i++)
         {
-            co_await initMctpTerminus(mctpInfo);
+            discoverMctpTerminusWorker(window).detach();
         }
+        co_await *window;
 
+        // the termini known from earlier rounds are initialized again too,
+        // which renegotiates their event settings and retries the PDRs a
+        // previous round failed to fetch
         if (manager)
         {
-            co_await manager->afterDiscoverTerminus();
+            std::vector<tid_t> knownTids;
+            for (const auto& [tid, terminus] : termini)
+            {
+                if (!window->tids.contains(tid))
+                {
+                    knownTids.emplace_back(tid);
+                }
+            }
+            for (auto tid : knownTids)
+            {
+                co_await manager->initTerminus(tid);
+            }
         }
 
         queuedMctpInfos.pop();
@@ -269,10 +305,42 @@ requester::Coroutine TerminusManager::discoverMctpTerminusTask()
     co_return PLDM_SUCCESS;
 }
 
-requester::Coroutine TerminusManager::initMctpTerminus(const MctpInfo& mctpInfo)
+requester::Coroutine TerminusManager::discoverMctpTerminusWorker(
+    std::shared_ptr<DiscoveryWindow> window)
+{
+    while (window->next < window->mctpInfos.size())
+    {
+        const auto mctpInfo = window->mctpInfos[window->next++];
+        tid_t tid = 0;
+        auto rc = co_await initMctpTerminus(mctpInfo, tid);
+        if (rc != PLDM_SUCCESS)
+        {
+            continue;
+        }
+
+        // the same terminus can be reported over more than one medium, only
+        // the worker claiming the TID first goes on initializing it
+        if (!window->tids.emplace(tid).second)
+        {
+            continue;
+        }
+
+        if (manager)
+        {
+            co_await manager->initTerminus(tid);
+            manager->startSensorPolling(tid);
+        }
+    }
+
+    window->workerDone();
+    co_return PLDM_SUCCESS;
+}
+
+requester::Coroutine TerminusManager::initMctpTerminus(const MctpInfo& mctpInfo,
+                                                       tid_t& tid)
 {
     mctp_eid_t eid = std::get<0>(mctpInfo);
-    tid_t tid = 0;
+    tid = 0;
     auto rc = co_await getTidOverMctp(eid, tid);
     if (rc || tid == PLDM_TID_RESERVED)
     {
@@ -307,10 +375,21 @@ requester::Coroutine TerminusManager::initMctpTerminus(const MctpInfo& mctpInfo)
         co_return PLDM_SUCCESS;
     }
 
+    // a terminus reached over more than one medium maps to the same TID,
+    // only one of the concurrent workers creates its Terminus
+    if (!initializingTids.emplace(tid).second)
+    {
+        lg2::info(
+            "terminus tid={TID} is being initialized over another endpoint than eid={EID}.",
+            "TID", tid, "EID", eid);
+        co_return PLDM_ERROR;
+    }
+
     uint64_t supportedTypes = 0;
     rc = co_await getPLDMTypes(tid, supportedTypes);
     if (rc)
     {
+        initializingTids.erase(tid);
         lg2::error("getPLDMTypes failed, TID={TID} rc={RC}.", "TID", tid, "RC",
                    rc);
         co_return PLDM_ERROR;
@@ -328,6 +407,7 @@ requester::Coroutine TerminusManager::initMctpTerminus(const MctpInfo& mctpInfo)
     }
 
     termini[tid] = std::make_shared<Terminus>(tid, supportedTypes, uuid, *this);
+    initializingTids.erase(tid);
     co_return PLDM_SUCCESS;
 }
 
@@ -26,6 +26,7 @@
 #include "terminus.hpp"
 
 #include <queue>
+#include <set>
 
 namespace pldm
 {
@@ -41,6 +42,25 @@ constexpr size_t tidPoolSize = std::numeric_limits<tid_t>::max() + 1;
 using RequesterHandler = requester::Handler<requester::Request>;
 
 class Manager;
+
+/** @struct DiscoveryWindow
+ *
+ *  The MCTP endpoints of one discovery round. The workers initializing them
+ *  concurrently hand them out with next and the discovery task co_awaits the
+ *  window to resume once every worker finished.
+ */
+struct DiscoveryWindow : public requester::WorkerGroup
+{
+    /** @brief the endpoints to be discovered */
+    MctpInfos mctpInfos;
+
+    /** @brief index of the next endpoint to hand out to a worker */
+    size_t next = 0;
+
+    /** @brief TIDs already claimed by a worker in this round */
+    std::set<tid_t> tids;
+};
+
 /**
  * @brief TerminusManager
  *
@@ -106,6 +126,13 @@ class TerminusManager
     std::optional<tid_t> mapTid(const MctpInfo& mctpInfo, tid_t tid);
     void unmapTid(const tid_t& tid);
 
+    /** @brief Allow at least count requests in flight to the terminus
+     *
+     *  @param[in] tid - Terminus ID
+     *  @param[in] count - number of requests allowed in flight
+     */
+    void setMaxOutstandingRequests(tid_t tid, size_t count);
+
     mctp_eid_t getLocalEid()
     {
         return localEid;
@@ -132,12 +159,25 @@ class TerminusManager
      */
     requester::Coroutine discoverMctpTerminusTask();
 
+    /** @brief The worker coroutine of discoverMctpTerminusTask(). It takes
+     *         the endpoints from the window one by one, initializes the
+     *         terminus and starts its sensor polling once it is ready.
+     *
+     *  @param[in] window - the discovery window of the round
+     *  @return coroutine return_value - PLDM completion code
+     */
+    requester::Coroutine
+        discoverMctpTerminusWorker(std::shared_ptr<DiscoveryWindow> window);
+
     /** @brief Initialize terminus and then instantiate terminus object to keeps
      *         the data fetched from terminus
      *
      *  @param[in] mctpInfo - NetworkId, EID and UUID
+     *  @param[out] tid - TID assigned to the terminus
+     *  @return coroutine return_value - PLDM completion code
      */
-    requester::Coroutine initMctpTerminus(const MctpInfo& mctpInfo);
+    requester::Coroutine initMctpTerminus(const MctpInfo& mctpInfo,
+                                          tid_t& tid);
 
     /** @brief Send getTID PLDM command to destination EID and then return the
      *         value of tid in reference parameter.
@@ -191,6 +231,12 @@ class TerminusManager
     /** @brief A queue of MctpInfos to be discovered **/
     std::queue<MctpInfos> queuedMctpInfos{};
 
+    /** @brief The number of termini initialized concurrently */
+    size_t discoveryWindow;
+
+    /** @brief TIDs of the termini being created by a discovery worker */
+    std::set<tid_t> initializingTids;
+
     /** @brief coroutine handle of discoverTerminusTask */
     std::coroutine_handle<> discoverMctpTerminusTaskHandle;
 
@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "platform-mc/cper_writer.hpp"
+
+#include <systemd/sd-event.h>
+
+#include <sdeventplus/event.hpp>
+
+#include <fstream>
+#include <iterator>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::platform_mc;
+
+class CperWriterTest : public testing::Test
+{
+  protected:
+    CperWriterTest() : event(sdeventplus::Event::get_default())
+    {
+        char tmpl[] = "/tmp/cper_writer_test.XXXXXX";
+        cperDir = mkdtemp(tmpl);
+    }
+
+    ~CperWriterTest()
+    {
+        std::filesystem::remove_all(cperDir);
+    }
+
+    /** @brief Run the event loop until the number of files are notified */
+    void waitFiles(size_t count)
+    {
+        for (int i = 0; i < 50 && fileNames.size() < count; i++)
+        {
+            sd_event_run(event.get(), 100000);
+        }
+    }
+
+    static std::vector<uint8_t> readFile(const std::string& fileName)
+    {
+        std::ifstream stream(fileName, std::ios::in | std::ios::binary);
+        return {std::istreambuf_iterator<char>(stream),
+                std::istreambuf_iterator<char>()};
+    }
+
+    sdeventplus::Event event;
+    std::filesystem::path cperDir;
+    std::vector<std::string> fileNames;
+};
+
+TEST_F(CperWriterTest, writeRecords)
+{
+    const std::vector<uint8_t> first{0x01, 0x02, 0x03};
+    const std::vector<uint8_t> second{0x04, 0x05};
+
+    CperWriter writer(event, cperDir, 4, 1024,
+                      [this](const std::string& fileName) {
+        fileNames.emplace_back(fileName);
+    });
+
+    EXPECT_TRUE(writer.enqueue(1, std::vector<uint8_t>(first)));
+    EXPECT_TRUE(writer.enqueue(2, std::vector<uint8_t>(second)));
+    waitFiles(2);
+
+    ASSERT_EQ(2, fileNames.size());
+    EXPECT_EQ(cperDir, std::filesystem::path(fileNames[0]).parent_path());
+    EXPECT_EQ(first, readFile(fileNames[0]));
+    EXPECT_EQ(second, readFile(fileNames[1]));
+
+    auto statistics = writer.getStatistics();
+    EXPECT_EQ(2, statistics.written);
+    EXPECT_EQ(0, statistics.dropped);
+    EXPECT_EQ(0, statistics.failed);
+    EXPECT_EQ(0, statistics.queueDepth);
+    EXPECT_GE(statistics.maxQueueDepth, 1);
+    EXPECT_GE(statistics.maxLatencyInUsec, statistics.lastLatencyInUsec);
+}
+
+TEST_F(CperWriterTest, dropRecords)
+{
+    CperWriter writer(event, cperDir, 4, 4,
+                      [this](const std::string& fileName) {
+        fileNames.emplace_back(fileName);
+    });
+
+    // the record is larger than the queue allows
+    EXPECT_FALSE(writer.enqueue(1, std::vector<uint8_t>(5, 0xaa)));
+    EXPECT_TRUE(writer.enqueue(1, std::vector<uint8_t>(4, 0xbb)));
+    waitFiles(1);
+
+    ASSERT_EQ(1, fileNames.size());
+    EXPECT_EQ(std::vector<uint8_t>(4, 0xbb), readFile(fileNames[0]));
+
+    auto statistics = writer.getStatistics();
+    EXPECT_EQ(1, statistics.written);
+    EXPECT_EQ(1, statistics.dropped);
+}
@@ -17,6 +17,7 @@
 #include "libpldm/base.h"
 #include "libpldm/entity.h"
 #include "libpldm/platform.h"
+#include "libpldm/utils.h"
 
 #include "common/types.hpp"
 #include "fw-update/component_updater.hpp"
@@ -32,8 +33,11 @@
 #include "fw-update/update_manager.hpp"
 #include "fw-update/watch.hpp"
 #include "mock_event_manager.hpp"
+#include "mock_terminus_manager.hpp"
 #include "platform-mc/terminus_manager.hpp"
 
+#include <systemd/sd-event.h>
+
 #include <gtest/gtest.h>
 
 using ::testing::_;
@@ -169,11 +173,28 @@ TEST_F(EventManagerTest, processNumericSensorEventTest)
                                    PLDM_SENSOR_NORMAL,
                                    PLDM_SENSOR_DATA_SIZE_UINT8,
                                    SENSOR_READING};
+    uint64_t before = 0;
+    sd_event_now(event.get(), CLOCK_MONOTONIC, &before);
     rc = eventManager.handlePlatformEvent(tid, PLDM_SENSOR_EVENT,
                                           eventData.data(), eventData.size(),
                                           platformEventStatus);
+    uint64_t after = 0;
+    sd_event_now(event.get(), CLOCK_MONOTONIC, &after);
     EXPECT_EQ(PLDM_SUCCESS, rc);
     EXPECT_EQ(PLDM_EVENT_NO_LOGGING, platformEventStatus);
+
+    // the reading of the event updates the sensor, which is not due for
+    // polling until its next deadline
+    ASSERT_EQ(1, termini[tid]->numericSensors.size());
+    auto sensor = termini[tid]->numericSensors[0];
+    EXPECT_EQ(SENSOR_READING, sensor->valueIntf->value());
+    EXPECT_TRUE(sensor->isRefreshed());
+    EXPECT_GE(sensor->lastUpdatedTimeStampInUsec, before);
+    EXPECT_LE(sensor->lastUpdatedTimeStampInUsec, after);
+    EXPECT_FALSE(sensor->needsUpdate(after));
+    EXPECT_EQ(sensor->getDeadline(), sensor->lastUpdatedTimeStampInUsec +
+                                         sensor->getPollingInterval());
+    EXPECT_GT(sensor->getDeadline(), after);
 }
 
 TEST_F(EventManagerTest, getSensorThresholdMessageIdTest)
@@ -231,3 +252,230 @@ TEST_F(EventManagerTest, getSensorThresholdMessageIdTest)
         PLDM_SENSOR_UPPERWARNING, PLDM_SENSOR_NORMAL);
     EXPECT_EQ(messageId, SensorThresholdWarningHighGoingLow);
 }
+
+namespace
+{
+
+std::vector<uint8_t> pollEventResp(uint8_t completionCode, uint16_t eventId,
+                                   uint32_t nextDataTransferHandle = 0,
+                                   uint8_t transferFlag = 0,
+                                   uint8_t eventClass = 0,
+                                   const std::vector<uint8_t>& eventData = {},
+                                   uint32_t checksum = 0)
+{
+    std::vector<uint8_t> resp{0x00, PLDM_PLATFORM,
+                              PLDM_POLL_FOR_PLATFORM_EVENT_MESSAGE,
+                              completionCode};
+    resp.push_back(1); // tid
+    resp.push_back(eventId & 0xff);
+    resp.push_back(eventId >> 8);
+    if (completionCode != PLDM_SUCCESS || eventId == 0 || eventId == 0xffff)
+    {
+        return resp;
+    }
+
+    for (size_t i = 0; i < sizeof(uint32_t); i++)
+    {
+        resp.push_back(nextDataTransferHandle >> (8 * i));
+    }
+    resp.push_back(transferFlag);
+    resp.push_back(eventClass);
+    uint32_t eventDataSize = eventData.size();
+    for (size_t i = 0; i < sizeof(uint32_t); i++)
+    {
+        resp.push_back(eventDataSize >> (8 * i));
+    }
+    resp.insert(resp.end(), eventData.begin(), eventData.end());
+    if (transferFlag == PLATFORM_EVENT_END)
+    {
+        for (size_t i = 0; i < sizeof(uint32_t); i++)
+        {
+            resp.push_back(checksum >> (8 * i));
+        }
+    }
+    return resp;
+}
+
+// transferOperationFlag and eventIdToAcknowledge of a request
+std::pair<uint8_t, uint16_t> pollEventReq(const pldm::Request& request)
+{
+    auto payload = request.data() + sizeof(pldm_msg_hdr);
+    return {payload[1], static_cast<uint16_t>(payload[6] | payload[7] << 8)};
+}
+
+} // namespace
+
+TEST_F(EventManagerTest, pollForPlatformEventTaskTest)
+{
+    MockTerminusManager mockTerminusManager(event, reqHandler,
+                                            dbusImplRequester, termini,
+                                            mockTerminusManagerLocalEid,
+                                            nullptr);
+    MockEventManager mockEventManager(mockTerminusManager, termini,
+                                      fwUpdateManager);
+    pldm::tid_t tid = 1;
+    std::string uuid1("00000000-0000-0000-0000-000000000001");
+    termini[tid] = std::make_shared<Terminus>(
+        tid, 1 << PLDM_BASE | 1 << PLDM_PLATFORM, uuid1, mockTerminusManager);
+    mockTerminusManager.mapTid(
+        pldm::MctpInfo(12, uuid1,
+                       "xyz.openbmc_project.MCTP.Endpoint.MediaTypes.PCIe", 1,
+                       "xyz.openbmc_project.MCTP.Endpoint.BindingTypes.PCIe"),
+        tid);
+
+    // event 1 in a single part, event 2 in two parts, then the queue is empty
+    std::vector<uint8_t> eventData{0x01, 0x02, 0x03};
+    std::vector<std::vector<uint8_t>> responses{
+        pollEventResp(PLDM_SUCCESS, 1, 0, PLATFORM_EVENT_START_AND_END, 0xf0,
+                      {0x55}),
+        pollEventResp(PLDM_SUCCESS, 2, 2, PLATFORM_EVENT_START,
+                      PLDM_MESSAGE_POLL_EVENT, {0x01, 0x02}),
+        pollEventResp(PLDM_SUCCESS, 2, 0, PLATFORM_EVENT_END,
+                      PLDM_MESSAGE_POLL_EVENT, {0x03},
+                      crc32(eventData.data(), eventData.size())),
+        pollEventResp(PLDM_SUCCESS, 0)};
+    for (auto& response : responses)
+    {
+        EXPECT_EQ(PLDM_SUCCESS, mockTerminusManager.enqueueResponse(response));
+    }
+
+    mockEventManager.pollForPlatformEventTask(tid, 256);
+
+    // the events are acknowledged in the GetFirstPart of the next one
+    std::vector<std::pair<uint8_t, uint16_t>> expected{
+        {PLDM_GET_FIRSTPART, 0},
+        {PLDM_GET_FIRSTPART, 1},
+        {PLDM_GET_NEXTPART, 0xffff},
+        {PLDM_GET_FIRSTPART, 2}};
+    ASSERT_EQ(expected.size(), mockTerminusManager.requests.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_EQ(expected[i], pollEventReq(mockTerminusManager.requests[i]));
+    }
+    // the reassembled event 2 passed the checksum
+    EXPECT_TRUE(termini[tid]->pollEvent);
+    EXPECT_TRUE(termini[tid]->mergedEventAck);
+
+    // a terminus rejecting the merged acknowledgement is acknowledged
+    // separately
+    mockTerminusManager.requests.clear();
+    responses = {pollEventResp(PLDM_SUCCESS, 3, 0, PLATFORM_EVENT_START_AND_END,
+                               0xf0, {0x55}),
+                 pollEventResp(PLDM_ERROR_INVALID_DATA, 0),
+                 pollEventResp(PLDM_SUCCESS, 0xffff),
+                 pollEventResp(PLDM_SUCCESS, 0)};
+    for (auto& response : responses)
+    {
+        EXPECT_EQ(PLDM_SUCCESS, mockTerminusManager.enqueueResponse(response));
+    }
+
+    mockEventManager.pollForPlatformEventTask(tid, 256);
+
+    expected = {{PLDM_GET_FIRSTPART, 0},
+                {PLDM_GET_FIRSTPART, 3},
+                {PLDM_ACKNOWLEDGEMENT_ONLY, 3},
+                {PLDM_GET_FIRSTPART, 0}};
+    ASSERT_EQ(expected.size(), mockTerminusManager.requests.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_EQ(expected[i], pollEventReq(mockTerminusManager.requests[i]));
+    }
+    EXPECT_FALSE(termini[tid]->mergedEventAck);
+
+    // a terminus ignoring the merged acknowledgement sends the same event
+    // again, it is acknowledged separately instead of being polled forever
+    termini[tid]->mergedEventAck = true;
+    mockTerminusManager.requests.clear();
+    responses = {pollEventResp(PLDM_SUCCESS, 4, 0, PLATFORM_EVENT_START_AND_END,
+                               0xf0, {0x55}),
+                 pollEventResp(PLDM_SUCCESS, 4, 0, PLATFORM_EVENT_START_AND_END,
+                               0xf0, {0x55}),
+                 pollEventResp(PLDM_SUCCESS, 0xffff),
+                 pollEventResp(PLDM_SUCCESS, 0)};
+    for (auto& response : responses)
+    {
+        EXPECT_EQ(PLDM_SUCCESS, mockTerminusManager.enqueueResponse(response));
+    }
+
+    mockEventManager.pollForPlatformEventTask(tid, 256);
+
+    expected = {{PLDM_GET_FIRSTPART, 0},
+                {PLDM_GET_FIRSTPART, 4},
+                {PLDM_ACKNOWLEDGEMENT_ONLY, 4},
+                {PLDM_GET_FIRSTPART, 0}};
+    ASSERT_EQ(expected.size(), mockTerminusManager.requests.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_EQ(expected[i], pollEventReq(mockTerminusManager.requests[i]));
+    }
+    EXPECT_FALSE(termini[tid]->mergedEventAck);
+
+    // an END part filling the buffer still has room for its checksum
+    termini[tid]->pollEvent = false;
+    mockTerminusManager.requests.clear();
+    eventData = {0x01, 0x02, 0x03, 0x04};
+    responses = {pollEventResp(PLDM_SUCCESS, 5, 2, PLATFORM_EVENT_START,
+                               PLDM_MESSAGE_POLL_EVENT, {0x01, 0x02}),
+                 pollEventResp(PLDM_SUCCESS, 5, 0, PLATFORM_EVENT_END,
+                               PLDM_MESSAGE_POLL_EVENT, {0x03, 0x04},
+                               crc32(eventData.data(), eventData.size())),
+                 pollEventResp(PLDM_SUCCESS, 0xffff),
+                 pollEventResp(PLDM_SUCCESS, 0)};
+    for (auto& response : responses)
+    {
+        EXPECT_EQ(PLDM_SUCCESS, mockTerminusManager.enqueueResponse(response));
+    }
+
+    mockEventManager.pollForPlatformEventTask(tid, 2);
+
+    expected = {{PLDM_GET_FIRSTPART, 0},
+                {PLDM_GET_NEXTPART, 0xffff},
+                {PLDM_ACKNOWLEDGEMENT_ONLY, 5},
+                {PLDM_GET_FIRSTPART, 0}};
+    ASSERT_EQ(expected.size(), mockTerminusManager.requests.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_EQ(expected[i], pollEventReq(mockTerminusManager.requests[i]));
+    }
+    EXPECT_TRUE(termini[tid]->pollEvent);
+}
+
+TEST_F(EventManagerTest, rejectCperEventWhenQueueIsFull)
+{
+    char tmpl[] = "/tmp/event_manager_test.XXXXXX";
+    std::filesystem::path cperDir = mkdtemp(tmpl);
+
+    // the queue can't take a record larger than 4 bytes
+    eventManager.setCperWriter(
+        std::make_unique<CperWriter>(event, cperDir, 1, 4, nullptr));
+
+    // formatVersion, formatType, eventDataLength and the CPER data
+    std::vector<uint8_t> eventData{0x01, 0x00, 0x04, 0x00,
+                                   0xaa, 0xbb, 0xcc, 0xdd};
+    uint8_t platformEventStatus = PLDM_EVENT_NO_LOGGING;
+    auto rc = eventManager.handlePlatformEvent(
+        1, PLDM_CPER_MESSAGE_EVENT, eventData.data(), eventData.size(),
+        platformEventStatus);
+    EXPECT_EQ(PLDM_SUCCESS, rc);
+
+    // the response is encoded with the status as the responder does
+    std::array<uint8_t,
+               sizeof(pldm_msg_hdr) + PLDM_PLATFORM_EVENT_MESSAGE_RESP_BYTES>
+        response{};
+    auto responseMsg = reinterpret_cast<pldm_msg*>(response.data());
+    ASSERT_EQ(PLDM_SUCCESS,
+              encode_platform_event_message_resp(0, rc, platformEventStatus,
+                                                 responseMsg));
+
+    uint8_t completionCode = PLDM_ERROR;
+    uint8_t status = PLDM_EVENT_NO_LOGGING;
+    rc = decode_platform_event_message_resp(
+        responseMsg, response.size() - sizeof(pldm_msg_hdr), &completionCode,
+        &status);
+    ASSERT_EQ(PLDM_SUCCESS, rc);
+    EXPECT_EQ(PLDM_SUCCESS, completionCode);
+    EXPECT_EQ(PLDM_EVENT_LOGGING_REJECTED, status);
+
+    eventManager.setCperWriter(nullptr);
+    std::filesystem::remove_all(cperDir);
+}
@@ -33,6 +33,12 @@ class MockEventManager : public EventManager
                      pldm::fw_update::Manager& fwUpdateManager) :
         EventManager(terminusManager, termini, fwUpdateManager){};
 
+    /** @brief Save the CPER records with the given writer */
+    void setCperWriter(std::unique_ptr<CperWriter> writer)
+    {
+        cperWriter = std::move(writer);
+    }
+
     MOCK_METHOD(void, createSensorThresholdLogEntry,
                 (const std::string& messageID, const std::string& sensorName,
                  const double reading, const double threshold),
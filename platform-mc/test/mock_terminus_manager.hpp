@@ -18,6 +18,7 @@
 
 #include "platform-mc/terminus_manager.hpp"
 
+#include <coroutine>
 #include <queue>
 
 #include <gmock/gmock.h>
@@ -40,10 +41,12 @@ class MockTerminusManager : public TerminusManager
     {}
 
     requester::Coroutine SendRecvPldmMsgOverMctp(mctp_eid_t /*eid*/,
-                                                 Request& /*request*/,
+                                                 Request& request,
                                                  const pldm_msg** responseMsg,
                                                  size_t* responseLen) override
     {
+        requests.emplace_back(request);
+        co_await HeldResponse{*this};
 
         if (responseMsgs.empty() || responseMsg == nullptr ||
             responseLen == nullptr)
@@ -100,9 +103,57 @@ class MockTerminusManager : public TerminusManager
         return PLDM_SUCCESS;
     }
 
+    /** @brief Answer the oldest request waiting for its response
+     *
+     *  @return false if no request is waiting
+     */
+    bool releaseResponse()
+    {
+        if (heldRequests.empty())
+        {
+            return false;
+        }
+
+        auto handle = heldRequests.front();
+        heldRequests.pop();
+        handle.resume();
+        return true;
+    }
+
+    /** @struct HeldResponse
+     *
+     *  Suspends a request until releaseResponse() while holdResponses is set,
+     *  so that several requests can be in flight at once.
+     */
+    struct HeldResponse
+    {
+        MockTerminusManager& manager;
+
+        bool await_ready() const noexcept
+        {
+            return !manager.holdResponses;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            manager.heldRequests.push(handle);
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    /** @brief when set, the requests wait for releaseResponse() */
+    bool holdResponses = false;
+
+    /** @brief the requests waiting for their response, in order */
+    std::queue<std::coroutine_handle<>> heldRequests;
+
     std::queue<uint8_t*> responseMsgs;
     std::queue<size_t> responseLens;
     std::queue<std::vector<uint8_t>> responses;
+
+    /** @brief the requests sent, in order */
+    std::vector<Request> requests;
 };
 
 } // namespace platform_mc
@@ -407,4 +407,180 @@ TEST_F(NumericSensorTest, MemeoryPageRetirementSensor)
     numericSensor->updateReading(true, true,
                                  std::numeric_limits<double>::quiet_NaN());
     EXPECT_EQ(0, memoryPageRetirementCount->memoryPageRetirementCount());
-}
\ No newline at end of file
+}
+
+TEST(PollingStatisticsTest, missedDeadlines)
+{
+    PollingStatistics stats;
+    EXPECT_FALSE(stats.update(0, 750000));
+    EXPECT_FALSE(stats.update(500000, 750000));
+    EXPECT_TRUE(stats.update(1000000, 750000));
+    EXPECT_FALSE(stats.update(100, 750000));
+
+    EXPECT_EQ(stats.lastStalenessInUsec, 100u);
+    EXPECT_EQ(stats.maxStalenessInUsec, 1000000u);
+    EXPECT_EQ(stats.missedDeadlines, 1u);
+    EXPECT_TRUE(stats.reportMissed());
+
+    // the misses are reported each time the count doubles
+    EXPECT_TRUE(stats.update(1000000, 750000));
+    EXPECT_TRUE(stats.reportMissed());
+    EXPECT_TRUE(stats.update(1000000, 750000));
+    EXPECT_FALSE(stats.reportMissed());
+    EXPECT_TRUE(stats.update(1000000, 750000));
+    EXPECT_TRUE(stats.reportMissed());
+}
+
+TEST_F(NumericSensorTest, eventPrimaryPolling)
+{
+    auto pdr = std::make_shared<pldm_numeric_sensor_value_pdr>();
+    pdr->sensor_id = 1;
+    pdr->sensor_init = PLDM_SENSOR_NO_INIT;
+    pdr->base_unit = PLDM_SENSOR_UNIT_DEGRESS_C;
+    pdr->is_linear = true;
+    pdr->sensor_data_size = PLDM_SENSOR_DATA_SIZE_UINT8;
+    pdr->resolution = 1.0;
+    pdr->update_interval = 1.0; // 1 second
+    pdr->range_field_format = PLDM_RANGE_FIELD_FORMAT_UINT8;
+    pdr->supported_thresholds.bits.bit0 = 1; // upper warning
+    pdr->warning_high.value_u8 = 80;
+
+    std::string sensorName{"eventPrimary"};
+    std::string inventoryPath{
+        "/xyz/openbmc_project/inventroy/Item/Board/PLDM_device_1"};
+    NumericSensor sensor(0x01, true, pdr, sensorName, inventoryPath);
+    EXPECT_TRUE(sensor.eventGeneration);
+
+    const uint64_t last = 1000000;
+    sensor.isPriority = true;
+    sensor.setLastUpdatedTimeStamp(last);
+    EXPECT_TRUE(sensor.needsUpdate(last + 1000000));
+    EXPECT_EQ(last + 1000000, sensor.getDeadline());
+
+    // only the heartbeat is polled once the readings come from events
+    sensor.eventPrimary = true;
+    sensor.heartbeatInUsec = 10000000;
+    EXPECT_FALSE(sensor.needsUpdate(last + 1000000));
+    EXPECT_TRUE(sensor.needsUpdate(last + 10000000));
+    EXPECT_EQ(last + 10000000, sensor.getDeadline());
+
+    // a sensor without thresholds or disabled never generates events
+    pdr->sensor_id = 2;
+    pdr->supported_thresholds.byte = 0;
+    std::string noThresholdName{"noThreshold"};
+    NumericSensor noThreshold(0x01, true, pdr, noThresholdName,
+                              inventoryPath);
+    EXPECT_FALSE(noThreshold.eventGeneration);
+
+    pdr->sensor_id = 3;
+    pdr->supported_thresholds.bits.bit0 = 1;
+    pdr->sensor_init = PLDM_SENSOR_DISABLE;
+    std::string disabledName{"disabled"};
+    NumericSensor disabled(0x01, true, pdr, disabledName, inventoryPath);
+    EXPECT_FALSE(disabled.eventGeneration);
+}
+
+TEST_F(NumericSensorTest, readingDeadband)
+{
+    auto pdr = std::make_shared<pldm_numeric_sensor_value_pdr>();
+    pdr->sensor_id = 1;
+    pdr->sensor_init = PLDM_SENSOR_NO_INIT;
+    pdr->base_unit = PLDM_SENSOR_UNIT_DEGRESS_C;
+    pdr->is_linear = true;
+    pdr->sensor_data_size = PLDM_SENSOR_DATA_SIZE_UINT8;
+    pdr->resolution = 0.5;
+    pdr->plus_tolerance = 2; // deadband = 1 degree C
+    pdr->minus_tolerance = 1;
+    pdr->update_interval = 1.0;
+    pdr->range_field_format = PLDM_RANGE_FIELD_FORMAT_UINT8;
+    pdr->supported_thresholds.bits.bit0 = 1; // upper warning
+    pdr->warning_high.value_u8 = 20;
+
+    std::string sensorName{"deadband"};
+    std::string inventoryPath{
+        "/xyz/openbmc_project/inventroy/Item/Board/PLDM_device_1"};
+    NumericSensor sensor(0x01, false, pdr, sensorName, inventoryPath);
+
+    // the first reading is always published
+    sensor.updateReading(true, true, 20);
+    EXPECT_EQ(10, sensor.getReading());
+
+    // the changes within the deadband are not published
+    sensor.updateReading(true, true, 21);
+    EXPECT_EQ(10, sensor.getReading());
+    sensor.updateReading(true, true, 22);
+    EXPECT_EQ(10, sensor.getReading());
+    sensor.updateReading(true, true, 23);
+    EXPECT_EQ(11.5, sensor.getReading());
+    sensor.updateReading(true, true, 39);
+    EXPECT_EQ(19.5, sensor.getReading());
+
+    // the thresholds are checked with the reading, not the published value
+    sensor.updateReading(true, true, 40);
+    EXPECT_EQ(19.5, sensor.getReading());
+    EXPECT_TRUE(sensor.thresholdWarningIntf->warningAlarmHigh());
+
+    // a failed reading is always published
+    sensor.updateReading(true, true,
+                         std::numeric_limits<double>::quiet_NaN());
+    EXPECT_TRUE(std::isnan(sensor.getReading()));
+    sensor.handleErrGetSensorReading();
+    EXPECT_TRUE(std::isnan(sensor.getReading()));
+    EXPECT_FALSE(sensor.operationalStatusIntf->functional());
+    sensor.updateReading(true, true, 40);
+    EXPECT_EQ(20, sensor.getReading());
+    EXPECT_TRUE(sensor.operationalStatusIntf->functional());
+}
+
+TEST_F(NumericSensorTest, adaptivePolling)
+{
+    auto pdr = std::make_shared<pldm_numeric_sensor_value_pdr>();
+    pdr->sensor_id = 1;
+    pdr->sensor_init = PLDM_SENSOR_NO_INIT;
+    pdr->base_unit = PLDM_SENSOR_UNIT_DEGRESS_C;
+    pdr->is_linear = true;
+    pdr->sensor_data_size = PLDM_SENSOR_DATA_SIZE_UINT8;
+    pdr->resolution = 1.0;
+    pdr->update_interval = 1.0; // 1 second
+    pdr->range_field_format = PLDM_RANGE_FIELD_FORMAT_UINT8;
+    pdr->supported_thresholds.bits.bit0 = 1; // upper warning
+    pdr->warning_high.value_u8 = 50;
+
+    std::string sensorName{"adaptive"};
+    std::string inventoryPath{
+        "/xyz/openbmc_project/inventroy/Item/Board/PLDM_device_1"};
+    NumericSensor sensor(0x01, false, pdr, sensorName, inventoryPath);
+    sensor.isPriority = true;
+    sensor.minAdaptiveIntervalInUsec = 250000;
+
+    auto read = [&sensor](double value, uint64_t timeInUsec) {
+        sensor.updateReading(true, true, value);
+        sensor.setLastUpdatedTimeStamp(timeInUsec);
+        return sensor.getPollingInterval();
+    };
+
+    // the PDR update interval until there is a rate of change
+    EXPECT_EQ(1000000, read(20, 1000000));
+
+    // a stable sensor backs off
+    EXPECT_EQ(2000000, read(20, 2000000));
+    EXPECT_EQ(4000000, read(20, 4000000));
+    EXPECT_EQ(8000000, read(20, 8000000));
+    EXPECT_FALSE(sensor.needsUpdate(15000000));
+    EXPECT_TRUE(sensor.needsUpdate(16000000));
+
+    // a sensor trending toward the threshold speeds up
+    EXPECT_EQ(1000000, read(30, 16000000));
+    EXPECT_EQ(16000000 + 1000000, sensor.getDeadline());
+    EXPECT_EQ(750000, read(35, 17000000));
+    EXPECT_EQ(250000, read(48, 17750000));
+
+    // an asserted threshold stops the back off
+    EXPECT_EQ(1000000, read(55, 18000000));
+    EXPECT_TRUE(sensor.thresholdWarningIntf->warningAlarmHigh());
+    EXPECT_EQ(1000000, read(55, 19000000));
+
+    // the interval is static when the adaptive polling is disabled
+    sensor.minAdaptiveIntervalInUsec = 0;
+    EXPECT_EQ(1000000, read(20, 20000000));
+}
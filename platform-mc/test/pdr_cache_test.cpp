@@ -0,0 +1,115 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "platform-mc/pdr_cache.hpp"
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::platform_mc;
+
+class PDRCacheTest : public testing::Test
+{
+  protected:
+    PDRCacheTest()
+    {
+        char tmpl[] = "/tmp/pdr_cache_test.XXXXXX";
+        cacheDir = mkdtemp(tmpl);
+        signature.updateTime[0] = 0x12;
+        signature.recordCount = 2;
+        signature.repositorySize = 7;
+        signature.largestRecordSize = 4;
+    }
+
+    ~PDRCacheTest()
+    {
+        std::filesystem::remove_all(cacheDir);
+    }
+
+    std::filesystem::path cacheDir;
+    PDRRepositorySignature signature{};
+    const pldm::UUID uuid = "f72d6f90-5675-11ed-9b6a-0242ac120002";
+    const std::vector<std::vector<uint8_t>> pdrs{{0x01, 0x02, 0x03},
+                                                 {0x04, 0x05, 0x06, 0x07}};
+};
+
+TEST_F(PDRCacheTest, storeAndLoad)
+{
+    PDRCache cache(cacheDir);
+    EXPECT_FALSE(cache.load(uuid, signature));
+
+    EXPECT_TRUE(cache.store(uuid, signature, pdrs));
+    auto cached = cache.load(uuid, signature);
+    ASSERT_TRUE(cached);
+    EXPECT_EQ(pdrs, *cached);
+
+    // the cache of another terminus is not used
+    EXPECT_FALSE(cache.load("f72d6f90-5675-11ed-9b6a-0242ac120003", signature));
+
+    cache.remove(uuid);
+    EXPECT_FALSE(cache.load(uuid, signature));
+}
+
+TEST_F(PDRCacheTest, signatureMismatch)
+{
+    PDRCache cache(cacheDir);
+    EXPECT_TRUE(cache.store(uuid, signature, pdrs));
+
+    auto changed = signature;
+    changed.updateTime[0]++;
+    EXPECT_FALSE(cache.load(uuid, changed));
+
+    changed = signature;
+    changed.repositorySize++;
+    EXPECT_FALSE(cache.load(uuid, changed));
+
+    // a repository without update time is never cached
+    changed = signature;
+    changed.updateTime.fill(0);
+    EXPECT_FALSE(cache.store(uuid, changed, pdrs));
+    EXPECT_FALSE(cache.load(uuid, changed));
+    EXPECT_FALSE(cache.load(uuid, signature));
+}
+
+TEST_F(PDRCacheTest, corruptedCache)
+{
+    PDRCache cache(cacheDir);
+    EXPECT_TRUE(cache.store(uuid, signature, pdrs));
+
+    auto path = cacheDir / uuid;
+    auto size = std::filesystem::file_size(path);
+    {
+        std::fstream stream(path,
+                            std::ios::in | std::ios::out | std::ios::binary);
+        stream.seekp(size - 6);
+        stream.put(0x55);
+    }
+    EXPECT_FALSE(cache.load(uuid, signature));
+
+    std::filesystem::resize_file(path, size / 2);
+    EXPECT_FALSE(cache.load(uuid, signature));
+}
+
+TEST_F(PDRCacheTest, disabledCache)
+{
+    PDRCache cache("");
+    EXPECT_FALSE(cache.store(uuid, signature, pdrs));
+    EXPECT_FALSE(cache.load(uuid, signature));
+
+    PDRCache enabled(cacheDir);
+    EXPECT_FALSE(enabled.store("", signature, pdrs));
+}
@@ -0,0 +1,153 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION &
+ * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "common/utils.hpp"
+#include "platform-mc/numeric_sensor.hpp"
+#include "platform-mc/properties_coalescer.hpp"
+
+#include <systemd/sd-event.h>
+
+#include <sdeventplus/event.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::platform_mc;
+
+class PropertiesCoalescerTest : public testing::Test
+{
+  protected:
+    PropertiesCoalescerTest() :
+        bus(pldm::utils::DBusHandler::getBus()),
+        event(sdeventplus::Event::get_default()),
+        coalescer(std::make_shared<PropertiesChangedCoalescer>(bus, event))
+    {
+        pdr = std::make_shared<pldm_numeric_sensor_value_pdr>();
+        pdr->sensor_id = 1;
+        pdr->sensor_init = PLDM_SENSOR_NO_INIT;
+        pdr->base_unit = PLDM_SENSOR_UNIT_DEGRESS_C;
+        pdr->is_linear = true;
+        pdr->sensor_data_size = PLDM_SENSOR_DATA_SIZE_UINT8;
+        pdr->resolution = 1.0;
+        pdr->update_interval = 1.0;
+    }
+
+    /** @brief Run the event loop once without blocking */
+    void runOnce()
+    {
+        sd_event_run(event.get(), 0);
+    }
+
+    sdbusplus::bus::bus& bus;
+    sdeventplus::Event event;
+    std::shared_ptr<PropertiesChangedCoalescer> coalescer;
+    std::shared_ptr<pldm_numeric_sensor_value_pdr> pdr;
+    std::string inventoryPath{
+        "/xyz/openbmc_project/inventroy/Item/Board/PLDM_device_1"};
+};
+
+TEST_F(PropertiesCoalescerTest, pollingRound)
+{
+    std::string sensorName{"coalesced"};
+    NumericSensor sensor(0x01, false, pdr, sensorName, inventoryPath);
+    sensor.coalescer = coalescer;
+
+    coalescer->hold(0x01);
+    sensor.updateReading(true, true, 10);
+    sensor.updateReading(true, true, 20);
+    EXPECT_EQ(20, sensor.getReading());
+    // the Value interface is signalled once for both readings
+    EXPECT_EQ(1, coalescer->pending());
+
+    sensor.updateReading(true, false, 20);
+    EXPECT_EQ(2, coalescer->pending());
+
+    // the changes are held until the round is over
+    runOnce();
+    EXPECT_EQ(2, coalescer->pending());
+    coalescer->release(0x01);
+    EXPECT_EQ(0, coalescer->pending());
+}
+
+TEST_F(PropertiesCoalescerTest, outsidePollingRound)
+{
+    std::string sensorName{"deferred"};
+    NumericSensor sensor(0x01, false, pdr, sensorName, inventoryPath);
+    sensor.coalescer = coalescer;
+
+    // a reading from a sensor event is signalled on the next iteration
+    sensor.updateReading(true, true, 10);
+    EXPECT_EQ(1, coalescer->pending());
+    runOnce();
+    EXPECT_EQ(0, coalescer->pending());
+
+    // an unchanged reading is not signalled
+    sensor.updateReading(true, true, 10);
+    EXPECT_EQ(0, coalescer->pending());
+}
+
+TEST_F(PropertiesCoalescerTest, overlappingRounds)
+{
+    std::string sensorName1{"terminus1"};
+    NumericSensor sensor1(0x01, false, pdr, sensorName1, inventoryPath);
+    sensor1.coalescer = coalescer;
+    std::string sensorName2{"terminus2"};
+    NumericSensor sensor2(0x02, false, pdr, sensorName2, inventoryPath);
+    sensor2.coalescer = coalescer;
+
+    coalescer->hold(0x01);
+    coalescer->hold(0x02);
+    sensor1.updateReading(true, true, 10);
+    sensor2.updateReading(true, true, 10);
+    EXPECT_EQ(1, coalescer->pending(0x01));
+    EXPECT_EQ(1, coalescer->pending(0x02));
+
+    // the round of terminus 2 does not delay the changes of terminus 1
+    coalescer->release(0x01);
+    EXPECT_EQ(0, coalescer->pending(0x01));
+    EXPECT_EQ(1, coalescer->pending(0x02));
+
+    // a change of terminus 1 outside its round is flushed on the next
+    // iteration while terminus 2 is still being polled
+    sensor1.updateReading(true, true, 20);
+    runOnce();
+    EXPECT_EQ(0, coalescer->pending(0x01));
+    EXPECT_EQ(1, coalescer->pending(0x02));
+
+    coalescer->release(0x02);
+    EXPECT_EQ(0, coalescer->pending());
+}
+
+TEST_F(PropertiesCoalescerTest, thresholdAlarm)
+{
+    pdr->supported_thresholds.bits.bit0 = 1;
+    pdr->warning_high.value_u8 = 50;
+    pdr->range_field_format = PLDM_RANGE_FIELD_FORMAT_UINT8;
+    std::string sensorName{"threshold"};
+    NumericSensor sensor(0x01, false, pdr, sensorName, inventoryPath);
+    sensor.coalescer = coalescer;
+    ASSERT_NE(nullptr, sensor.thresholdWarningIntf);
+
+    coalescer->hold(0x01);
+    sensor.updateReading(true, true, 10);
+    EXPECT_EQ(1, coalescer->pending(0x01));
+
+    // the alarm is signalled with the reading at the end of the round
+    sensor.updateReading(true, true, 60);
+    EXPECT_TRUE(sensor.thresholdWarningIntf->warningAlarmHigh());
+    EXPECT_EQ(2, coalescer->pending(0x01));
+    coalescer->release(0x01);
+    EXPECT_EQ(0, coalescer->pending());
+}
@@ -308,3 +308,118 @@ TEST_F(TerminusManagerTest, negativeDiscoverMctpTerminusTest)
     mockTerminusManager.discoverMctpTerminus(mctpInfos);
     EXPECT_EQ(0, termini.size());
 }
+
+TEST_F(TerminusManagerTest, discoverMultipleMctpTerminiTest)
+{
+    const size_t getTidRespLen = 2;
+    const size_t setTidRespLen = 1;
+    const size_t getPldmTypesRespLen = 9;
+
+    auto rc = mockTerminusManager.clearQueuedResponses();
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + getTidRespLen> getTidResp{
+        0x00, PLDM_BASE, PLDM_GET_TID, 0x00, 0x00};
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + setTidRespLen> setTidResp{
+        0x00, PLDM_BASE, PLDM_SET_TID, 0x00};
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + getPldmTypesRespLen>
+        getPldmTypesResp{0x00, PLDM_BASE, PLDM_GET_PLDM_TYPES,
+                         0x00, 0x01,      0x00,
+                         0x00, 0x00,      0x00,
+                         0x00, 0x00,      0x00};
+    for (size_t i = 0; i < 3; i++)
+    {
+        rc = mockTerminusManager.enqueueResponse((pldm_msg*)getTidResp.data(),
+                                                 sizeof(getTidResp));
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+        rc = mockTerminusManager.enqueueResponse((pldm_msg*)setTidResp.data(),
+                                                 sizeof(setTidResp));
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+        rc = mockTerminusManager.enqueueResponse(
+            (pldm_msg*)getPldmTypesResp.data(), sizeof(getPldmTypesResp));
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+    }
+
+    pldm::MctpInfos mctpInfos{};
+    mctpInfos.emplace_back(
+        pldm::MctpInfo(12, "f72d6f90-5675-11ed-9b6a-0242ac120002", "", 1, ""));
+    mctpInfos.emplace_back(
+        pldm::MctpInfo(13, "f72d6f90-5675-11ed-9b6a-0242ac120003", "", 1, ""));
+    mctpInfos.emplace_back(
+        pldm::MctpInfo(14, "f72d6f90-5675-11ed-9b6a-0242ac120004", "", 1, ""));
+    mockTerminusManager.discoverMctpTerminus(mctpInfos);
+    EXPECT_EQ(3, termini.size());
+    EXPECT_NE(termini.end(), termini.find(12));
+    EXPECT_NE(termini.end(), termini.find(13));
+    EXPECT_NE(termini.end(), termini.find(14));
+}
+
+TEST_F(TerminusManagerTest, discoverTerminusOverTwoMediaTest)
+{
+    const size_t getTidRespLen = 2;
+    const size_t setTidRespLen = 1;
+    const size_t getPldmTypesRespLen = 9;
+
+    auto rc = mockTerminusManager.clearQueuedResponses();
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + getTidRespLen> getTidResp{
+        0x00, PLDM_BASE, PLDM_GET_TID, 0x00, 0x00};
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + setTidRespLen> setTidResp{
+        0x00, PLDM_BASE, PLDM_SET_TID, 0x00};
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + getPldmTypesRespLen>
+        getPldmTypesResp{0x00, PLDM_BASE, PLDM_GET_PLDM_TYPES,
+                         0x00, 0x01,      0x00,
+                         0x00, 0x00,      0x00,
+                         0x00, 0x00,      0x00};
+    // both endpoints answer GetTID and SetTID, only one GetPLDMTypes is sent
+    for (size_t i = 0; i < 2; i++)
+    {
+        rc = mockTerminusManager.enqueueResponse((pldm_msg*)getTidResp.data(),
+                                                 sizeof(getTidResp));
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+    }
+    for (size_t i = 0; i < 2; i++)
+    {
+        rc = mockTerminusManager.enqueueResponse((pldm_msg*)setTidResp.data(),
+                                                 sizeof(setTidResp));
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+    }
+    rc = mockTerminusManager.enqueueResponse(
+        (pldm_msg*)getPldmTypesResp.data(), sizeof(getPldmTypesResp));
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    // the same terminus reported over SMBus and PCIe
+    pldm::MctpInfos mctpInfos{};
+    mctpInfos.emplace_back(pldm::MctpInfo(
+        12, "f72d6f90-5675-11ed-9b6a-0242ac120002",
+        "xyz.openbmc_project.MCTP.Endpoint.MediaTypes.SMBus", 1,
+        "xyz.openbmc_project.MCTP.Binding.BindingTypes.SMBus"));
+    mctpInfos.emplace_back(pldm::MctpInfo(
+        13, "f72d6f90-5675-11ed-9b6a-0242ac120002",
+        "xyz.openbmc_project.MCTP.Endpoint.MediaTypes.PCIe", 1,
+        "xyz.openbmc_project.MCTP.Binding.BindingTypes.PCIe"));
+
+    mockTerminusManager.holdResponses = true;
+    mockTerminusManager.discoverMctpTerminus(mctpInfos);
+
+    // both workers wait for their GetTID response at the same time
+    EXPECT_EQ(2, mockTerminusManager.heldRequests.size());
+    while (mockTerminusManager.releaseResponse())
+    {}
+
+    EXPECT_EQ(1, termini.size());
+    ASSERT_NE(termini.end(), termini.find(12));
+    auto getPldmTypesRequests = std::count_if(
+        mockTerminusManager.requests.begin(),
+        mockTerminusManager.requests.end(), [](const auto& request) {
+            auto msg = reinterpret_cast<const pldm_msg*>(request.data());
+            return msg->hdr.command == PLDM_GET_PLDM_TYPES;
+        });
+    EXPECT_EQ(1, getPldmTypesRequests);
+
+    // the TID now maps to the preferred medium
+    auto mctpInfo = mockTerminusManager.toMctpInfo(12);
+    ASSERT_NE(mctpInfo, std::nullopt);
+    EXPECT_EQ(13, std::get<0>(mctpInfo.value()));
+}
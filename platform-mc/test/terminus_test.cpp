@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 #include "libpldm/entity.h"
+#include "libpldm/utils.h"
 
 #include "mock_terminus_manager.hpp"
 #include "platform-mc/platform_manager.hpp"
@@ -1458,4 +1459,140 @@ TEST_F(TerminusTest, TerminusOnOffLineTest)
     EXPECT_EQ(true, numericSensor->operationalStatusIntf->functional());
     // raw = 18, converted value= 18*1.5 + 1 = 28
     EXPECT_EQ(28, numericSensor->valueIntf->value());
-}
\ No newline at end of file
+}
+
+TEST_F(TerminusTest, multipartGetPDRTest)
+{
+    pldm::UUID uuid{"f72d6f90-5675-11ed-9b6a-0242ac120002"};
+    pldm::MctpInfos mctpInfos{pldm::MctpInfo(
+        12, uuid, "xyz.openbmc_project.MCTP.Endpoint.MediaTypes.PCIe", 1,
+        "xyz.openbmc_project.MCTP.Endpoint.BindingTypes.PCIe")};
+    setupResponsesForDiscoverTerminus();
+    terminusManager.discoverMctpTerminus(mctpInfos);
+    EXPECT_EQ(1, termini.size());
+    auto terminus = terminusManager.getTerminus(uuid);
+    ASSERT_NE(nullptr, terminus);
+
+    // numeric sensor PDR, sensorID=1, uint8 readings
+    std::vector<uint8_t> pdr{
+        0x01, 0x00, 0x00, 0x00, 0x01, PLDM_NUMERIC_SENSOR_PDR, 0x00, 0x00, 59,
+        0, 0x00, 0x00, 0x01, 0x00, PLDM_ENTITY_POWER_SUPPLY, 0, 1, 0, 0x1, 0x0,
+        PLDM_NO_INIT, false, PLDM_SENSOR_UNIT_DEGRESS_C, 0, 0, 0, 0, 0, 0, 0,
+        0, true, PLDM_SENSOR_DATA_SIZE_UINT8, 0, 0, 0xc0, 0x3f, 0, 0, 0x80,
+        0x3f, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0x80, 0x3f, 0, 0, 0x80, 0x3f, 255, 0,
+        PLDM_RANGE_FIELD_FORMAT_UINT8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    constexpr uint8_t firstPartSize = 20;
+
+    auto rc = terminusManager.clearQueuedResponses();
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    std::vector<uint8_t> eventMessageBufferSizeResp{
+        0x00, PLDM_PLATFORM, PLDM_EVENT_MESSAGE_BUFFER_SIZE,
+        PLDM_ERROR_UNSUPPORTED_PLDM_CMD};
+    rc = terminusManager.enqueueResponse(eventMessageBufferSizeResp);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    std::vector<uint8_t> eventMessageSupportedResp{
+        0x00, PLDM_PLATFORM, PLDM_EVENT_MESSAGE_SUPPORTED,
+        PLDM_ERROR_UNSUPPORTED_PLDM_CMD};
+    rc = terminusManager.enqueueResponse(eventMessageSupportedResp);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    std::vector<uint8_t> getPDRRepositoryInfoResp{
+        0x00, PLDM_PLATFORM, PLDM_GET_PDR_REPOSITORY_INFO,
+        PLDM_ERROR_UNSUPPORTED_PLDM_CMD};
+    rc = terminusManager.enqueueResponse(getPDRRepositoryInfoResp);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    // start part, nextDataTransferHandle is the offset of the next part
+    std::vector<uint8_t> getPdrStartResp{
+        0x00,          PLDM_PLATFORM, PLDM_GET_PDR, PLDM_SUCCESS, 0x00, 0x00,
+        0x00,          0x00,          firstPartSize, 0x00,        0x00, 0x00,
+        PLDM_START,    firstPartSize, 0x00};
+    getPdrStartResp.insert(getPdrStartResp.end(), pdr.begin(),
+                           pdr.begin() + firstPartSize);
+    rc = terminusManager.enqueueResponse(getPdrStartResp);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    // end part carries the rest of the record and the transfer CRC
+    const uint8_t lastPartSize = pdr.size() - firstPartSize;
+    std::vector<uint8_t> getPdrEndResp{
+        0x00,     PLDM_PLATFORM, PLDM_GET_PDR, PLDM_SUCCESS, 0x00, 0x00,
+        0x00,     0x00,          0x00,         0x00,         0x00, 0x00,
+        PLDM_END, lastPartSize,  0x00};
+    getPdrEndResp.insert(getPdrEndResp.end(), pdr.begin() + firstPartSize,
+                         pdr.end());
+    getPdrEndResp.push_back(crc8(pdr.data(), pdr.size()));
+    rc = terminusManager.enqueueResponse(getPdrEndResp);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    platformManager.initTerminus();
+    ASSERT_EQ(1, terminus->pdrs.size());
+    EXPECT_EQ(pdr, terminus->pdrs[0]);
+    EXPECT_EQ(1, terminus->numericSensorPdrs.size());
+}
+
+TEST_F(TerminusTest, multipartGetPDRBadCrcTest)
+{
+    pldm::UUID uuid{"f72d6f90-5675-11ed-9b6a-0242ac120002"};
+    pldm::MctpInfos mctpInfos{pldm::MctpInfo(
+        12, uuid, "xyz.openbmc_project.MCTP.Endpoint.MediaTypes.PCIe", 1,
+        "xyz.openbmc_project.MCTP.Endpoint.BindingTypes.PCIe")};
+    setupResponsesForDiscoverTerminus();
+    terminusManager.discoverMctpTerminus(mctpInfos);
+    EXPECT_EQ(1, termini.size());
+    auto terminus = terminusManager.getTerminus(uuid);
+    ASSERT_NE(nullptr, terminus);
+
+    // numeric sensor PDR, sensorID=1, uint8 readings
+    std::vector<uint8_t> pdr{
+        0x01, 0x00, 0x00, 0x00, 0x01, PLDM_NUMERIC_SENSOR_PDR, 0x00, 0x00, 59,
+        0, 0x00, 0x00, 0x01, 0x00, PLDM_ENTITY_POWER_SUPPLY, 0, 1, 0, 0x1, 0x0,
+        PLDM_NO_INIT, false, PLDM_SENSOR_UNIT_DEGRESS_C, 0, 0, 0, 0, 0, 0, 0,
+        0, true, PLDM_SENSOR_DATA_SIZE_UINT8, 0, 0, 0xc0, 0x3f, 0, 0, 0x80,
+        0x3f, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0x80, 0x3f, 0, 0, 0x80, 0x3f, 255, 0,
+        PLDM_RANGE_FIELD_FORMAT_UINT8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    constexpr uint8_t firstPartSize = 20;
+
+    auto rc = terminusManager.clearQueuedResponses();
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    std::vector<uint8_t> eventMessageBufferSizeResp{
+        0x00, PLDM_PLATFORM, PLDM_EVENT_MESSAGE_BUFFER_SIZE,
+        PLDM_ERROR_UNSUPPORTED_PLDM_CMD};
+    rc = terminusManager.enqueueResponse(eventMessageBufferSizeResp);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    std::vector<uint8_t> eventMessageSupportedResp{
+        0x00, PLDM_PLATFORM, PLDM_EVENT_MESSAGE_SUPPORTED,
+        PLDM_ERROR_UNSUPPORTED_PLDM_CMD};
+    rc = terminusManager.enqueueResponse(eventMessageSupportedResp);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    std::vector<uint8_t> getPDRRepositoryInfoResp{
+        0x00, PLDM_PLATFORM, PLDM_GET_PDR_REPOSITORY_INFO,
+        PLDM_ERROR_UNSUPPORTED_PLDM_CMD};
+    rc = terminusManager.enqueueResponse(getPDRRepositoryInfoResp);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    // start part, nextDataTransferHandle is the offset of the next part
+    std::vector<uint8_t> getPdrStartResp{
+        0x00,          PLDM_PLATFORM, PLDM_GET_PDR, PLDM_SUCCESS, 0x00, 0x00,
+        0x00,          0x00,          firstPartSize, 0x00,        0x00, 0x00,
+        PLDM_START,    firstPartSize, 0x00};
+    getPdrStartResp.insert(getPdrStartResp.end(), pdr.begin(),
+                           pdr.begin() + firstPartSize);
+    rc = terminusManager.enqueueResponse(getPdrStartResp);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    // end part carries the rest of the record and a wrong transfer CRC
+    const uint8_t lastPartSize = pdr.size() - firstPartSize;
+    std::vector<uint8_t> getPdrEndResp{
+        0x00,     PLDM_PLATFORM, PLDM_GET_PDR, PLDM_SUCCESS, 0x00, 0x00,
+        0x00,     0x00,          0x00,         0x00,         0x00, 0x00,
+        PLDM_END, lastPartSize,  0x00};
+    getPdrEndResp.insert(getPdrEndResp.end(), pdr.begin() + firstPartSize,
+                         pdr.end());
+    getPdrEndResp.push_back(crc8(pdr.data(), pdr.size()) ^ 0xff);
+    rc = terminusManager.enqueueResponse(getPdrEndResp);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    // the corrupted record is dropped
+    platformManager.initTerminus();
+    EXPECT_EQ(0, terminus->pdrs.size());
+    EXPECT_EQ(0, terminus->numericSensorPdrs.size());
+}
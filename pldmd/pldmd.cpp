@@ -151,6 +151,8 @@ int main(int argc, char** argv)
 
     auto event = Event::get_default();
     auto& bus = pldm::utils::DBusHandler::getBus();
+    // the bus is dispatched on the event loop, which keeps the cache valid
+    DBusHandler::enableCache();
     sdbusplus::server::manager::manager objManager(bus, "/");
     PldmServiceReadyIntf::initialize(bus, "/xyz/openbmc_project/pldm");
     sdbusplus::server::manager::manager sensorsObjManager(
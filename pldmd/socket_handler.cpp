@@ -74,8 +74,19 @@ SocketInfo Handler::initSocket(int type, int protocol,
         {};
 
         int returnCode = 0;
-        ssize_t peekedLength = recv(fd, nullptr, 0, MSG_PEEK | MSG_TRUNC);
-        if (peekedLength == 0)
+
+        // receive the message in one go, MSG_TRUNC makes recvmsg return the
+        // real length of the message even when it doesn't fit in the buffer
+        struct iovec rxIov
+        {
+            rxBuffer.data(), rxBuffer.size()
+        };
+        struct msghdr rxMsg
+        {};
+        rxMsg.msg_iov = &rxIov;
+        rxMsg.msg_iovlen = 1;
+        ssize_t recvDataLength = recvmsg(fd, &rxMsg, MSG_TRUNC);
+        if (recvDataLength == 0)
         {
             // MCTP daemon has closed the socket this daemon is connected to.
             // This may or may not be an error scenario, in either case the
@@ -84,72 +95,70 @@ SocketInfo Handler::initSocket(int type, int protocol,
             // failure code.
             io.get_event().exit(0);
         }
-        else if (peekedLength <= -1)
+        else if (recvDataLength <= -1)
         {
             returnCode = -errno;
-            lg2::error("recv system call failed, RC={RC}", "RC", returnCode);
+            lg2::error("recvmsg system call failed, RC={RC}", "RC",
+                       returnCode);
+        }
+        else if (static_cast<size_t>(recvDataLength) > rxBuffer.size() ||
+                 (rxMsg.msg_flags & MSG_TRUNC))
+        {
+            lg2::error("Dropped the received message of length {LENGTH}, "
+                       "larger than the receive buffer {SIZE}",
+                       "LENGTH", recvDataLength, "SIZE", rxBuffer.size());
+            // make room for the messages of this size from now on
+            rxBuffer.resize(recvDataLength);
         }
         else
         {
-            std::vector<uint8_t> requestMsg(peekedLength);
-            auto recvDataLength = recv(
-                fd, static_cast<void*>(requestMsg.data()), peekedLength, 0);
-            if (recvDataLength == peekedLength)
+            std::span<uint8_t> requestMsg(rxBuffer.data(), recvDataLength);
+            FlightRecorder::GetInstance().saveRecord(requestMsg, false);
+            if (verbose)
             {
-                FlightRecorder::GetInstance().saveRecord(requestMsg, false);
-                if (verbose)
-                {
-                    printBuffer(Rx, requestMsg);
-                }
+                printBuffer(Rx, requestMsg);
+            }
 
-                if (MCTP_MSG_TYPE_PLDM != requestMsg[2])
-                {
-                    // Skip this message and continue.
-                }
-                else
+            if (requestMsg.size() <= 2 || MCTP_MSG_TYPE_PLDM != requestMsg[2])
+            {
+                // Skip this message and continue.
+            }
+            else
+            {
+                // process message and send response
+                auto response = processRxMsg(requestMsg);
+                if (response.has_value())
                 {
-                    // process message and send response
-                    auto response = processRxMsg(requestMsg);
-                    if (response.has_value())
+                    FlightRecorder::GetInstance().saveRecord(*response, true);
+                    if (verbose)
                     {
-                        FlightRecorder::GetInstance().saveRecord(*response,
-                                                                 true);
-                        if (verbose)
-                        {
-                            printBuffer(Tx, *response);
-                        }
+                        printBuffer(Tx, *response);
+                    }
 
-                        constexpr uint8_t tagOwnerBitPos = 3;
-                        constexpr uint8_t tagOwnerMask = ~(1 << tagOwnerBitPos);
-                        // Set tag owner bit to 0 for PLDM responses
-                        requestMsg[0] = requestMsg[0] & tagOwnerMask;
-                        iov[0].iov_base = &requestMsg[0];
-                        iov[0].iov_len = sizeof(requestMsg[0]) +
-                                         sizeof(requestMsg[1]) +
-                                         sizeof(requestMsg[2]);
-                        iov[1].iov_base = (*response).data();
-                        iov[1].iov_len = (*response).size();
+                    constexpr uint8_t tagOwnerBitPos = 3;
+                    constexpr uint8_t tagOwnerMask = ~(1 << tagOwnerBitPos);
+                    // Set tag owner bit to 0 for PLDM responses, the MCTP
+                    // header of the request is sent back in place
+                    requestMsg[0] = requestMsg[0] & tagOwnerMask;
+                    iov[0].iov_base = &requestMsg[0];
+                    iov[0].iov_len = sizeof(requestMsg[0]) +
+                                     sizeof(requestMsg[1]) +
+                                     sizeof(requestMsg[2]);
+                    iov[1].iov_base = (*response).data();
+                    iov[1].iov_len = (*response).size();
 
-                        msg.msg_iov = iov;
-                        msg.msg_iovlen = sizeof(iov) / sizeof(iov[0]);
+                    msg.msg_iov = iov;
+                    msg.msg_iovlen = sizeof(iov) / sizeof(iov[0]);
 
-                        int result = sendmsg(fd, &msg, 0);
-                        if (-1 == result)
-                        {
-                            returnCode = -errno;
-                            lg2::error("sendto system call failed, RC={RC}",
-                                       "RC", returnCode);
-                        }
+                    int result = sendmsg(fd, &msg, 0);
+                    if (-1 == result)
+                    {
+                        returnCode = -errno;
+                        lg2::error("sendto system call failed, RC={RC}", "RC",
+                                   returnCode);
                     }
                 }
             }
-            else
-            {
-                lg2::error("Failure to read peeked length packet. peekedLength="
-                           "{PEEKEDLENGTH} recvDataLength={RECVDATALENGTH}",
-                           "PEEKEDLENGTH", peekedLength, "RECVDATALENGTH",
-                           recvDataLength);
-            }
         }
     };
 
@@ -213,10 +222,17 @@ SocketInfo Handler::initSocket(int type, int protocol,
 }
 
 std::optional<Response>
-    Handler::processRxMsg(const std::vector<uint8_t>& requestMsg)
+    Handler::processRxMsg(std::span<const uint8_t> requestMsg)
 {
     using MsgTag = uint8_t;
     using type = uint8_t;
+    if (requestMsg.size() <
+        sizeof(MsgTag) + sizeof(uint8_t) + sizeof(type) + sizeof(pldm_msg_hdr))
+    {
+        lg2::error("Received message is shorter than PLDM header");
+        return std::nullopt;
+    }
+
     uint8_t eid = requestMsg[1];
     pldm_header_info hdrFields{};
     auto hdr = reinterpret_cast<const pldm_msg_hdr*>(
@@ -27,6 +27,7 @@
 
 #include <map>
 #include <optional>
+#include <span>
 #include <unordered_map>
 
 namespace pldm::fw_update
@@ -79,7 +80,7 @@ class Handler
                      Manager& manager, bool verbose) :
         event(event),
         handler(handler), invoker(invoker), fwManager(fwManager),
-        manager(manager), verbose(verbose)
+        manager(manager), verbose(verbose), rxBuffer(maxRxMessageSize)
     {}
 
     int registerMctpEndpoint(EID eid, int type, int protocol,
@@ -96,8 +97,26 @@ class Handler
     SocketInfo initSocket(int type, int protocol,
                           const std::vector<uint8_t>& pathName);
 
+    /** @brief Process a received MCTP message
+     *
+     *  @param[in] requestMsg - the message including the MCTP tag, EID and
+     *                          message type, only valid during the call
+     *
+     *  @return the PLDM response to be sent back if the message is a request
+     */
     std::optional<Response>
-        processRxMsg(const std::vector<uint8_t>& requestMsg);
+        processRxMsg(std::span<const uint8_t> requestMsg);
+
+    /** @brief The largest MCTP message the demux daemon delivers, plus the
+     *         tag, EID and message type prefix
+     */
+    static constexpr size_t maxRxMessageSize = 64 * 1024 + 3;
+
+    /** @brief Receive buffer shared by all the sockets. The messages are
+     *         handled one at a time on the event loop, so the buffer is
+     *         reused for every message instead of allocating one per message.
+     */
+    std::vector<uint8_t> rxBuffer;
 
     /** @brief Socket information for MCTP Tx/Rx daemons */
     std::map<std::vector<uint8_t>,
@@ -17,11 +17,12 @@
 #include <sdeventplus/event.hpp>
 #include <sdeventplus/source/event.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <coroutine>
+#include <deque>
 #include <memory>
-#include <queue>
 #include <tuple>
 #include <unordered_map>
 
@@ -78,6 +79,11 @@ using ResponseHandler = fu2::unique_function<void(
  *  received within the instance ID expiration interval or any other failure the
  *  response handler is invoked with the empty response.
  *
+ *  By default only one request per endpoint is in flight at a time and the
+ *  rest are queued. setMaxOutstandingRequests() allows up to N requests to be
+ *  outstanding for an endpoint, responses are then matched back to their
+ *  request using the RequestKey.
+ *
  * @tparam RequestInterface - Request class type
  */
 template <class RequestInterface>
@@ -101,6 +107,8 @@ class Handler
      *  @param[in] instanceIdExpiryInterval - instance ID expiration interval
      *  @param[in] numRetries - number of request retries
      *  @param[in] responseTimeOut - time to wait between each retry
+     *  @param[in] maxOutstandingRequests - default number of requests allowed
+     *                                      in flight per endpoint
      */
     explicit Handler(
         sdeventplus::Event& event, pldm::dbus_api::Requester& requester,
@@ -109,13 +117,44 @@ class Handler
             std::chrono::seconds(INSTANCE_ID_EXPIRATION_INTERVAL),
         uint8_t numRetries = static_cast<uint8_t>(NUMBER_OF_REQUEST_RETRIES),
         std::chrono::milliseconds responseTimeOut =
-            std::chrono::milliseconds(RESPONSE_TIME_OUT)) :
+            std::chrono::milliseconds(RESPONSE_TIME_OUT),
+        uint8_t maxOutstandingRequests =
+            static_cast<uint8_t>(MAX_OUTSTANDING_REQUESTS_PER_EID)) :
         event(event),
         requester(requester), sockManager(sockManager), verbose(verbose),
         instanceIdExpiryInterval(instanceIdExpiryInterval),
-        numRetries(numRetries), responseTimeOut(responseTimeOut)
+        numRetries(numRetries), responseTimeOut(responseTimeOut),
+        defaultMaxOutstanding(
+            std::clamp<uint8_t>(maxOutstandingRequests, 1, maxInstanceIds))
     {}
 
+    /** @brief Set the number of requests allowed in flight for an endpoint
+     *
+     *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     *  @param[in] count - maximum outstanding requests, clamped to [1, 32]
+     */
+    void setMaxOutstandingRequests(mctp_eid_t eid, uint8_t count)
+    {
+        maxOutstanding[eid] = std::clamp<uint8_t>(count, 1, maxInstanceIds);
+        runRegisteredRequest(eid);
+    }
+
+    /** @brief Get the number of requests allowed in flight for an endpoint
+     *
+     *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     *
+     *  @return maximum outstanding requests for the endpoint
+     */
+    uint8_t getMaxOutstandingRequests(mctp_eid_t eid) const
+    {
+        auto it = maxOutstanding.find(eid);
+        if (it == maxOutstanding.end())
+        {
+            return defaultMaxOutstanding;
+        }
+        return it->second;
+    }
+
     /** @brief Register a PLDM request message
      *
      *  @param[in] eid - endpoint ID of the remote MCTP endpoint
@@ -134,41 +173,35 @@ class Handler
         RequestKey key{eid, instanceId, type, command};
 
         auto instanceIdExpiryCallBack = [key, this](void) {
-            if (this->handlers.contains(key.eid) &&
-                !this->handlers[key.eid].empty())
+            auto it = findRequest(key);
+            if (it == handlers[key.eid].end())
             {
-                auto& [request, responseHandler, timerInstance, requestKey] =
-                    handlers[key.eid].front();
-                if (key == requestKey)
-                {
-                    lg2::error(
-                        "Response not received for the request, instance ID "
-                        "expired. EID={EID}, INSTANCE_ID={INSTANCE_ID} ,"
-                        "TYPE={TYPE}, COMMAND={COMMAND}",
-                        "EID", key.eid, "INSTANCE_ID", key.instanceId, "TYPE",
-                        key.type, "COMMAND", key.command);
-                    request->stop();
-                    auto rc = timerInstance->stop();
-                    if (rc)
-                    {
-                        lg2::error(
-                            "Failed to stop the instance ID expiry timer. RC={RC}",
-                            "RC", rc);
-                    }
-
-                    this->removeRequestContainer.emplace(
-                        key, std::make_unique<sdeventplus::source::Defer>(
-                                 event, std::bind(&Handler::removeRequestEntry,
-                                                  this, key)));
-                }
-                else
-                {
-                    // This condition is not possible, if a response is received
-                    // before the instance ID expiry, then the response handler
-                    // is executed and the entry will be removed.
-                    assert(false);
-                }
+                // This condition is not possible, if a response is received
+                // before the instance ID expiry, then the response handler
+                // is executed and the entry will be removed.
+                assert(false);
+                return;
             }
+
+            auto& [request, responseHandler, timerInstance, requestKey] = *it;
+            lg2::error("Response not received for the request, instance ID "
+                       "expired. EID={EID}, INSTANCE_ID={INSTANCE_ID} ,"
+                       "TYPE={TYPE}, COMMAND={COMMAND}",
+                       "EID", key.eid, "INSTANCE_ID", key.instanceId, "TYPE",
+                       key.type, "COMMAND", key.command);
+            request->stop();
+            auto rc = timerInstance->stop();
+            if (rc)
+            {
+                lg2::error(
+                    "Failed to stop the instance ID expiry timer. RC={RC}",
+                    "RC", rc);
+            }
+
+            this->removeRequestContainer.emplace(
+                key, std::make_unique<sdeventplus::source::Defer>(
+                         event,
+                         std::bind(&Handler::removeRequestEntry, this, key)));
         };
 
         if (requestMsg.size() >
@@ -184,47 +217,62 @@ class Handler
         auto timer = std::make_unique<sdbusplus::Timer>(
             event.get(), instanceIdExpiryCallBack);
 
-        handlers[eid].emplace(
+        handlers[eid].emplace_back(
             std::make_tuple(std::move(request), std::move(responseHandler),
                             std::move(timer), std::move(key)));
         return runRegisteredRequest(eid);
     }
 
+    /** @brief Start queued requests for the endpoint until the number of
+     *         requests in flight reaches the endpoint's limit
+     *
+     *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     *
+     *  @return return PLDM_SUCCESS on success and PLDM_ERROR otherwise
+     */
     int runRegisteredRequest(mctp_eid_t eid)
     {
-        if (handlers[eid].empty())
+        auto& queue = handlers[eid];
+        auto inFlight = std::count_if(queue.begin(), queue.end(),
+                                      [](const RequestValue& value) {
+            return std::get<2>(value)->isRunning();
+        });
+        auto limit = getMaxOutstandingRequests(eid);
+
+        for (auto& [request, responseHandler, timerInstance, key] : queue)
         {
-            return PLDM_SUCCESS;
-        }
-
-        auto& [request, responseHandler, timerInstance, key] =
-            handlers[eid].front();
+            if (inFlight >= limit)
+            {
+                break;
+            }
 
-        if (timerInstance->isRunning())
-        {
-            // A PLDM request for the EID is running
-            return PLDM_SUCCESS;
-        }
+            if (timerInstance->isRunning())
+            {
+                // This PLDM request for the EID is already running
+                continue;
+            }
 
-        auto rc = request->start();
-        if (rc)
-        {
-            requester.markFree(eid, key.instanceId);
-            lg2::error("Failure to send the PLDM request message");
-            return rc;
-        }
+            auto rc = request->start();
+            if (rc)
+            {
+                requester.markFree(eid, key.instanceId);
+                lg2::error("Failure to send the PLDM request message");
+                return rc;
+            }
 
-        try
-        {
-            timerInstance->start(duration_cast<std::chrono::microseconds>(
-                instanceIdExpiryInterval));
-        }
-        catch (const std::runtime_error& e)
-        {
-            requester.markFree(eid, key.instanceId);
-            lg2::error("Failed to start the instance ID expiry timer.", "ERROR",
-                       e);
-            return PLDM_ERROR;
+            try
+            {
+                timerInstance->start(duration_cast<std::chrono::microseconds>(
+                    instanceIdExpiryInterval));
+            }
+            catch (const std::runtime_error& e)
+            {
+                requester.markFree(eid, key.instanceId);
+                lg2::error("Failed to start the instance ID expiry timer.",
+                           "ERROR", e);
+                return PLDM_ERROR;
+            }
+            inFlight++;
         }
 
         return PLDM_SUCCESS;
@@ -246,31 +294,28 @@ class Handler
         RequestKey key{eid, instanceId, type, command};
         bool responseHandled = false;
 
-        if (handlers.contains(eid) && !handlers[eid].empty())
+        auto it = findRequest(key);
+        if (it != handlers[eid].end())
         {
-            auto& [request, responseHandler, timerInstance, requestKey] =
-                handlers[eid].front();
-            if (key == requestKey)
+            auto& [request, responseHandler, timerInstance, requestKey] = *it;
+            request->stop();
+            auto rc = timerInstance->stop();
+            if (rc)
             {
-                request->stop();
-                auto rc = timerInstance->stop();
-                if (rc)
-                {
-                    lg2::error(
-                        "Failed to stop the instance ID expiry timer. RC={RC}",
-                        "RC", rc);
-                }
-                // Call responseHandler after erase it from the handlers to
-                // avoid starting it again in runRegisteredRequest()
-                auto unique_handler = std::move(responseHandler);
-                handlers[eid].pop();
-                unique_handler(eid, response, respMsgLen);
-
-                // Free InstanceId after calling handler so two consequent
-                // requests do not have same Instance Id
-                requester.markFree(eid, instanceId);
-                responseHandled = true;
+                lg2::error(
+                    "Failed to stop the instance ID expiry timer. RC={RC}",
+                    "RC", rc);
             }
+            // Call responseHandler after erase it from the handlers to
+            // avoid starting it again in runRegisteredRequest()
+            auto unique_handler = std::move(responseHandler);
+            handlers[eid].erase(it);
+            unique_handler(eid, response, respMsgLen);
+
+            // Free InstanceId after calling handler so two consequent
+            // requests do not have same Instance Id
+            requester.markFree(eid, instanceId);
+            responseHandled = true;
         }
 
         if (!responseHandled)
@@ -296,6 +341,10 @@ class Handler
     uint8_t numRetries;           //!< number of request retries
     std::chrono::milliseconds
         responseTimeOut; //!< time to wait between each retry
+    uint8_t defaultMaxOutstanding; //!< default requests in flight per EID
+
+    /** @brief Per endpoint override of the requests allowed in flight */
+    std::unordered_map<mctp_eid_t, uint8_t> maxOutstanding;
 
     /** @brief Container for storing the details of the PLDM request
      *         message, handler for the corresponding PLDM response, the
@@ -304,11 +353,26 @@ class Handler
     using RequestValue =
         std::tuple<std::unique_ptr<RequestInterface>, ResponseHandler,
                    std::unique_ptr<sdbusplus::Timer>, RequestKey>;
-    using RequestQueue = std::queue<RequestValue>;
+    using RequestQueue = std::deque<RequestValue>;
 
     /** @brief Container for storing the PLDM request entries */
     std::unordered_map<mctp_eid_t, RequestQueue> handlers;
 
+    /** @brief Find the request entry matching the key
+     *
+     *  @param[in] key - key for the Request
+     *
+     *  @return iterator to the entry, or end() of the EID's queue
+     */
+    typename RequestQueue::iterator findRequest(const RequestKey& key)
+    {
+        auto& queue = handlers[key.eid];
+        return std::find_if(queue.begin(), queue.end(),
+                            [&key](const RequestValue& value) {
+            return std::get<3>(value) == key;
+        });
+    }
+
     /** @brief Container to store information about the request entries to be
      *         removed after the instance ID timer expires
      */
@@ -325,20 +389,16 @@ class Handler
         if (removeRequestContainer.contains(key))
         {
             removeRequestContainer[key].reset();
-            if (!handlers[key.eid].empty())
+            auto it = findRequest(key);
+            if (it != handlers[key.eid].end())
             {
-                auto& [request, responseHandler, timerInstance, requestKey] =
-                    handlers[key.eid].front();
-                if (key == requestKey)
-                {
-                    auto unique_handler = std::move(responseHandler);
-                    handlers[key.eid].pop();
-
-                    // Call response handler with an empty response to indicate
-                    // no response only if request is removed from the queue
-                    unique_handler(key.eid, nullptr, 0);
-                    requester.markFree(key.eid, key.instanceId);
-                }
+                auto unique_handler = std::move(std::get<1>(*it));
+                handlers[key.eid].erase(it);
+
+                // Call response handler with an empty response to indicate
+                // no response only if request is removed from the queue
+                unique_handler(key.eid, nullptr, 0);
+                requester.markFree(key.eid, key.instanceId);
             }
             removeRequestContainer.erase(key);
         }
@@ -18,6 +18,26 @@ using ::testing::Exactly;
 using ::testing::NiceMock;
 using ::testing::Return;
 
+/** @brief Request which counts the messages sent to the endpoints */
+class CountingRequest : public RequestRetryTimer
+{
+  public:
+    CountingRequest(int /*fd*/, mctp_eid_t /*eid*/, sdeventplus::Event& event,
+                    pldm::Request&& /*requestMsg*/, uint8_t numRetries,
+                    milliseconds responseTimeOut, bool /*verbose*/) :
+        RequestRetryTimer(event, numRetries, responseTimeOut)
+    {}
+
+    static inline int sendCount = 0;
+
+  private:
+    int send() const override
+    {
+        sendCount++;
+        return PLDM_SUCCESS;
+    }
+};
+
 class HandlerTest : public testing::Test
 {
   protected:
@@ -157,3 +177,64 @@ TEST_F(HandlerTest, multipleRequestResponseScenario)
     EXPECT_EQ(callbackCount, 2);
     EXPECT_EQ(instanceId, dbusImplReq.getInstanceId(eid));
 }
+
+TEST_F(HandlerTest, pipelinedRequestResponseScenario)
+{
+    Handler<CountingRequest> reqHandler(event, dbusImplReq, sockManager,
+                                        false, seconds(2), 2,
+                                        milliseconds(100));
+    reqHandler.setMaxOutstandingRequests(eid, 2);
+    EXPECT_EQ(reqHandler.getMaxOutstandingRequests(eid), 2);
+    EXPECT_EQ(reqHandler.getMaxOutstandingRequests(eid + 1), 1);
+    CountingRequest::sendCount = 0;
+
+    pldm::Request request{};
+    auto instanceId = dbusImplReq.getInstanceId(eid);
+    auto rc = reqHandler.registerRequest(
+        eid, instanceId, 0, 0, std::move(request),
+        std::move(std::bind_front(&HandlerTest::pldmResponseCallBack, this)));
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    EXPECT_EQ(CountingRequest::sendCount, 1);
+
+    pldm::Request requestNxt{};
+    auto instanceIdNxt = dbusImplReq.getInstanceId(eid);
+    rc = reqHandler.registerRequest(
+        eid, instanceIdNxt, 0, 0, std::move(requestNxt),
+        std::move(std::bind_front(&HandlerTest::pldmResponseCallBack, this)));
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    // The second request is sent before the first one is answered
+    EXPECT_EQ(CountingRequest::sendCount, 2);
+
+    // A third request waits for one of the two in flight
+    pldm::Request requestLast{};
+    auto instanceIdLast = dbusImplReq.getInstanceId(eid);
+    rc = reqHandler.registerRequest(
+        eid, instanceIdLast, 0, 0, std::move(requestLast),
+        std::move(std::bind_front(&HandlerTest::pldmResponseCallBack, this)));
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    EXPECT_EQ(CountingRequest::sendCount, 2);
+
+    // Both requests are in flight, so the response to the second request is
+    // handled before the first request is answered
+    pldm::Response response(sizeof(pldm_msg_hdr) + sizeof(uint8_t));
+    auto responsePtr = reinterpret_cast<const pldm_msg*>(response.data());
+    reqHandler.handleResponse(eid, instanceIdNxt, 0, 0, responsePtr,
+                              sizeof(response));
+    EXPECT_EQ(validResponse, true);
+    EXPECT_EQ(callbackCount, 1);
+    EXPECT_EQ(CountingRequest::sendCount, 3);
+    validResponse = false;
+
+    reqHandler.handleResponse(eid, instanceId, 0, 0, responsePtr,
+                              sizeof(response));
+    EXPECT_EQ(validResponse, true);
+    EXPECT_EQ(callbackCount, 2);
+    validResponse = false;
+
+    reqHandler.handleResponse(eid, instanceIdLast, 0, 0, responsePtr,
+                              sizeof(response));
+    EXPECT_EQ(validResponse, true);
+    EXPECT_EQ(callbackCount, 3);
+    EXPECT_EQ(instanceId, dbusImplReq.getInstanceId(eid));
+}